@@ -0,0 +1,656 @@
+/**
+  **********************************************************************************************************************
+   * @file   : OLED_SSD1306_Benchmark.c
+   * @author : Sharath N
+   * @brief  : Cycle count benchmarks for the SSD1306 OLED Driver drawing paths
+  **********************************************************************************************************************
+*/
+
+#include "OLED_SSD1306_Benchmark.h"
+#include "stm32f4xx_hal.h"
+#include <stdio.h>
+
+/* Every case is run this many times and the average is reported */
+#define OLED_BENCH_REPEAT            16
+
+
+/* Drawing call under test, rectangle style arguments */
+typedef void (*OLED_Bench_RectFn_t)(uint16_t x, uint16_t y, uint16_t w, uint16_t h, OLED_COLOR_t color);
+
+/* One rectangle benchmark case */
+typedef struct {
+	const char *Name;
+	OLED_Bench_RectFn_t Legacy;
+	OLED_Bench_RectFn_t Fast;
+	uint16_t X, Y, W, H;
+} OLED_Bench_RectCase_t;
+
+
+/************************************* Legacy per pixel implementations **************************************/
+
+/* Filled rectangle as drawn before span fills: one DrawPixel per pixel, w + 1 by h + 1 pixels */
+static void OLED_BENCH_LegacyFilledRectangle(uint16_t x, uint16_t y, uint16_t w, uint16_t h, OLED_COLOR_t color)
+{
+	uint16_t i, j;
+	
+	for (i = 0; i <= h; i++)
+	{
+		for (j = 0; j <= w; j++)
+		{
+			OLED_SSD1306_DrawPixel(x + j, y + i, color);
+		}
+	}
+}
+
+/* Horizontal line as drawn before span fills */
+static void OLED_BENCH_LegacyHLine(uint16_t x, uint16_t y, uint16_t w, uint16_t h, OLED_COLOR_t color)
+{
+	uint16_t i;
+	
+	(void)h;
+	
+	for (i = 0; i < w; i++)
+	{
+		OLED_SSD1306_DrawPixel(x + i, y, color);
+	}
+}
+
+/* Vertical line as drawn before span fills */
+static void OLED_BENCH_LegacyVLine(uint16_t x, uint16_t y, uint16_t w, uint16_t h, OLED_COLOR_t color)
+{
+	uint16_t i;
+	
+	(void)w;
+	
+	for (i = 0; i < h; i++)
+	{
+		OLED_SSD1306_DrawPixel(x, y + i, color);
+	}
+}
+
+/* Driver span paths with the common argument list */
+static void OLED_BENCH_FastHLine(uint16_t x, uint16_t y, uint16_t w, uint16_t h, OLED_COLOR_t color)
+{
+	(void)h;
+	OLED_SSD1306_DrawHLine(x, y, w, color);
+}
+
+static void OLED_BENCH_FastVLine(uint16_t x, uint16_t y, uint16_t w, uint16_t h, OLED_COLOR_t color)
+{
+	(void)w;
+	OLED_SSD1306_DrawVLine(x, y, h, color);
+}
+
+
+static const OLED_Bench_RectCase_t OLED_BENCH_SpanCases[] = {
+	{ "FilledRect 128x64",   OLED_BENCH_LegacyFilledRectangle, OLED_SSD1306_DrawFilledRectangle, 0, 0, OLED_WIDTH - 1, OLED_HEIGHT - 1 },
+	{ "FilledRect 31x21 @5,3", OLED_BENCH_LegacyFilledRectangle, OLED_SSD1306_DrawFilledRectangle, 5, 3, 30, 20 },
+	{ "HLine 128",           OLED_BENCH_LegacyHLine,           OLED_BENCH_FastHLine,             0, 13, OLED_WIDTH, 1 },
+	{ "VLine 64",            OLED_BENCH_LegacyVLine,           OLED_BENCH_FastVLine,             77, 0, 1, OLED_HEIGHT },
+};
+
+
+/* 8-bit test image for the dithering benchmark: horizontal ramp with a vertical sine-like ripple */
+static uint8_t OLED_BENCH_Gray8[OLED_WIDTH * OLED_HEIGHT];
+
+/* Error rows of the legacy error diffusion, 2 guard entries on each side */
+static int16_t OLED_BENCH_Error[3][OLED_WIDTH + 4];
+
+static const char *const OLED_BENCH_DitherNames[] = {
+	"Gray8 Threshold 128x64", "Gray8 Bayer 128x64", "Gray8 Floyd-Steinberg 128x64", "Gray8 Atkinson 128x64"
+};
+
+
+/* Dithering as done in application code before DrawGray8: one decision and one DrawPixel per pixel */
+static void OLED_BENCH_LegacyGray8(const uint8_t *src, OLED_DITHER_t mode)
+{
+	static const uint8_t bayer[8][8] = {
+		{  0, 32,  8, 40,  2, 34, 10, 42 }, { 48, 16, 56, 24, 50, 18, 58, 26 },
+		{ 12, 44,  4, 36, 14, 46,  6, 38 }, { 60, 28, 52, 20, 62, 30, 54, 22 },
+		{  3, 35, 11, 43,  1, 33,  9, 41 }, { 51, 19, 59, 27, 49, 17, 57, 25 },
+		{ 15, 47,  7, 39, 13, 45,  5, 37 }, { 63, 31, 55, 23, 61, 29, 53, 21 }
+	};
+	int16_t *e0 = &OLED_BENCH_Error[0][2];
+	int16_t *e1 = &OLED_BENCH_Error[1][2];
+	int16_t *e2 = &OLED_BENCH_Error[2][2];
+	int16_t *tmp;
+	int16_t x, y, v, err;
+	uint8_t white;
+	
+	memset(OLED_BENCH_Error, 0, sizeof(OLED_BENCH_Error));
+	
+	for (y = 0; y < OLED_HEIGHT; y++)
+	{
+		for (x = 0; x < OLED_WIDTH; x++)
+		{
+			v = src[y * OLED_WIDTH + x];
+			
+			if (mode == OLED_DITHER_THRESHOLD || mode == OLED_DITHER_BAYER)
+			{
+				white = v > ((mode == OLED_DITHER_BAYER) ? bayer[y & 7][x & 7] * 4 + 2 : 127);
+			}
+			else
+			{
+				v += e0[x];
+				white = v > 127;
+				err = white ? v - 255 : v;
+				
+				if (mode == OLED_DITHER_ATKINSON)
+				{
+					e0[x + 1] += err / 8;
+					e0[x + 2] += err / 8;
+					e1[x - 1] += err / 8;
+					e1[x] += err / 8;
+					e1[x + 1] += err / 8;
+					e2[x] += err / 8;
+				}
+				else
+				{
+					e0[x + 1] += err * 7 / 16;
+					e1[x - 1] += err * 3 / 16;
+					e1[x] += err * 5 / 16;
+					e1[x + 1] += err / 16;
+				}
+			}
+			
+			OLED_SSD1306_DrawPixel(x, y, white ? OLED_COLOR_WHITE : OLED_COLOR_BLACK);
+		}
+		
+		tmp = e0;
+		e0 = e1;
+		e1 = e2;
+		e2 = tmp;
+		memset(e2 - 2, 0, (OLED_WIDTH + 4) * sizeof(int16_t));
+	}
+}
+
+/* The text benchmarks draw with the full built-in fonts, a subset build may have left any of them out */
+#ifndef OLED_FONTS_SUBSET
+
+/* Character as drawn before page-major glyphs: one DrawPixel per pixel of the cell, background included
+   unless transparent. Enlarged text is a filled rectangle of scale x scale pixels per glyph pixel */
+static void OLED_BENCH_LegacyPutc(char ch, const OLED_FontDef_t *Font, uint16_t x, uint16_t y, OLED_COLOR_t color,
+                                  uint8_t transparent, uint8_t scale)
+{
+	const uint16_t *rows = &Font->data[OLED_FONTS_GetGlyph(Font, (uint8_t)ch) * Font->FontHeight];
+	uint16_t i, j, b;
+	
+	for (i = 0; i < Font->FontHeight; i++)
+	{
+		b = rows[i];
+		
+		for (j = 0; j < Font->FontWidth; j++)
+		{
+			if (scale > 1 && (((b << j) & 0x8000) || !transparent))
+			{
+				OLED_SSD1306_DrawFilledRectangle(x + j * scale, y + i * scale, scale - 1, scale - 1,
+				                                 ((b << j) & 0x8000) ? color : (OLED_COLOR_t)!color);
+			}
+			else if ((b << j) & 0x8000)
+			{
+				OLED_SSD1306_DrawPixel(x + j, y + i, color);
+			}
+			else if (!transparent)
+			{
+				OLED_SSD1306_DrawPixel(x + j, y + i, (OLED_COLOR_t)!color);
+			}
+		}
+	}
+}
+
+#endif /* OLED_FONTS_SUBSET */
+
+
+/* 128x64 help page (framed 7x10 text and a filled box) for the decode benchmark, from oled_assets --rle and --lz */
+static const uint8_t OLED_BENCH_HelpRle[852] = {
+	0x00, 0xFF, 0xFE, 0x01, 0x00, 0x31, 0xFF, 0x49, 0x01, 0x89, 0x11, 0xFF, 0x01, 0x00, 0xC1, 0xFE,
+	0xA1, 0x00, 0xC1, 0xFF, 0x01, 0x01, 0x21, 0xF9, 0xFF, 0x21, 0xFE, 0x01, 0x01, 0x21, 0xF9, 0xFF,
+	0x21, 0xFE, 0x01, 0xFF, 0x21, 0x00, 0xE9, 0xFD, 0x01, 0x01, 0xE1, 0x41, 0xFF, 0x21, 0x00, 0xC1,
+	0xFF, 0x01, 0x00, 0xC1, 0xFF, 0x21, 0x01, 0x41, 0xE1, 0xFF, 0x01, 0x00, 0x41, 0xFF, 0xA1, 0x01,
+	0x21, 0x41, 0xF8, 0x01, 0xFF, 0x21, 0xFF, 0x41, 0x00, 0x81, 0xF8, 0x01, 0x04, 0xF9, 0x31, 0xC1,
+	0x01, 0xF9, 0xFF, 0x01, 0x00, 0xC1, 0xFE, 0xA1, 0x00, 0xC1, 0xFF, 0x01, 0x01, 0x21, 0xF9, 0xFF,
+	0x21, 0xFE, 0x01, 0x04, 0xE1, 0x01, 0xE1, 0x01, 0xE1, 0xFF, 0x01, 0x00, 0xC1, 0xFE, 0x21, 0x00,
+	0xC1, 0xFF, 0x01, 0x01, 0xE1, 0x41, 0xFF, 0x21, 0x00, 0x41, 0xFF, 0x01, 0x05, 0xF9, 0x81, 0x41,
+	0x21, 0x07, 0xFF, 0xFE, 0x00, 0x04, 0x02, 0x04, 0x84, 0x04, 0x03, 0xFF, 0x00, 0x00, 0x03, 0xFE,
+	0x04, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x83, 0xFF, 0x84, 0xFD, 0x00, 0x00, 0x03, 0xFF, 0x04, 0xFE,
+	0x00, 0xFF, 0x80, 0x00, 0x87, 0xFD, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00,
+	0x13, 0xFF, 0x14, 0x01, 0x12, 0x0F, 0xFF, 0x00, 0x04, 0x02, 0x84, 0x04, 0x05, 0x02, 0xF8, 0x00,
+	0x01, 0x82, 0x02, 0xFF, 0x01, 0x00, 0x80, 0xFD, 0x00, 0x00, 0x80, 0xFD, 0x00, 0x00, 0x07, 0xFF,
+	0x00, 0x01, 0x03, 0x07, 0xFF, 0x00, 0x00, 0x83, 0xFE, 0x84, 0x00, 0x82, 0xFE, 0x00, 0x02, 0x03,
+	0x84, 0x04, 0xFE, 0x00, 0x04, 0x01, 0x07, 0x00, 0x07, 0x01, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x04,
+	0x00, 0x03, 0xFF, 0x00, 0x00, 0x07, 0xFB, 0x00, 0x05, 0x07, 0x00, 0x01, 0x02, 0xE4, 0xFF, 0xFE,
+	0x00, 0x02, 0x02, 0x01, 0x7F, 0xF6, 0x00, 0x00, 0x23, 0xFF, 0x44, 0x01, 0x48, 0x31, 0xFF, 0x00,
+	0x00, 0x3C, 0xFE, 0x4A, 0x00, 0x2C, 0xFD, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x3C, 0xFE, 0x4A,
+	0x00, 0x2C, 0xFF, 0x00, 0x00, 0x3C, 0xFE, 0x42, 0x00, 0x24, 0xFF, 0x00, 0x01, 0x02, 0x3F, 0xFF,
+	0x42, 0xF7, 0x00, 0x04, 0x1F, 0x70, 0x0E, 0x70, 0x1F, 0xFF, 0x00, 0xFF, 0x02, 0x00, 0x7E, 0xFC,
+	0x00, 0xFE, 0x10, 0xFE, 0x00, 0x00, 0x7F, 0xFE, 0x04, 0xFE, 0x00, 0xFF, 0x02, 0x00, 0x7E, 0xE4,
+	0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x30, 0xFF, 0x08, 0x01, 0x88, 0x70, 0xF8, 0x00, 0x00, 0xF8,
+	0xFD, 0x48, 0xFF, 0x00, 0x01, 0xE0, 0x40, 0xFF, 0x20, 0x00, 0xC0, 0xFF, 0x00, 0x01, 0x20, 0xF8,
+	0xFF, 0x20, 0xFE, 0x00, 0x00, 0xC0, 0xFE, 0xA0, 0x00, 0xC0, 0xFF, 0x00, 0x01, 0xE0, 0x40, 0xFF,
+	0x20, 0x00, 0x40, 0xF8, 0x00, 0x01, 0x20, 0xF8, 0xFF, 0x20, 0xFE, 0x00, 0x01, 0xF8, 0x40, 0xFF,
+	0x20, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0xC0, 0xFE, 0xA0, 0x00, 0xC0, 0xF8, 0x00, 0x01, 0xE0, 0x40,
+	0xFF, 0x20, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x40, 0xFE, 0xA0, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x40,
+	0xFF, 0xA0, 0x01, 0x20, 0x40, 0xFF, 0x00, 0x00, 0x40, 0xFF, 0xA0, 0x01, 0x20, 0x40, 0xFF, 0x00,
+	0x04, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0xFF, 0x00, 0x00, 0xC0, 0xFE, 0x20, 0x01, 0xC7, 0xFF, 0xFE,
+	0x00, 0x04, 0x04, 0x86, 0x85, 0x84, 0x04, 0xF8, 0x00, 0x00, 0x87, 0xFE, 0x84, 0x00, 0x04, 0xFF,
+	0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x04, 0xFE, 0x00, 0x00,
+	0x03, 0xFE, 0x04, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x07, 0xF3, 0x00, 0x00, 0x83, 0xFF, 0x84, 0xFE,
+	0x00, 0x00, 0x87, 0xFE, 0x00, 0x00, 0x87, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x04, 0x00, 0x02, 0xFE,
+	0x00, 0x00, 0x80, 0xFC, 0x00, 0x01, 0x1F, 0x02, 0xFF, 0x04, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x03,
+	0xFF, 0x04, 0x01, 0x02, 0x07, 0xFF, 0x00, 0x00, 0x02, 0xFF, 0x04, 0x01, 0x05, 0x02, 0xFF, 0x00,
+	0x00, 0x02, 0xFF, 0x04, 0x01, 0x05, 0x02, 0xFF, 0x00, 0x04, 0x01, 0x07, 0x00, 0x07, 0x01, 0xFF,
+	0x00, 0x00, 0x03, 0xFE, 0x04, 0x01, 0x63, 0xFF, 0xFE, 0x00, 0x01, 0x21, 0x40, 0xFF, 0x44, 0x00,
+	0x3B, 0xF8, 0x00, 0x00, 0x7F, 0xFE, 0x08, 0x00, 0x07, 0xFF, 0x00, 0x01, 0x7E, 0x04, 0xFF, 0x02,
+	0x00, 0x04, 0xFF, 0x00, 0x00, 0x3C, 0xFE, 0x4A, 0x00, 0x2C, 0xFF, 0x00, 0x00, 0x24, 0xFF, 0x4A,
+	0x01, 0x52, 0x24, 0xFF, 0x00, 0x00, 0x24, 0xFF, 0x4A, 0x01, 0x52, 0x24, 0xF8, 0x00, 0x00, 0x3F,
+	0xFE, 0x40, 0x00, 0x3F, 0xFF, 0x00, 0x04, 0x7F, 0x04, 0x0A, 0x31, 0x40, 0xF8, 0x00, 0x01, 0x02,
+	0x3F, 0xFF, 0x42, 0xFE, 0x00, 0x01, 0x3C, 0x42, 0xE2, 0xFF, 0xFF, 0x00, 0x00, 0x3C, 0xFE, 0x4A,
+	0x01, 0x2C, 0xFF, 0xFE, 0x00, 0x00, 0xF8, 0xFE, 0x40, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0xC0, 0xFE,
+	0x20, 0x00, 0xC0, 0xFF, 0x00, 0xFF, 0x08, 0x00, 0xF8, 0xFD, 0x00, 0x00, 0xC0, 0xFF, 0x20, 0x01,
+	0x40, 0xF8, 0xF8, 0x00, 0x00, 0xF8, 0xFE, 0x48, 0x00, 0xB0, 0xFE, 0x00, 0x02, 0xF0, 0x08, 0xF0,
+	0xFE, 0x00, 0x00, 0xF0, 0xFE, 0x08, 0x00, 0x10, 0xFF, 0x00, 0x04, 0xF8, 0x40, 0xA0, 0x10, 0x08,
+	0xF8, 0x00, 0x01, 0x20, 0xF8, 0xFF, 0x20, 0xFE, 0x00, 0x00, 0xC0, 0xFE, 0x20, 0x00, 0xC0, 0xFD,
+	0x00, 0xE2, 0xFF, 0xFF, 0x00, 0x00, 0xC0, 0xFE, 0xA0, 0x01, 0xC6, 0xFF, 0xFE, 0x80, 0x00, 0x87,
+	0xFE, 0x80, 0x00, 0x87, 0xFF, 0x80, 0x00, 0x83, 0xFE, 0x84, 0x00, 0x83, 0xFD, 0x80, 0x00, 0x87,
+	0xFD, 0x80, 0x00, 0x83, 0xFF, 0x84, 0x01, 0x82, 0x87, 0xF8, 0x80, 0x00, 0x87, 0xFE, 0x84, 0x00,
+	0x83, 0xFF, 0x80, 0x00, 0x87, 0xFE, 0x81, 0x00, 0x87, 0xFF, 0x80, 0x00, 0x83, 0xFE, 0x84, 0x00,
+	0x82, 0xFF, 0x80, 0x00, 0x87, 0xFF, 0x80, 0x01, 0x83, 0x84, 0xF7, 0x80, 0x00, 0x83, 0xFF, 0x84,
+	0xFE, 0x80, 0x00, 0x83, 0xFE, 0x84, 0x00, 0x83, 0xFD, 0x80, 0xE2, 0x87, 0xFF, 0x80, 0x00, 0x83,
+	0xFE, 0x84, 0x00, 0xE2,
+};
+
+static const uint8_t OLED_BENCH_HelpLz[547] = {
+	0x00, 0xFF, 0x81, 0x01, 0x07, 0x31, 0x49, 0x49, 0x89, 0x11, 0x01, 0x01, 0xC1, 0x81, 0xA1, 0x06,
+	0xC1, 0x01, 0x01, 0x21, 0xF9, 0x21, 0x21, 0x81, 0x01, 0xD4, 0x06, 0x01, 0x21, 0xE9, 0x82, 0x01,
+	0x03, 0xE1, 0x41, 0x21, 0x21, 0xC0, 0x1B, 0x0B, 0xC1, 0x21, 0x21, 0x41, 0xE1, 0x01, 0x01, 0x41,
+	0xA1, 0xA1, 0x21, 0x41, 0x87, 0x01, 0xC0, 0x13, 0x01, 0x41, 0x81, 0x87, 0x01, 0x04, 0xF9, 0x31,
+	0xC1, 0x01, 0xF9, 0xF4, 0x4C, 0x00, 0xE1, 0xC8, 0x01, 0xC4, 0x3E, 0xC4, 0x45, 0xC4, 0x4C, 0xC0,
+	0x3E, 0x05, 0xF9, 0x81, 0x41, 0x21, 0x07, 0xFF, 0x81, 0x00, 0x07, 0x02, 0x04, 0x84, 0x04, 0x03,
+	0x00, 0x00, 0x03, 0x81, 0x04, 0x00, 0x02, 0x81, 0x00, 0x02, 0x83, 0x84, 0x84, 0x82, 0x00, 0xC0,
+	0x0E, 0x81, 0x00, 0x02, 0x80, 0x80, 0x87, 0x82, 0x00, 0x00, 0x07, 0xCC, 0x03, 0x04, 0x13, 0x14,
+	0x14, 0x12, 0x0F, 0xC0, 0x30, 0x02, 0x84, 0x04, 0x05, 0xC4, 0x29, 0x84, 0x00, 0x04, 0x82, 0x02,
+	0x01, 0x01, 0x80, 0x82, 0x00, 0x00, 0x80, 0xD0, 0x29, 0x01, 0x03, 0x07, 0xC8, 0x44, 0x01, 0x84,
+	0x82, 0xC4, 0x45, 0x00, 0x84, 0xC4, 0x45, 0x04, 0x01, 0x07, 0x00, 0x07, 0x01, 0xCC, 0x61, 0x00,
+	0x03, 0xCC, 0x4C, 0xC8, 0x29, 0x02, 0x01, 0x02, 0xE4, 0xC8, 0x7F, 0x01, 0x01, 0x7F, 0x89, 0x00,
+	0x07, 0x23, 0x44, 0x44, 0x48, 0x31, 0x00, 0x00, 0x3C, 0x81, 0x4A, 0x00, 0x2C, 0x82, 0x00, 0xC8,
+	0x1B, 0xD0, 0x0D, 0x00, 0x3C, 0x81, 0x42, 0x00, 0x24, 0xC0, 0x30, 0x02, 0x3F, 0x42, 0x42, 0x88,
+	0x00, 0x04, 0x1F, 0x70, 0x0E, 0x70, 0x1F, 0xC0, 0x14, 0x01, 0x02, 0x7E, 0x83, 0x00, 0x81, 0x10,
+	0xC4, 0x35, 0x81, 0x04, 0x00, 0x00, 0xDC, 0x14, 0x96, 0x00, 0x00, 0xFF, 0xC4, 0x7F, 0x04, 0x30,
+	0x08, 0x08, 0x88, 0x70, 0x87, 0x00, 0x00, 0xF8, 0x82, 0x48, 0x0C, 0x00, 0x00, 0xE0, 0x40, 0x20,
+	0x20, 0xC0, 0x00, 0x00, 0x20, 0xF8, 0x20, 0x20, 0x81, 0x00, 0x00, 0xC0, 0x81, 0xA0, 0x00, 0xC0,
+	0xCC, 0x14, 0x00, 0x40, 0x87, 0x00, 0xD0, 0x1B, 0x00, 0xF8, 0xCC, 0x29, 0xD0, 0x22, 0x85, 0x00,
+	0xD0, 0x3E, 0x00, 0x40, 0xCC, 0x14, 0xC0, 0x06, 0xC4, 0x37, 0xD0, 0x06, 0x00, 0xE0, 0xC8, 0x01,
+	0x01, 0x00, 0xC0, 0x81, 0x20, 0x00, 0xC7, 0xC4, 0x7F, 0x02, 0x04, 0x86, 0x85, 0xC9, 0x25, 0x84,
+	0x00, 0x00, 0x87, 0x81, 0x84, 0x00, 0x04, 0xD9, 0x71, 0xD1, 0x86, 0xD1, 0x9B, 0x00, 0x07, 0x8C,
+	0x00, 0xCD, 0xA9, 0x00, 0x87, 0xCC, 0x03, 0xD5, 0xBE, 0x00, 0x80, 0xCD, 0x14, 0x01, 0x02, 0x04,
+	0xD1, 0xD3, 0x01, 0x02, 0x07, 0xC5, 0xE1, 0xC9, 0xB0, 0xD0, 0x06, 0xE1, 0x8D, 0x00, 0x63, 0xC4,
+	0x7F, 0x04, 0x21, 0x40, 0x44, 0x44, 0x3B, 0x87, 0x00, 0x00, 0x7F, 0x81, 0x08, 0xC0, 0x32, 0x04,
+	0x7E, 0x04, 0x02, 0x02, 0x04, 0xD9, 0x78, 0x04, 0x24, 0x4A, 0x4A, 0x52, 0x24, 0xD8, 0x06, 0x85,
+	0x00, 0x00, 0x3F, 0x81, 0x40, 0x00, 0x3F, 0xC5, 0x6A, 0x01, 0x0A, 0x31, 0xDD, 0x14, 0xD1, 0x9B,
+	0x01, 0x3C, 0x42, 0x9D, 0xFF, 0xD0, 0x5A, 0x00, 0xFF, 0xC9, 0x40, 0x02, 0x40, 0x40, 0xF8, 0xCD,
+	0x0F, 0xC1, 0x2B, 0x02, 0x08, 0x08, 0xF8, 0x82, 0x00, 0xC0, 0x0D, 0x01, 0x40, 0xF8, 0xE9, 0x94,
+	0x00, 0xB0, 0x81, 0x00, 0x02, 0xF0, 0x08, 0xF0, 0xC8, 0x05, 0x02, 0x08, 0x08, 0x10, 0xC4, 0x37,
+	0x02, 0xA0, 0x10, 0x08, 0xF5, 0x8D, 0xD0, 0x45, 0xC5, 0xDA, 0x9B, 0xFF, 0xCD, 0xB0, 0x01, 0xC6,
+	0xFF, 0x81, 0x80, 0x00, 0x87, 0xCC, 0x03, 0xC6, 0xB2, 0x00, 0x83, 0x82, 0x80, 0xC4, 0x0F, 0xC4,
+	0x0D, 0x00, 0x82, 0xC8, 0x08, 0x83, 0x80, 0x00, 0x87, 0xCC, 0x1B, 0x00, 0x87, 0x81, 0x81, 0xD0,
+	0x29, 0x00, 0x82, 0xD0, 0x33, 0x88, 0x80, 0xC0, 0x15, 0x00, 0x80, 0xE4, 0x45, 0x9C, 0x87, 0xCC,
+	0x29, 0x00, 0xE2,
+};
+
+static const OLED_Bitmap_t OLED_BENCH_HelpPages[] = {
+	{ OLED_WIDTH, OLED_HEIGHT, OLED_BITMAP_PAGE_MAJOR_RLE, OLED_BENCH_HelpRle, NULL },
+	{ OLED_WIDTH, OLED_HEIGHT, OLED_BITMAP_PAGE_MAJOR_RLE, OLED_BENCH_HelpRle, NULL },
+	{ OLED_WIDTH, OLED_HEIGHT, OLED_BITMAP_PAGE_MAJOR_LZ,  OLED_BENCH_HelpLz,  NULL },
+};
+
+static const char *const OLED_BENCH_UnpackNames[] = {
+	"PackBits DrawBitmap 128x64", "PackBits UnpackBitmap 128x64", "LZ UnpackBitmap 128x64"
+};
+
+/* The same page uncompressed, the baseline every decoder is measured against */
+static uint8_t OLED_BENCH_HelpRaw[OLED_WIDTH * OLED_HEIGHT / 8];
+
+#ifndef OLED_FONTS_SUBSET
+
+/* Text benchmark cases: a line of as many characters as fit, at y */
+typedef struct {
+	const char *Name;
+	OLED_FontDef_t *Font;
+	OLED_FontDef_t *Legacy;     /* Fixed width font with the same glyphs, drawn per pixel */
+	uint16_t Y;
+	uint8_t RowsOnly;           /* Drop the pre-transposed glyphs, Putc() transposes the row data */
+	uint8_t Mode;               /* OLED_TEXT_MODE_t, legacy transparent text skips the background pixels */
+	uint8_t Scale;              /* OLED_SSD1306_SetTextScale(), legacy draws a filled rectangle per pixel */
+} OLED_Bench_TextCase_t;
+
+static const OLED_Bench_TextCase_t OLED_BENCH_TextCases[] = {
+	{ "Putc 7x10 page aligned",     &OLED_Font_7x10,      &OLED_Font_7x10,  0, 0, OLED_TEXT_OPAQUE, 1 },
+	{ "Putc 7x10 at y = 3",         &OLED_Font_7x10,      &OLED_Font_7x10,  3, 0, OLED_TEXT_OPAQUE, 1 },
+	{ "Putc 11x18 page aligned",    &OLED_Font_11x18,     &OLED_Font_11x18, 0, 0, OLED_TEXT_OPAQUE, 1 },
+	{ "Putc 16x26 page aligned",    &OLED_Font_16x26,     &OLED_Font_16x26, 0, 0, OLED_TEXT_OPAQUE, 1 },
+	{ "Putc 7x10 row data only",    &OLED_Font_7x10,      &OLED_Font_7x10,  0, 1, OLED_TEXT_OPAQUE, 1 },
+	{ "Putc 11x18 row data only",   &OLED_Font_11x18,     &OLED_Font_11x18, 0, 1, OLED_TEXT_OPAQUE, 1 },
+	{ "Putc 7x10 proportional",     &OLED_Font_Prop7x10,  &OLED_Font_7x10,  0, 0, OLED_TEXT_OPAQUE, 1 },
+	{ "Putc 11x18 proportional",    &OLED_Font_Prop11x18, &OLED_Font_11x18, 0, 0, OLED_TEXT_OPAQUE, 1 },
+	{ "Putc 7x10 bit-packed",       &OLED_Font_Packed7x10,  &OLED_Font_7x10,  0, 0, OLED_TEXT_OPAQUE, 1 },
+	{ "Putc 11x18 bit-packed RLE",  &OLED_Font_Packed11x18, &OLED_Font_11x18, 0, 0, OLED_TEXT_OPAQUE, 1 },
+	{ "Putc 16x26 bit-packed RLE",  &OLED_Font_Packed16x26, &OLED_Font_16x26, 0, 0, OLED_TEXT_OPAQUE, 1 },
+	{ "Putc 7x10 transparent",      &OLED_Font_7x10,      &OLED_Font_7x10,  0, 0, OLED_TEXT_TRANSPARENT, 1 },
+	{ "Putc 7x10 transparent y = 3", &OLED_Font_7x10,     &OLED_Font_7x10,  3, 0, OLED_TEXT_TRANSPARENT, 1 },
+	{ "Putc 7x10 2x",               &OLED_Font_7x10,      &OLED_Font_7x10,  0, 0, OLED_TEXT_OPAQUE, 2 },
+	{ "Putc 11x18 3x",              &OLED_Font_11x18,     &OLED_Font_11x18, 0, 0, OLED_TEXT_OPAQUE, 3 },
+	{ "Putc 16x26 2x at y = 3",     &OLED_Font_16x26,     &OLED_Font_16x26, 3, 0, OLED_TEXT_OPAQUE, 2 },
+};
+
+static const char OLED_BENCH_Text[] = "Glyphs per second 0123";
+
+
+/* Number formatting cases: sprintf() into a buffer and Puts() against the driver's own formatter */
+typedef enum {
+	OLED_BENCH_FMT_INT,
+	OLED_BENCH_FMT_INT_WIDTH,
+	OLED_BENCH_FMT_FIXED,
+	OLED_BENCH_FMT_FLOAT,
+	OLED_BENCH_FMT_HEX
+} OLED_BENCH_FMT_t;
+
+static const char *const OLED_BENCH_FormatNames[] = {
+	"Int \"%ld\" -1234567", "Int \"%06ld\" 4711", "Fixed \"%ld.%ld\" -23.5", "Fixed \"%.1f\" -23.5", "Hex \"%08lX\""
+};
+
+#endif /* OLED_FONTS_SUBSET */
+
+/******************************************** Measurement helpers ********************************************/
+
+/* Average cycles of one call, alternating colors so every call really changes memory */
+static uint32_t OLED_BENCH_MeasureRect(OLED_Bench_RectFn_t fn, const OLED_Bench_RectCase_t *c)
+{
+	uint32_t i, start;
+	
+	start = DWT->CYCCNT;
+	
+	for (i = 0; i < OLED_BENCH_REPEAT; i++)
+	{
+		fn(c->X, c->Y, c->W, c->H, (i & 1) ? OLED_COLOR_BLACK : OLED_COLOR_WHITE);
+	}
+	
+	return (DWT->CYCCNT - start) / OLED_BENCH_REPEAT;
+}
+
+
+/******************************************** Benchmark APIs *************************************************/
+
+/**
+ * @brief  Enables the DWT cycle counter used for all measurements
+ * @retval None
+ */
+void OLED_BENCH_Init(void)
+{
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+
+/**
+ * @brief  Measures filled rectangles, horizontal and vertical lines
+ * @note   Legacy is one OLED_SSD1306_DrawPixel() per pixel, as the driver drew them before span fills.
+ *         Draws into OLED_Buffer, the screen content is lost. Inspect the results in the debugger
+ * @param  *results: Array of at least OLED_BENCH_MAX_RESULTS entries
+ * @retval Number of results filled in
+ */
+uint8_t OLED_BENCH_RunSpans(OLED_Bench_Result_t* results)
+{
+	uint8_t i;
+	
+	OLED_SSD1306_SetTarget(NULL);
+	
+	for (i = 0; i < sizeof(OLED_BENCH_SpanCases) / sizeof(OLED_BENCH_SpanCases[0]); i++)
+	{
+		results[i].Name = OLED_BENCH_SpanCases[i].Name;
+		results[i].LegacyCycles = OLED_BENCH_MeasureRect(OLED_BENCH_SpanCases[i].Legacy, &OLED_BENCH_SpanCases[i]);
+		results[i].FastCycles = OLED_BENCH_MeasureRect(OLED_BENCH_SpanCases[i].Fast, &OLED_BENCH_SpanCases[i]);
+	}
+	
+	return i;
+}
+
+
+/**
+ * @brief  Measures OLED_SSD1306_DrawGray8() on a full 128x64 frame in every dithering mode
+ * @note   Legacy is the same dithering done per pixel in application code with OLED_SSD1306_DrawPixel().
+ *         Draws into OLED_Buffer, the screen content is lost. Inspect the results in the debugger
+ * @param  *results: Array of at least OLED_BENCH_MAX_RESULTS entries
+ * @retval Number of results filled in
+ */
+uint8_t OLED_BENCH_RunGray8(OLED_Bench_Result_t* results)
+{
+	uint32_t start;
+	uint16_t x, y;
+	uint8_t mode, i;
+	
+	OLED_SSD1306_SetTarget(NULL);
+	
+	for (y = 0; y < OLED_HEIGHT; y++)
+	{
+		for (x = 0; x < OLED_WIDTH; x++)
+		{
+			OLED_BENCH_Gray8[y * OLED_WIDTH + x] = (uint8_t)(x * 2 + ((y & 16) ? (y & 15) : 15 - (y & 15)));
+		}
+	}
+	
+	for (mode = OLED_DITHER_THRESHOLD; mode <= OLED_DITHER_ATKINSON; mode++)
+	{
+		results[mode].Name = OLED_BENCH_DitherNames[mode];
+		
+		start = DWT->CYCCNT;
+		for (i = 0; i < OLED_BENCH_REPEAT; i++)
+		{
+			OLED_BENCH_LegacyGray8(OLED_BENCH_Gray8, (OLED_DITHER_t)mode);
+		}
+		results[mode].LegacyCycles = (DWT->CYCCNT - start) / OLED_BENCH_REPEAT;
+		
+		start = DWT->CYCCNT;
+		for (i = 0; i < OLED_BENCH_REPEAT; i++)
+		{
+			OLED_SSD1306_DrawGray8(0, 0, OLED_WIDTH, OLED_HEIGHT, OLED_BENCH_Gray8, (OLED_DITHER_t)mode);
+		}
+		results[mode].FastCycles = (DWT->CYCCNT - start) / OLED_BENCH_REPEAT;
+	}
+	
+	return mode;
+}
+
+
+/**
+ * @brief  Measures decoding a compressed full screen bitmap into OLED_Buffer
+ * @note   Legacy is drawing the same page uncompressed with OLED_SSD1306_DrawBitmap(), Fast is the decoder.
+ *         Flash sizes are sizeof(OLED_BENCH_HelpRle) and sizeof(OLED_BENCH_HelpLz) against 1024 bytes raw.
+ *         Draws into OLED_Buffer, the screen content is lost. Inspect the results in the debugger
+ * @param  *results: Array of at least OLED_BENCH_MAX_RESULTS entries
+ * @retval Number of results filled in
+ */
+uint8_t OLED_BENCH_RunUnpack(OLED_Bench_Result_t* results)
+{
+	const OLED_Bitmap_t raw = { OLED_WIDTH, OLED_HEIGHT, OLED_BITMAP_PAGE_MAJOR, OLED_BENCH_HelpRaw, NULL };
+	uint32_t start;
+	uint8_t c, i;
+	
+	OLED_SSD1306_SetTarget(NULL);
+	OLED_SSD1306_UnpackBitmap(0, 0, &OLED_BENCH_HelpPages[2]);
+	memcpy(OLED_BENCH_HelpRaw, OLED_Buffer, sizeof(OLED_BENCH_HelpRaw));
+	
+	for (c = 0; c < sizeof(OLED_BENCH_HelpPages) / sizeof(OLED_BENCH_HelpPages[0]); c++)
+	{
+		results[c].Name = OLED_BENCH_UnpackNames[c];
+		
+		start = DWT->CYCCNT;
+		for (i = 0; i < OLED_BENCH_REPEAT; i++)
+		{
+			OLED_SSD1306_DrawBitmap(0, 0, &raw, OLED_ROP_COPY);
+		}
+		results[c].LegacyCycles = (DWT->CYCCNT - start) / OLED_BENCH_REPEAT;
+		
+		start = DWT->CYCCNT;
+		for (i = 0; i < OLED_BENCH_REPEAT; i++)
+		{
+			if (c == 0)
+			{
+				OLED_SSD1306_DrawBitmap(0, 0, &OLED_BENCH_HelpPages[c], OLED_ROP_COPY);
+			}
+			else
+			{
+				OLED_SSD1306_UnpackBitmap(0, 0, &OLED_BENCH_HelpPages[c]);
+			}
+		}
+		results[c].FastCycles = (DWT->CYCCNT - start) / OLED_BENCH_REPEAT;
+	}
+	
+	return c;
+}
+
+
+/**
+ * @brief  Measures text output with OLED_SSD1306_Putc(), a full line per font
+ * @note   Cycles are per character, glyphs per second = SystemCoreClock / cycles. Legacy is the per pixel
+ *         Putc() the driver had before page-major glyphs, colors alternate between lines. Flash taken by
+ *         each font is reported by OLED_FONTS_GetFlashSize().
+ *         Draws into OLED_Buffer, the screen content is lost. Inspect the results in the debugger
+ * @param  *results: Array of at least OLED_BENCH_MAX_RESULTS entries
+ * @retval Number of results filled in, 0 with OLED_FONTS_SUBSET defined
+ */
+uint8_t OLED_BENCH_RunText(OLED_Bench_Result_t* results)
+{
+#ifndef OLED_FONTS_SUBSET
+	const OLED_Bench_TextCase_t *c;
+	OLED_FontDef_t font;
+	OLED_COLOR_t color;
+	uint32_t start;
+	uint16_t n, k;
+	uint8_t t, i;
+	
+	OLED_SSD1306_SetTarget(NULL);
+	OLED_SSD1306_SetRasterOp(OLED_ROP_COPY);
+	
+	for (t = 0; t < sizeof(OLED_BENCH_TextCases) / sizeof(OLED_BENCH_TextCases[0]); t++)
+	{
+		c = &OLED_BENCH_TextCases[t];
+		font = *c->Font;
+		
+		if (c->RowsOnly)
+		{
+			font.glyphs = NULL;
+		}
+		
+		n = OLED_WIDTH / (c->Legacy->FontWidth * c->Scale);
+		
+		if (n > sizeof(OLED_BENCH_Text) - 1)
+		{
+			n = sizeof(OLED_BENCH_Text) - 1;
+		}
+		
+		results[t].Name = c->Name;
+		
+		start = DWT->CYCCNT;
+		for (i = 0; i < OLED_BENCH_REPEAT; i++)
+		{
+			color = (i & 1) ? OLED_COLOR_BLACK : OLED_COLOR_WHITE;
+			
+			for (k = 0; k < n; k++)
+			{
+				OLED_BENCH_LegacyPutc(OLED_BENCH_Text[k], c->Legacy, k * c->Legacy->FontWidth * c->Scale, c->Y, color,
+				                      c->Mode == OLED_TEXT_TRANSPARENT, c->Scale);
+			}
+		}
+		results[t].LegacyCycles = (DWT->CYCCNT - start) / (OLED_BENCH_REPEAT * n);
+		
+		OLED_SSD1306_SetTextMode((OLED_TEXT_MODE_t)c->Mode);
+		OLED_SSD1306_SetTextScale(c->Scale);
+		start = DWT->CYCCNT;
+		for (i = 0; i < OLED_BENCH_REPEAT; i++)
+		{
+			color = (i & 1) ? OLED_COLOR_BLACK : OLED_COLOR_WHITE;
+			OLED_SSD1306_GotoXY(0, c->Y);
+			
+			for (k = 0; k < n; k++)
+			{
+				OLED_SSD1306_Putc(OLED_BENCH_Text[k], &font, color);
+			}
+		}
+		results[t].FastCycles = (DWT->CYCCNT - start) / (OLED_BENCH_REPEAT * n);
+		OLED_SSD1306_SetTextMode(OLED_TEXT_OPAQUE);
+		OLED_SSD1306_SetTextScale(1);
+	}
+	
+	return t;
+#else
+	(void)results;
+	return 0;
+#endif
+}
+
+
+/**
+ * @brief  Measures numbers drawn with OLED_SSD1306_PutInt(), PutFixed() and PutHex() in 7x10
+ * @note   Legacy is sprintf() into a buffer followed by OLED_SSD1306_Puts(), Fast is the driver's formatter, both
+ *         writing the same characters. The "%.1f" case is the float formatting PutFixed() replaces.
+ *         Flash is not measured here: compare the Code and RO-data totals of the build output with and without
+ *         a call to this function, which is the only user of sprintf() in the project.
+ *         Draws into OLED_Buffer, the screen content is lost. Inspect the results in the debugger
+ * @param  *results: Array of at least OLED_BENCH_MAX_RESULTS entries
+ * @retval Number of results filled in, 0 with OLED_FONTS_SUBSET defined
+ */
+uint8_t OLED_BENCH_RunFormat(OLED_Bench_Result_t* results)
+{
+#ifndef OLED_FONTS_SUBSET
+	char buf[16];
+	uint32_t start;
+	uint8_t c, i;
+	
+	OLED_SSD1306_SetTarget(NULL);
+	OLED_SSD1306_SetRasterOp(OLED_ROP_COPY);
+	
+	for (c = OLED_BENCH_FMT_INT; c <= OLED_BENCH_FMT_HEX; c++)
+	{
+		results[c].Name = OLED_BENCH_FormatNames[c];
+		
+		start = DWT->CYCCNT;
+		for (i = 0; i < OLED_BENCH_REPEAT; i++)
+		{
+			switch (c)
+			{
+				case OLED_BENCH_FMT_INT:       sprintf(buf, "%ld", -1234567L); break;
+				case OLED_BENCH_FMT_INT_WIDTH: sprintf(buf, "%06ld", 4711L); break;
+				case OLED_BENCH_FMT_FIXED:     sprintf(buf, "-%ld.%ld", 23L, 5L); break;
+				case OLED_BENCH_FMT_FLOAT:     sprintf(buf, "%.1f", -23.5); break;
+				default:                       sprintf(buf, "%08lX", 0xBEEFUL); break;
+			}
+			
+			OLED_SSD1306_GotoXY(0, 0);
+			OLED_SSD1306_Puts(buf, &OLED_Font_7x10, OLED_COLOR_WHITE);
+		}
+		results[c].LegacyCycles = (DWT->CYCCNT - start) / OLED_BENCH_REPEAT;
+		
+		start = DWT->CYCCNT;
+		for (i = 0; i < OLED_BENCH_REPEAT; i++)
+		{
+			OLED_SSD1306_GotoXY(0, 0);
+			
+			switch (c)
+			{
+				case OLED_BENCH_FMT_INT:       OLED_SSD1306_PutInt(-1234567, 0, OLED_NUM_DEFAULT, &OLED_Font_7x10, OLED_COLOR_WHITE); break;
+				case OLED_BENCH_FMT_INT_WIDTH: OLED_SSD1306_PutInt(4711, 6, OLED_NUM_ZERO_PAD, &OLED_Font_7x10, OLED_COLOR_WHITE); break;
+				case OLED_BENCH_FMT_FIXED:
+				case OLED_BENCH_FMT_FLOAT:     OLED_SSD1306_PutFixed(-235, 1, 0, OLED_NUM_DEFAULT, &OLED_Font_7x10, OLED_COLOR_WHITE); break;
+				default:                       OLED_SSD1306_PutHex(0xBEEF, 8, OLED_NUM_ZERO_PAD, &OLED_Font_7x10, OLED_COLOR_WHITE); break;
+			}
+		}
+		results[c].FastCycles = (DWT->CYCCNT - start) / OLED_BENCH_REPEAT;
+	}
+	
+	return c;
+#else
+	(void)results;
+	return 0;
+#endif
+}
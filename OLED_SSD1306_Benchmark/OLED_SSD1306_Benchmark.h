@@ -0,0 +1,92 @@
+/**
+  **********************************************************************************************************************
+   * @file   : OLED_SSD1306_Benchmark.h
+   * @author : Sharath N
+   * @brief  : Cycle count benchmarks for the SSD1306 OLED Driver drawing paths
+  **********************************************************************************************************************
+*/
+
+#ifndef OLED_SSD1306_BENCHMARK_H
+#define OLED_SSD1306_BENCHMARK_H
+
+#include <stdint.h>
+#include "STM32F407_OLED_SSD1306_Driver.h"
+
+/* Maximum number of results a single benchmark run fills in */
+#define OLED_BENCH_MAX_RESULTS       16
+
+/**
+ * @brief  One benchmark case, a legacy baseline against the current path
+ * @note   Each OLED_BENCH_Run...() names its baseline, e.g. per pixel drawing or an uncompressed bitmap
+ */
+typedef struct {
+	const char *Name;           /*!< What was measured */
+	uint32_t LegacyCycles;      /*!< CPU cycles taken by the baseline of this benchmark */
+	uint32_t FastCycles;        /*!< CPU cycles taken by the current driver implementation */
+} OLED_Bench_Result_t;
+
+
+/**
+ * @brief  Enables the DWT cycle counter used for all measurements
+ * @retval None
+ */
+void OLED_BENCH_Init(void);
+
+
+/**
+ * @brief  Measures filled rectangles, horizontal and vertical lines
+ * @note   Legacy is one OLED_SSD1306_DrawPixel() per pixel, as the driver drew them before span fills.
+ *         Draws into OLED_Buffer, the screen content is lost. Inspect the results in the debugger
+ * @param  *results: Array of at least OLED_BENCH_MAX_RESULTS entries
+ * @retval Number of results filled in
+ */
+uint8_t OLED_BENCH_RunSpans(OLED_Bench_Result_t* results);
+
+
+/**
+ * @brief  Measures OLED_SSD1306_DrawGray8() on a full 128x64 frame in every dithering mode
+ * @note   Legacy is the same dithering done per pixel in application code with OLED_SSD1306_DrawPixel().
+ *         Draws into OLED_Buffer, the screen content is lost. Inspect the results in the debugger
+ * @param  *results: Array of at least OLED_BENCH_MAX_RESULTS entries
+ * @retval Number of results filled in
+ */
+uint8_t OLED_BENCH_RunGray8(OLED_Bench_Result_t* results);
+
+
+/**
+ * @brief  Measures decoding a compressed full screen bitmap into OLED_Buffer
+ * @note   Legacy is drawing the same page uncompressed with OLED_SSD1306_DrawBitmap(), Fast is the decoder.
+ *         Flash sizes are sizeof(OLED_BENCH_HelpRle) and sizeof(OLED_BENCH_HelpLz) against 1024 bytes raw.
+ *         Draws into OLED_Buffer, the screen content is lost. Inspect the results in the debugger
+ * @param  *results: Array of at least OLED_BENCH_MAX_RESULTS entries
+ * @retval Number of results filled in
+ */
+uint8_t OLED_BENCH_RunUnpack(OLED_Bench_Result_t* results);
+
+
+/**
+ * @brief  Measures text output with OLED_SSD1306_Putc(), a full line per font
+ * @note   Cycles are per character, glyphs per second = SystemCoreClock / cycles. Legacy is the per pixel
+ *         Putc() the driver had before page-major glyphs, colors alternate between lines. Flash taken by
+ *         each font is reported by OLED_FONTS_GetFlashSize().
+ *         Draws into OLED_Buffer, the screen content is lost. Inspect the results in the debugger
+ * @param  *results: Array of at least OLED_BENCH_MAX_RESULTS entries
+ * @retval Number of results filled in, 0 with OLED_FONTS_SUBSET defined
+ */
+uint8_t OLED_BENCH_RunText(OLED_Bench_Result_t* results);
+
+
+
+/**
+ * @brief  Measures numbers drawn with OLED_SSD1306_PutInt(), PutFixed() and PutHex() in 7x10
+ * @note   Legacy is sprintf() into a buffer followed by OLED_SSD1306_Puts(), Fast is the driver's formatter, both
+ *         writing the same characters. The "%.1f" case is the float formatting PutFixed() replaces.
+ *         Flash is not measured here: compare the Code and RO-data totals of the build output with and without
+ *         a call to this function, which is the only user of sprintf() in the project.
+ *         Draws into OLED_Buffer, the screen content is lost. Inspect the results in the debugger
+ * @param  *results: Array of at least OLED_BENCH_MAX_RESULTS entries
+ * @retval Number of results filled in, 0 with OLED_FONTS_SUBSET defined
+ */
+uint8_t OLED_BENCH_RunFormat(OLED_Bench_Result_t* results);
+
+#endif
@@ -0,0 +1,434 @@
+/**
+  **********************************************************************************************************************
+   * @file   : OLED_SSD1306_Console.c
+   * @author : Sharath N
+   * @brief  : Scrolling text console for the SSD1306 OLED Driver
+  **********************************************************************************************************************
+*/
+
+#include "OLED_SSD1306_Console.h"
+
+
+#define OLED_CONSOLE_PAGES           (OLED_HEIGHT / 8)
+#define OLED_CONSOLE_CELL_SIZE       64    /* Bytes of one rendered character, fonts up to 16 x 32 pixels */
+
+/* Private console state */
+typedef struct {
+	OLED_FontDef_t *Font;
+	uint8_t Cols;                              /* Characters per line */
+	uint8_t Rows;                              /* Whole lines on the screen */
+	uint8_t Col;                               /* Cursor column, Cols once the line is full */
+	uint32_t Line;                             /* Cursor line, counted from 0 since the last clear */
+	uint16_t Back;                             /* Lines scrolled back by OLED_CONSOLE_View() */
+	uint8_t Start;                             /* Display start line of what OLED_Buffer shows */
+	uint8_t Shown;                             /* Display start line on the panel, 0xFF when unknown */
+	uint8_t DirtyX0[OLED_CONSOLE_PAGES];       /* Changed columns per page, X0 > X1 when clean */
+	uint8_t DirtyX1[OLED_CONSOLE_PAGES];
+	uint8_t Length[OLED_CONSOLE_HISTORY];      /* Characters in each kept line */
+	char Text[OLED_CONSOLE_HISTORY][OLED_CONSOLE_MAX_COLS];
+	OLED_Console_Stats_t Stats;
+} OLED_Console_t;
+
+/* Private Variables */
+static OLED_Console_t OLED_CONSOLE;
+static uint8_t OLED_CONSOLE_CellPixels[OLED_CONSOLE_CELL_SIZE];
+
+
+/* First display RAM row of a line */
+static uint8_t OLED_CONSOLE_Row(uint32_t line)
+{
+	return (uint8_t)(((line % OLED_HEIGHT) * OLED_CONSOLE.Font->FontHeight) % OLED_HEIGHT);
+}
+
+
+/* Display start line that puts a line at the bottom of the screen, 0 while the first screen is not full */
+static uint8_t OLED_CONSOLE_StartLine(uint32_t line)
+{
+	return (line + 1 > OLED_CONSOLE.Rows) ? OLED_CONSOLE_Row(line + 1) : 0;
+}
+
+
+static void OLED_CONSOLE_Clean(void)
+{
+	memset(OLED_CONSOLE.DirtyX0, 0xFF, sizeof(OLED_CONSOLE.DirtyX0));
+	memset(OLED_CONSOLE.DirtyX1, 0x00, sizeof(OLED_CONSOLE.DirtyX1));
+}
+
+
+/* Marks columns x0..x1 of the pages a line's rows fall into */
+static void OLED_CONSOLE_Mark(uint8_t x0, uint8_t x1, uint8_t row)
+{
+	uint8_t i, p;
+	
+	for (i = 0; i < OLED_CONSOLE.Font->FontHeight; i += 8 - ((row + i) & 7))
+	{
+		p = ((row + i) % OLED_HEIGHT) / 8;
+		
+		if (x0 < OLED_CONSOLE.DirtyX0[p])
+		{
+			OLED_CONSOLE.DirtyX0[p] = x0;
+		}
+		
+		if (x1 > OLED_CONSOLE.DirtyX1[p])
+		{
+			OLED_CONSOLE.DirtyX1[p] = x1;
+		}
+	}
+}
+
+
+/**
+ * @brief  Stores one column of a line, FontHeight bits with the top row in the LSB
+ * @note   The column is rotated into the 64 rows of display RAM, so a line that wraps from the last page
+ *         to the first is written in the same pass
+ */
+static void OLED_CONSOLE_PutColumn(uint8_t x, uint8_t row, uint32_t bits)
+{
+	uint32_t m = (OLED_CONSOLE.Font->FontHeight < 32) ? (1UL << OLED_CONSOLE.Font->FontHeight) - 1 : 0xFFFFFFFF;
+	uint64_t b = bits & m, mask = m;
+	uint8_t *dst = &OLED_Buffer[x];
+	uint8_t p, keep;
+	
+	if (row != 0)
+	{
+		b = (b << row) | (b >> (OLED_HEIGHT - row));
+		mask = (mask << row) | (mask >> (OLED_HEIGHT - row));
+	}
+	
+	for (p = 0; p < OLED_CONSOLE_PAGES; p++, dst += OLED_WIDTH, b >>= 8, mask >>= 8)
+	{
+		keep = (uint8_t)~mask;
+		
+		if (keep != 0xFF)
+		{
+			*dst = (*dst & keep) | ((uint8_t)b & (uint8_t)mask);
+		}
+	}
+}
+
+
+/* Renders a character into the cell of line and col */
+static void OLED_CONSOLE_DrawCell(uint32_t line, uint8_t col, char ch)
+{
+	OLED_FontDef_t *font = OLED_CONSOLE.Font;
+	OLED_Canvas_t cell, *target = OLED_SSD1306_GetTarget();
+	OLED_ROP_t rop = OLED_SSD1306_GetRasterOp();
+	OLED_TEXT_MODE_t mode = OLED_SSD1306_GetTextMode();
+	uint8_t scale = OLED_SSD1306_GetTextScale();
+	uint8_t row = OLED_CONSOLE_Row(line), x = col * font->FontWidth, i, p;
+	uint32_t bits;
+	
+	/* The driver draws the glyph into a cleared cell, whatever the font's format */
+	OLED_SSD1306_CanvasInit(&cell, OLED_CONSOLE_CellPixels, font->FontWidth, font->FontHeight);
+	OLED_SSD1306_SetTarget(&cell);
+	OLED_SSD1306_SetRasterOp(OLED_ROP_COPY);
+	OLED_SSD1306_SetTextMode(OLED_TEXT_OPAQUE);
+	OLED_SSD1306_SetTextScale(1);
+	OLED_SSD1306_GotoXY(0, 0);
+	OLED_SSD1306_Putc(ch, font, OLED_COLOR_WHITE);
+	OLED_SSD1306_SetTarget(target);
+	OLED_SSD1306_SetRasterOp(rop);
+	OLED_SSD1306_SetTextMode(mode);
+	OLED_SSD1306_SetTextScale(scale);
+	
+	for (i = 0; i < font->FontWidth; i++)
+	{
+		for (p = 0, bits = 0; p * 8 < font->FontHeight; p++)
+		{
+			bits |= (uint32_t)OLED_CONSOLE_CellPixels[i + p * font->FontWidth] << (p * 8);
+		}
+		
+		OLED_CONSOLE_PutColumn(x + i, row, bits);
+	}
+	
+	OLED_CONSOLE_Mark(x, x + font->FontWidth - 1, row);
+}
+
+
+/* Clears the rows of a line, including those it shares with the line partly shown above the screen */
+static void OLED_CONSOLE_ClearLine(uint32_t line)
+{
+	uint8_t x, row = OLED_CONSOLE_Row(line);
+	
+	for (x = 0; x < OLED_WIDTH; x++)
+	{
+		OLED_CONSOLE_PutColumn(x, row, 0);
+	}
+	
+	OLED_CONSOLE_Mark(0, OLED_WIDTH - 1, row);
+}
+
+
+/* Starts the next line and scrolls it to the bottom of the screen */
+static void OLED_CONSOLE_NewLine(void)
+{
+	OLED_CONSOLE.Line++;
+	OLED_CONSOLE.Col = 0;
+	OLED_CONSOLE.Length[OLED_CONSOLE.Line % OLED_CONSOLE_HISTORY] = 0;
+	OLED_CONSOLE.Stats.Lines++;
+	
+	OLED_CONSOLE_ClearLine(OLED_CONSOLE.Line);
+	OLED_CONSOLE.Start = OLED_CONSOLE_StartLine(OLED_CONSOLE.Line);
+}
+
+
+/* Writes a printable character at the cursor, wrapping first if the line is full */
+static void OLED_CONSOLE_PutChar(char ch)
+{
+	uint16_t k;
+	
+	if (OLED_CONSOLE.Col >= OLED_CONSOLE.Cols)
+	{
+		OLED_CONSOLE_NewLine();
+	}
+	
+	k = OLED_CONSOLE.Line % OLED_CONSOLE_HISTORY;
+	OLED_CONSOLE.Text[k][OLED_CONSOLE.Col] = ch;
+	
+	if (OLED_CONSOLE.Col >= OLED_CONSOLE.Length[k])
+	{
+		OLED_CONSOLE.Length[k] = OLED_CONSOLE.Col + 1;
+	}
+	
+	OLED_CONSOLE_DrawCell(OLED_CONSOLE.Line, OLED_CONSOLE.Col, ch);
+	OLED_CONSOLE.Col++;
+}
+
+
+/**
+ * @brief  Clears the screen and starts the console at its top left corner
+ * @note   The console draws into OLED_Buffer with the driver's text functions in panel coordinates, the
+ *         rotation must be OLED_ROTATION_0 or OLED_ROTATION_180 and the clip rectangle the whole screen.
+ *         Do not draw anything else on the screen while it is in use
+ * @param  *Font: Pointer to @ref OLED_FontDef_t structure with used font, at most 16 x 32 pixels.
+ *         Every character takes FontWidth columns
+ * @retval 1 on success, 0 if the font is too large or the screen is rotated by 90 or 270 degrees
+ */
+uint8_t OLED_CONSOLE_Init(OLED_FontDef_t* Font)
+{
+	if (Font->FontWidth == 0 || Font->FontWidth > 16 || Font->FontHeight == 0 || Font->FontHeight > 32 ||
+	    OLED_SSD1306_GetWidth() != OLED_WIDTH)
+	{
+		return 0;
+	}
+	
+	memset(&OLED_CONSOLE, 0, sizeof(OLED_CONSOLE));
+	
+	OLED_CONSOLE.Font = Font;
+	OLED_CONSOLE.Cols = (OLED_WIDTH / Font->FontWidth < OLED_CONSOLE_MAX_COLS) ? OLED_WIDTH / Font->FontWidth : OLED_CONSOLE_MAX_COLS;
+	OLED_CONSOLE.Rows = OLED_HEIGHT / Font->FontHeight;
+	
+	OLED_CONSOLE_Clear();
+	
+	return 1;
+}
+
+
+/**
+ * @brief  Writes a character at the cursor
+ * @note   '\n' starts a new line, '\r' goes back to its start, '\t' moves to the next tab stop. A character
+ *         after the last column wraps to a new line, other control characters are ignored.
+ *         Only OLED_Buffer is changed, call @ref OLED_CONSOLE_Flush() to show it
+ * @param  ch: Character to be written, bytes from 0x80 are taken as Latin-1 like @ref OLED_SSD1306_Putc()
+ * @retval None
+ */
+void OLED_CONSOLE_Putc(char ch)
+{
+	if (OLED_CONSOLE.Font == NULL)
+	{
+		return;
+	}
+	
+	if (OLED_CONSOLE.Back != 0)
+	{
+		OLED_CONSOLE_View(0);
+	}
+	
+	switch (ch)
+	{
+		case '\n':
+			OLED_CONSOLE_NewLine();
+			break;
+		
+		case '\r':
+			OLED_CONSOLE.Col = 0;
+			break;
+		
+		case '\t':
+			/* Spaces, so the cells are cleared like any other character */
+			do
+			{
+				OLED_CONSOLE_PutChar(' ');
+			}
+			while (OLED_CONSOLE.Col % OLED_CONSOLE_TAB != 0 && OLED_CONSOLE.Col < OLED_CONSOLE.Cols);
+			break;
+		
+		default:
+			if ((uint8_t)ch >= ' ')
+			{
+				OLED_CONSOLE_PutChar(ch);
+			}
+			break;
+	}
+}
+
+
+/**
+ * @brief  Writes a string with @ref OLED_CONSOLE_Putc() and shows it with @ref OLED_CONSOLE_Flush()
+ * @param  *str: String to be written
+ * @retval None
+ */
+void OLED_CONSOLE_Puts(const char* str)
+{
+	while (*str)
+	{
+		OLED_CONSOLE_Putc(*str++);
+	}
+	
+	OLED_CONSOLE_Flush();
+}
+
+
+/**
+ * @brief  Sends what changed since the last flush, then scrolls the panel to the newest line
+ * @note   The start line is moved after the new line's rows are on the panel, so it never shows stale rows.
+ *         Transfers are interrupt driven, the function returns while the last one is still running
+ * @retval None
+ */
+void OLED_CONSOLE_Flush(void)
+{
+	uint8_t p;
+	uint16_t len;
+	
+	if (OLED_CONSOLE.Font == NULL)
+	{
+		return;
+	}
+	
+	/* One window per page, each straight out of OLED_Buffer. SetWindow() waits for the transfer before */
+	for (p = 0; p < OLED_CONSOLE_PAGES; p++)
+	{
+		if (OLED_CONSOLE.DirtyX0[p] > OLED_CONSOLE.DirtyX1[p])
+		{
+			continue;
+		}
+		
+		len = OLED_CONSOLE.DirtyX1[p] - OLED_CONSOLE.DirtyX0[p] + 1;
+		OLED_SSD1306_SetWindow(OLED_CONSOLE.DirtyX0[p], OLED_CONSOLE.DirtyX1[p], p, p);
+		
+		if (OLED_SSD1306_Send_DataAsync(&OLED_Buffer[OLED_CONSOLE.DirtyX0[p] + p * OLED_WIDTH], len, NULL))
+		{
+			OLED_CONSOLE.Stats.Flushes++;
+			OLED_CONSOLE.Stats.Bytes += len;
+		}
+		else
+		{
+			OLED_CONSOLE.Stats.Errors++;
+		}
+	}
+	
+	OLED_CONSOLE_Clean();
+	
+	if (OLED_CONSOLE.Start != OLED_CONSOLE.Shown)
+	{
+		/* Blocking, so it goes out after the data */
+		OLED_SSD1306_Send_Command(OLED_DISP_START_LINE_ADDR | OLED_CONSOLE.Start);
+		OLED_CONSOLE.Shown = OLED_CONSOLE.Start;
+		OLED_CONSOLE.Stats.Scrolls++;
+	}
+}
+
+
+/**
+ * @brief  Shows older lines, or the newest ones again
+ * @note   Looking back redraws and sends the whole screen. Writing anything returns to the newest lines first
+ * @param  back: Number of lines to scroll back, 0 for the newest lines
+ * @retval Lines actually scrolled back, limited by OLED_CONSOLE_HISTORY and the lines written so far
+ */
+uint16_t OLED_CONSOLE_View(uint16_t back)
+{
+	uint32_t last, line;
+	uint16_t max;
+	uint8_t col, k;
+	
+	if (OLED_CONSOLE.Font == NULL)
+	{
+		return 0;
+	}
+	
+	/* The line partly shown at the top must still be kept too */
+	max = (OLED_CONSOLE_HISTORY > OLED_CONSOLE.Rows + 1) ? OLED_CONSOLE_HISTORY - OLED_CONSOLE.Rows - 1 : 0;
+	max = (OLED_CONSOLE.Line < max) ? (uint16_t)OLED_CONSOLE.Line : max;
+	back = (back < max) ? back : max;
+	
+	if (back == OLED_CONSOLE.Back)
+	{
+		return back;
+	}
+	
+	/* Every line that shows, oldest first so the newest one keeps the rows they share */
+	last = OLED_CONSOLE.Line - back;
+	memset(OLED_Buffer, 0x00, sizeof(OLED_Buffer));
+	
+	for (line = (last > OLED_CONSOLE.Rows) ? last - OLED_CONSOLE.Rows : 0; line <= last; line++)
+	{
+		if (OLED_CONSOLE.Line - line >= OLED_CONSOLE_HISTORY)
+		{
+			continue;
+		}
+		
+		k = line % OLED_CONSOLE_HISTORY;
+		OLED_CONSOLE_ClearLine(line);
+		
+		for (col = 0; col < OLED_CONSOLE.Length[k]; col++)
+		{
+			OLED_CONSOLE_DrawCell(line, col, OLED_CONSOLE.Text[k][col]);
+		}
+	}
+	
+	memset(OLED_CONSOLE.DirtyX0, 0x00, sizeof(OLED_CONSOLE.DirtyX0));
+	memset(OLED_CONSOLE.DirtyX1, OLED_WIDTH - 1, sizeof(OLED_CONSOLE.DirtyX1));
+	
+	OLED_CONSOLE.Back = back;
+	OLED_CONSOLE.Start = OLED_CONSOLE_StartLine(last);
+	OLED_CONSOLE_Flush();
+	
+	return back;
+}
+
+
+/**
+ * @brief  Clears the screen and the kept lines, the cursor goes to the top left corner
+ * @retval None
+ */
+void OLED_CONSOLE_Clear(void)
+{
+	if (OLED_CONSOLE.Font == NULL)
+	{
+		return;
+	}
+	
+	OLED_CONSOLE.Col = 0;
+	OLED_CONSOLE.Line = 0;
+	OLED_CONSOLE.Back = 0;
+	OLED_CONSOLE.Start = 0;
+	OLED_CONSOLE.Shown = 0xFF;
+	memset(OLED_CONSOLE.Length, 0, sizeof(OLED_CONSOLE.Length));
+	
+	memset(OLED_Buffer, 0x00, sizeof(OLED_Buffer));
+	memset(OLED_CONSOLE.DirtyX0, 0x00, sizeof(OLED_CONSOLE.DirtyX0));
+	memset(OLED_CONSOLE.DirtyX1, OLED_WIDTH - 1, sizeof(OLED_CONSOLE.DirtyX1));
+	
+	OLED_CONSOLE_Flush();
+}
+
+
+/**
+ * @brief  Returns the figures gathered since @ref OLED_CONSOLE_Init()
+ * @param  *stats: Filled in with the current figures
+ * @retval None
+ */
+void OLED_CONSOLE_GetStats(OLED_Console_Stats_t* stats)
+{
+	*stats = OLED_CONSOLE.Stats;
+}
@@ -0,0 +1,111 @@
+/**
+  **********************************************************************************************************************
+   * @file   : OLED_SSD1306_Console.h
+   * @author : Sharath N
+   * @brief  : Scrolling text console for the SSD1306 OLED Driver
+  **********************************************************************************************************************
+*/
+
+/*
+          The console owns the whole panel and treats the 64 rows of display RAM as a ring. Text line n lives
+          at rows n * FontHeight (mod 64), so scrolling by a line only moves the controller's display start
+          line (command 0x40 | line) to the row after the newest line. Nothing already on the panel is redrawn
+          or sent again: a new line clears its own rows in OLED_Buffer and the flush sends the columns that
+          changed in the pages those rows touch, usually two pages of 128 bytes, instead of the 1 KB frame.
+
+          Lines of a FontHeight that does not divide 64 leave a few rows of the line above the screen at the
+          top, the way a terminal shows a line that is half scrolled out.
+
+          The text of the last OLED_CONSOLE_HISTORY lines is kept, OLED_CONSOLE_View() redraws the screen from
+          it to look back at lines that scrolled out. All memory is static, nothing depends on the amount of
+          text written.
+*/
+
+#ifndef OLED_SSD1306_CONSOLE_H
+#define OLED_SSD1306_CONSOLE_H
+
+#include <stdint.h>
+#include "STM32F407_OLED_SSD1306_Driver.h"
+
+#define OLED_CONSOLE_HISTORY         16    // Lines of text kept for OLED_CONSOLE_View(), including those on screen
+#define OLED_CONSOLE_MAX_COLS        21    // Characters per line at most, OLED_WIDTH / 6
+#define OLED_CONSOLE_TAB             4     // Columns between tab stops
+
+
+/**
+ * @brief  Console figures, for checking how much goes over the bus
+ */
+typedef struct {
+	uint32_t Lines;       /*!< New lines started, by '\n' or by wrapping */
+	uint32_t Scrolls;     /*!< Display start line changes */
+	uint32_t Flushes;     /*!< Windows sent to the panel */
+	uint32_t Bytes;       /*!< Display data bytes sent */
+	uint32_t Errors;      /*!< Windows that could not be sent */
+} OLED_Console_Stats_t;
+
+
+/**
+ * @brief  Clears the screen and starts the console at its top left corner
+ * @note   The console draws into OLED_Buffer with the driver's text functions in panel coordinates, the
+ *         rotation must be OLED_ROTATION_0 or OLED_ROTATION_180 and the clip rectangle the whole screen.
+ *         Do not draw anything else on the screen while it is in use
+ * @param  *Font: Pointer to @ref OLED_FontDef_t structure with used font, at most 16 x 32 pixels.
+ *         Every character takes FontWidth columns
+ * @retval 1 on success, 0 if the font is too large or the screen is rotated by 90 or 270 degrees
+ */
+uint8_t OLED_CONSOLE_Init(OLED_FontDef_t* Font);
+
+
+/**
+ * @brief  Writes a character at the cursor
+ * @note   '\n' starts a new line, '\r' goes back to its start, '\t' moves to the next tab stop. A character
+ *         after the last column wraps to a new line, other control characters are ignored.
+ *         Only OLED_Buffer is changed, call @ref OLED_CONSOLE_Flush() to show it
+ * @param  ch: Character to be written, bytes from 0x80 are taken as Latin-1 like @ref OLED_SSD1306_Putc()
+ * @retval None
+ */
+void OLED_CONSOLE_Putc(char ch);
+
+
+/**
+ * @brief  Writes a string with @ref OLED_CONSOLE_Putc() and shows it with @ref OLED_CONSOLE_Flush()
+ * @param  *str: String to be written
+ * @retval None
+ */
+void OLED_CONSOLE_Puts(const char* str);
+
+
+/**
+ * @brief  Sends what changed since the last flush, then scrolls the panel to the newest line
+ * @note   The start line is moved after the new line's rows are on the panel, so it never shows stale rows.
+ *         Transfers are interrupt driven, the function returns while the last one is still running
+ * @retval None
+ */
+void OLED_CONSOLE_Flush(void);
+
+
+/**
+ * @brief  Shows older lines, or the newest ones again
+ * @note   Looking back redraws and sends the whole screen. Writing anything returns to the newest lines first
+ * @param  back: Number of lines to scroll back, 0 for the newest lines
+ * @retval Lines actually scrolled back, limited by OLED_CONSOLE_HISTORY and the lines written so far
+ */
+uint16_t OLED_CONSOLE_View(uint16_t back);
+
+
+/**
+ * @brief  Clears the screen and the kept lines, the cursor goes to the top left corner
+ * @retval None
+ */
+void OLED_CONSOLE_Clear(void);
+
+
+/**
+ * @brief  Returns the figures gathered since @ref OLED_CONSOLE_Init()
+ * @param  *stats: Filled in with the current figures
+ * @retval None
+ */
+void OLED_CONSOLE_GetStats(OLED_Console_Stats_t* stats);
+
+
+#endif
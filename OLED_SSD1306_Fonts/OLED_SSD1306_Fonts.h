@@ -12,13 +12,99 @@
 #include <string.h>
 #include <stdint.h>
 
+#define OLED_FONTS_CHARS             95    // Characters ' ' to '~', the first glyphs of every font table
+#define OLED_FONTS_INVALID           0xFFFD // Codepoint returned for malformed UTF-8
+
+/* Define OLED_FONTS_SUBSET for the whole project to replace the fonts below with the subsets written by
+   Tools/OLED_FontSubset: only the glyphs the firmware draws, fonts it does not use are left out */
+
+/**
+ * @brief  Placement of one glyph of a proportional font
+ */
+typedef struct {
+	uint16_t Start;       /*!< First byte of the glyph in @ref OLED_FontMetrics_t Bitmap */
+	uint8_t Width;        /*!< Bounding box width in pixels, 0 for glyphs without ink (space) */
+	uint8_t Height;       /*!< Bounding box height in pixels */
+	int8_t OffsetX;       /*!< Left bearing: bounding box left edge relative to the pen position */
+	int8_t OffsetY;       /*!< Bounding box top relative to the top of the line */
+	uint8_t Advance;      /*!< Pen movement to the next character */
+} OLED_FontGlyph_t;
+
+
+/**
+ * @brief  Kerning pair of a proportional font
+ */
+typedef struct {
+	uint8_t Left;         /*!< First character of the pair */
+	uint8_t Right;        /*!< Character that follows it */
+	int8_t Adjust;        /*!< Added to the advance of Left, negative moves Right closer */
+} OLED_FontKern_t;
+
+
+/**
+ * @brief  Per-glyph metrics turning a font into a proportional one
+ */
+typedef struct {
+	const OLED_FontGlyph_t *Glyphs;   /*!< One entry per character from ' ' */
+	const uint8_t *Bitmap;            /*!< Glyphs cropped to their bounding box, page-major: Width column bytes
+	                                       per page, (Height + 7) / 8 pages */
+	const OLED_FontKern_t *Kerning;   /*!< Pairs sorted by Left, then Right. NULL if the font has none */
+	uint16_t KerningCount;            /*!< Number of pairs in Kerning */
+} OLED_FontMetrics_t;
+
+
+/**
+ * @brief  Bit-packed glyphs, decoded while drawing
+ * @note   A glyph is stored column by column, FontHeight bits per column with the top row in the lowest bit.
+ *         Run-length coded glyphs are 4 bit counts of alternating clear and set pixels in the same order,
+ *         starting with clear, low nibble first. A count of 15 followed by 0 continues the run
+ */
+typedef struct {
+	const uint16_t *Offsets;  /*!< First byte of each character from ' ' in Bits, bit 15 set if the glyph is
+	                               run-length coded, one more entry ends the last glyph. NULL if every glyph is
+	                               exactly FontWidth x FontHeight bits, back to back without padding */
+	const uint8_t *Bits;      /*!< Glyph data */
+} OLED_FontPacked_t;
+
+
+/**
+ * @brief  Codepoints drawn with consecutive glyphs of a font
+ */
+typedef struct {
+	uint16_t First;       /*!< First codepoint of the range */
+	uint16_t Last;        /*!< Last codepoint of the range */
+	uint16_t Index;       /*!< Glyph of First in the font's tables, ranges may share glyphs */
+} OLED_FontRange_t;
+
+
+/**
+ * @brief  Characters of a font beyond ' ' to '~', or the glyphs kept by a subset font
+ */
+typedef struct {
+	const OLED_FontRange_t *Ranges;  /*!< Sorted by First, not overlapping. The first one is ' ' to '~' at glyph 0 */
+	uint16_t RangeCount;             /*!< Number of ranges */
+	uint16_t GlyphCount;             /*!< Number of glyphs in the font's tables */
+	uint16_t Fallback;               /*!< Glyph drawn for codepoints the font does not have */
+	const uint8_t *Map;              /*!< Subset fonts (Tools/OLED_FontSubset): glyph of each character ' ' to '~',
+	                                      Fallback for the ones left out. NULL when they are glyphs 0 to 94 */
+} OLED_FontCharset_t;
+
+
 /**
  * @brief  Font structure used by OLED Drivers
  */
 typedef struct {
-	uint8_t FontWidth;    /*!< Font width in pixels */
-	uint8_t FontHeight;   /*!< Font height in pixels */
+	uint8_t FontWidth;    /*!< Font width in pixels, the widest advance for proportional fonts */
+	uint8_t FontHeight;   /*!< Font height in pixels, the line height for proportional fonts */
 	const uint16_t *data; /*!< Pointer to data font data array */
+	const uint8_t *glyphs; /*!< Optional: the same glyphs page-major, FontWidth column bytes per page and
+	                            (FontHeight + 7) / 8 pages per character from ' '. NULL if the font only has data */
+	const OLED_FontMetrics_t *metrics; /*!< Optional: proportional glyphs, used instead of data and glyphs.
+	                                        NULL for fixed width fonts */
+	const OLED_FontPacked_t *packed; /*!< Optional: bit-packed glyphs, decoded while drawing when glyphs is NULL.
+	                                      NULL if the font is not packed */
+	const OLED_FontCharset_t *charset; /*!< Optional: codepoint ranges of the glyphs. NULL if the font has ' ' to '~'
+	                                        only, anything else is then drawn as '?' */
 } OLED_FontDef_t;
 
 
@@ -32,7 +118,7 @@ typedef struct {
 
 
 /**
- * @brief  7 x 10 pixels font size structure 
+ * @brief  7 x 10 pixels font size structure, also with degree, micro and ohm signs, arrows and Cyrillic capitals
  */
 extern OLED_FontDef_t OLED_Font_7x10;
 
@@ -47,9 +133,28 @@ extern OLED_FontDef_t OLED_Font_11x18;
 extern OLED_FontDef_t OLED_Font_16x26;
 
 
+/**
+ * @brief  7 x 10, 11 x 18 and 16 x 26 glyphs bit-packed, a fraction of the flash of the fonts above
+ */
+extern OLED_FontDef_t OLED_Font_Packed7x10;
+extern OLED_FontDef_t OLED_Font_Packed11x18;
+extern OLED_FontDef_t OLED_Font_Packed16x26;
+
+
+/**
+ * @brief  7 x 10 glyphs cropped to their ink, proportional with kerning
+ */
+extern OLED_FontDef_t OLED_Font_Prop7x10;
+
+/**
+ * @brief  11 x 18 glyphs cropped to their ink, proportional with kerning
+ */
+extern OLED_FontDef_t OLED_Font_Prop11x18;
+
+
 /**
  * @brief  Calculates string length and height in units of pixels depending on string and font used
- * @param  *str: String to be checked for length and height
+ * @param  *str: UTF-8 string to be checked for length and height
  * @param  *SizeStruct: Pointer to empty @ref OLED_Fonts_Size_t structure where informations will be saved
  * @param  *Font: Pointer to @ref OLED_FontDef_t font used for calculations
  * @retval Pointer to string used for length and height
@@ -57,4 +162,54 @@ extern OLED_FontDef_t OLED_Font_16x26;
 char* OLED_FONTS_GetStringSize(char* str, OLED_Fonts_Size_t* SizeStruct, OLED_FontDef_t* Font);
 
 
+/**
+ * @brief  Looks up the kerning between two characters of a proportional font
+ * @note   Binary search in the font's kerning pairs, which only hold codepoints up to 255
+ * @param  *Font: Pointer to @ref OLED_FontDef_t font
+ * @param  left: Codepoint drawn first
+ * @param  right: Codepoint that follows it, 0 at the end of a string
+ * @retval Pixels to add to the advance of left, 0 for fixed width fonts and pairs without kerning
+ */
+int8_t OLED_FONTS_GetKerning(const OLED_FontDef_t* Font, uint32_t left, uint32_t right);
+
+
+/**
+ * @brief  Decodes the next character of a UTF-8 string
+ * @note   Malformed sequences (stray continuation bytes, overlong forms, surrogates) give @ref OLED_FONTS_INVALID
+ *         and skip only the bytes that were examined, so decoding always moves on
+ * @param  **str: Pointer to the string, moved past the character. Left alone at the terminating zero
+ * @retval Codepoint, 0 at the end of the string
+ */
+uint32_t OLED_FONTS_DecodeUtf8(const char** str);
+
+
+/**
+ * @brief  Encodes a codepoint as UTF-8
+ * @param  codepoint: Codepoint, up to 0x10FFFF
+ * @param  *out: At least 5 bytes, filled with the sequence and a terminating zero
+ * @retval Number of bytes in the sequence, 0 for invalid codepoints
+ */
+uint8_t OLED_FONTS_EncodeUtf8(uint32_t codepoint, char* out);
+
+
+/**
+ * @brief  Finds the glyph drawn for a codepoint
+ * @note   ' ' to '~' are found directly (through the map of a subset font), other codepoints by binary search in
+ *         the font's ranges
+ * @param  *Font: Pointer to @ref OLED_FontDef_t font
+ * @param  codepoint: Character to be drawn
+ * @retval Glyph index in the font's tables, the fallback glyph for codepoints the font does not have
+ */
+uint16_t OLED_FONTS_GetGlyph(const OLED_FontDef_t* Font, uint32_t codepoint);
+
+
+/**
+ * @brief  Calculates the flash taken by a font: its descriptor and every table it points to
+ * @note   Tables shared by several fonts are counted for each of them
+ * @param  *Font: Pointer to @ref OLED_FontDef_t font
+ * @retval Size in bytes
+ */
+uint32_t OLED_FONTS_GetFlashSize(const OLED_FontDef_t* Font);
+
+
 #endif
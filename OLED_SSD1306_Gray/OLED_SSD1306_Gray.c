@@ -0,0 +1,426 @@
+/**
+  **********************************************************************************************************************
+   * @file   : OLED_SSD1306_Gray.c
+   * @author : Sharath N
+   * @brief  : Temporal dithering grayscale for the SSD1306 OLED Driver
+  **********************************************************************************************************************
+*/
+
+#include "OLED_SSD1306_Gray.h"
+#include "stm32f4xx_hal.h"
+
+
+/* Frames in one gray cycle for the largest bit depth */
+#define OLED_GRAY_MAX_SEQUENCE       ((1 << OLED_GRAY_MAX_BITS) - 1)
+
+/* Private flush state, shared with the TIM6 and I2C interrupts */
+typedef struct {
+	const OLED_Gray_Canvas_t *Canvas;
+	volatile uint8_t Running;
+	uint8_t Length;                            /* Frames in one gray cycle */
+	uint8_t Slot;                              /* Next entry of Sequence */
+	uint8_t Sequence[OLED_GRAY_MAX_SEQUENCE];  /* Bit-plane shown in each frame of the cycle */
+	uint32_t LastStart;                        /* DWT cycle count at the last frame start */
+	uint32_t SumInterval;
+	OLED_Gray_Stats_t Stats;
+} OLED_Gray_Flush_t;
+
+/* Private Variable */
+static OLED_Gray_Flush_t OLED_GRAY;
+
+
+/**
+ * @brief  Initializes a grayscale canvas over a caller supplied buffer, all pixels at level 0
+ * @param  *canvas: Canvas to be initialized
+ * @param  *buffer: At least OLED_GRAY_BUFFER_SIZE(w, h, bits) bytes
+ * @param  w,h: Canvas size in pixels
+ * @param  bits: Bits per pixel, OLED_GRAY_MIN_BITS to OLED_GRAY_MAX_BITS
+ * @retval None
+ */
+void OLED_GRAY_CanvasInit(OLED_Gray_Canvas_t* canvas, uint8_t* buffer, uint16_t w, uint16_t h, uint8_t bits)
+{
+	if (bits < OLED_GRAY_MIN_BITS)
+	{
+		bits = OLED_GRAY_MIN_BITS;
+	}
+	else if (bits > OLED_GRAY_MAX_BITS)
+	{
+		bits = OLED_GRAY_MAX_BITS;
+	}
+
+	canvas->Width = w;
+	canvas->Height = h;
+	canvas->Bits = bits;
+	canvas->Buffer = buffer;
+
+	/* Start with a black canvas */
+	memset(buffer, 0x00, OLED_GRAY_BUFFER_SIZE(w, h, bits));
+}
+
+
+/**
+ * @brief  Returns one bit-plane as a monochrome canvas
+ * @note   Any driver drawing function can render into the plane with @ref OLED_SSD1306_SetTarget().
+ *         The plane keeps its pixels, only @ref OLED_GRAY_CanvasInit() and @ref OLED_GRAY_Fill() clear it
+ * @param  *canvas: Grayscale canvas
+ * @param  plane: 0 (least significant) to canvas->Bits - 1
+ * @param  *out: Canvas set up over the plane's bytes
+ * @retval None
+ */
+void OLED_GRAY_GetPlane(const OLED_Gray_Canvas_t* canvas, uint8_t plane, OLED_Canvas_t* out)
+{
+	/* Set up directly, OLED_SSD1306_CanvasInit() would blank the plane */
+	out->Width = canvas->Width;
+	out->Height = canvas->Height;
+	out->Buffer = &canvas->Buffer[plane * OLED_CANVAS_BUFFER_SIZE(canvas->Width, canvas->Height)];
+}
+
+
+/**
+ * @brief  Fills the whole grayscale canvas with one level
+ * @param  *canvas: Grayscale canvas
+ * @param  level: 0 (black) to 2^Bits - 1 (white)
+ * @retval None
+ */
+void OLED_GRAY_Fill(const OLED_Gray_Canvas_t* canvas, uint8_t level)
+{
+	uint16_t size = OLED_CANVAS_BUFFER_SIZE(canvas->Width, canvas->Height);
+	uint8_t k;
+
+	for (k = 0; k < canvas->Bits; k++)
+	{
+		memset(&canvas->Buffer[k * size], (level & (1 << k)) ? 0xFF : 0x00, size);
+	}
+}
+
+
+/**
+ * @brief  Draws a pixel on a grayscale canvas
+ * @param  *canvas: Grayscale canvas
+ * @param  x,y: Pixel position, pixels outside the canvas are ignored
+ * @param  level: 0 (black) to 2^Bits - 1 (white)
+ * @retval None
+ */
+void OLED_GRAY_DrawPixel(const OLED_Gray_Canvas_t* canvas, int16_t x, int16_t y, uint8_t level)
+{
+	uint16_t size = OLED_CANVAS_BUFFER_SIZE(canvas->Width, canvas->Height);
+	uint8_t *p;
+	uint8_t bit, k;
+
+	if (x < 0 || y < 0 || x >= canvas->Width || y >= canvas->Height)
+	{
+		return;
+	}
+
+	p = &canvas->Buffer[x + (y / 8) * canvas->Width];
+	bit = 1 << (y % 8);
+
+	/* Same byte in every plane */
+	for (k = 0; k < canvas->Bits; k++, p += size)
+	{
+		if (level & (1 << k))
+		{
+			*p |= bit;
+		}
+		else
+		{
+			*p &= ~bit;
+		}
+	}
+}
+
+
+/**
+ * @brief  Returns the level of a pixel on a grayscale canvas
+ * @param  *canvas: Grayscale canvas
+ * @param  x,y: Pixel position
+ * @retval Level of the pixel, 0 outside the canvas
+ */
+uint8_t OLED_GRAY_GetPixel(const OLED_Gray_Canvas_t* canvas, int16_t x, int16_t y)
+{
+	uint16_t size = OLED_CANVAS_BUFFER_SIZE(canvas->Width, canvas->Height);
+	const uint8_t *p;
+	uint8_t bit, k, level = 0;
+
+	if (x < 0 || y < 0 || x >= canvas->Width || y >= canvas->Height)
+	{
+		return 0;
+	}
+
+	p = &canvas->Buffer[x + (y / 8) * canvas->Width];
+	bit = 1 << (y % 8);
+
+	for (k = 0; k < canvas->Bits; k++, p += size)
+	{
+		if (*p & bit)
+		{
+			level |= 1 << k;
+		}
+	}
+
+	return level;
+}
+
+
+/**
+ * @brief  Fills a rectangle of a grayscale canvas with one level, e.g. a gauge bar
+ * @note   Uses the driver's byte-mask span fill on every plane, so it honours the clip stack.
+ *         Pixels outside the rectangle keep their levels
+ * @param  *canvas: Grayscale canvas
+ * @param  x,y: Top left corner
+ * @param  w,h: Rectangle size, covering w + 1 by h + 1 pixels like @ref OLED_SSD1306_DrawFilledRectangle()
+ * @param  level: 0 (black) to 2^Bits - 1 (white)
+ * @retval None
+ */
+void OLED_GRAY_DrawFilledRectangle(const OLED_Gray_Canvas_t* canvas, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint8_t level)
+{
+	OLED_Canvas_t *target = OLED_SSD1306_GetTarget();
+	OLED_ROP_t rop = OLED_SSD1306_GetRasterOp();
+	OLED_Canvas_t plane;
+	uint8_t k;
+
+	/* Every plane gets its bit of the level, whatever raster op the caller left set */
+	OLED_SSD1306_SetRasterOp(OLED_ROP_COPY);
+
+	for (k = 0; k < canvas->Bits; k++)
+	{
+		OLED_GRAY_GetPlane(canvas, k, &plane);
+		OLED_SSD1306_SetTarget(&plane);
+		OLED_SSD1306_DrawFilledRectangle(x, y, w, h, (level & (1 << k)) ? OLED_COLOR_WHITE : OLED_COLOR_BLACK);
+	}
+
+	OLED_SSD1306_SetTarget(target);
+	OLED_SSD1306_SetRasterOp(rop);
+}
+
+
+/* Called from the I2C interrupt at the end of a frame */
+static void OLED_GRAY_FrameDone(uint8_t error)
+{
+	uint32_t transfer = DWT->CYCCNT - OLED_GRAY.LastStart;
+
+	if (error)
+	{
+		OLED_GRAY.Stats.Errors++;
+	}
+
+	if (transfer > OLED_GRAY.Stats.MaxTransfer)
+	{
+		OLED_GRAY.Stats.MaxTransfer = transfer;
+	}
+}
+
+
+/* TIM6 update interrupt every 1 / frame_hz seconds */
+static void OLED_GRAY_TimerConfig(uint16_t frame_hz)
+{
+	uint32_t clk = HAL_RCC_GetPCLK1Freq();
+
+	/* APB1 timers run at twice PCLK1 unless the APB1 prescaler is 1 */
+	if ((RCC->CFGR & RCC_CFGR_PPRE1) != RCC_CFGR_PPRE1_DIV1)
+	{
+		clk *= 2;
+	}
+
+	RCC->APB1ENR |= RCC_APB1ENR_TIM6EN;
+
+	TIM6->CR1 = 0;
+	TIM6->PSC = clk / 1000000 - 1;          /* 1 MHz count */
+	TIM6->ARR = 1000000 / frame_hz - 1;
+	TIM6->EGR = TIM_EGR_UG;                 /* load the prescaler now */
+	TIM6->SR = 0;
+	TIM6->DIER = TIM_DIER_UIE;
+
+	/* Below the I2C interrupts, a late frame start must not hold up the transfer before it */
+	HAL_NVIC_SetPriority(TIM6_DAC_IRQn, 2, 0);
+	HAL_NVIC_EnableIRQ(TIM6_DAC_IRQn);
+
+	TIM6->CR1 = TIM_CR1_CEN;
+}
+
+
+/**
+ * @brief  Starts showing a grayscale canvas, frames are sent from the TIM6 interrupt until @ref OLED_GRAY_Stop()
+ * @note   The canvas stays in use, drawing into it shows up within one cycle of frames.
+ *         Do not call @ref OLED_SSD1306_UpdateScreen() while the flush is running
+ * @param  *canvas: OLED_WIDTH x OLED_HEIGHT grayscale canvas
+ * @param  frame_hz: Bit-plane frames per second, from OLED_GRAY_MIN_FRAME_HZ. One gray cycle is 2^Bits - 1 frames
+ * @retval 1 on success, 0 if the canvas is not screen sized or frame_hz is out of range
+ */
+uint8_t OLED_GRAY_Start(const OLED_Gray_Canvas_t* canvas, uint16_t frame_hz)
+{
+	uint8_t i, n;
+
+	if (canvas->Width != OLED_WIDTH || canvas->Height != OLED_HEIGHT || frame_hz < OLED_GRAY_MIN_FRAME_HZ)
+	{
+		return 0;
+	}
+
+	OLED_GRAY_Stop();
+
+	/* Frame i (1 based) shows plane Bits - 1 - ctz(i): the MSB every other frame, the LSB once per cycle.
+	   Interleaving the planes keeps the lit time of each level spread over the cycle, less flicker
+	   than showing the planes one after another */
+	OLED_GRAY.Length = (1 << canvas->Bits) - 1;
+
+	for (i = 1; i <= OLED_GRAY.Length; i++)
+	{
+		for (n = 0; !(i & (1 << n)); n++)
+		{
+		}
+
+		OLED_GRAY.Sequence[i - 1] = canvas->Bits - 1 - n;
+	}
+
+	OLED_GRAY.Canvas = canvas;
+	OLED_GRAY.Slot = 0;
+	OLED_GRAY_ResetStats();
+
+	/* Cycle counter for the timing figures */
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+	/* Whole screen window once, every frame is then a single data transfer wrapping back to 0,0 */
+	OLED_SSD1306_SetWindow(0, OLED_WIDTH - 1, 0, OLED_HEIGHT / 8 - 1);
+
+	OLED_GRAY.Running = 1;
+	OLED_GRAY_TimerConfig(frame_hz);
+
+	return 1;
+}
+
+
+/**
+ * @brief  Stops the grayscale flush after the frame on the bus
+ * @note   The panel keeps the last bit-plane until the next @ref OLED_SSD1306_UpdateScreen()
+ * @retval None
+ */
+void OLED_GRAY_Stop(void)
+{
+	if (!OLED_GRAY.Running)
+	{
+		return;
+	}
+
+	TIM6->CR1 = 0;
+	TIM6->DIER = 0;
+	OLED_GRAY.Running = 0;
+
+	while (OLED_SSD1306_IsBusy())
+	{
+	}
+}
+
+
+/**
+ * @brief  Sends the next bit-plane frame, called from the TIM6 interrupt
+ * @note   Can be called from another timer instead, the weights only depend on the frame order
+ * @retval None
+ */
+void OLED_GRAY_Tick(void)
+{
+	const OLED_Gray_Canvas_t *canvas = OLED_GRAY.Canvas;
+	uint16_t size;
+	uint32_t now, interval;
+
+	if (!OLED_GRAY.Running)
+	{
+		return;
+	}
+
+	/* Previous frame still on the bus: skip this tick, the slot is kept so the weights stay right */
+	if (OLED_SSD1306_IsBusy())
+	{
+		OLED_GRAY.Stats.Overruns++;
+		return;
+	}
+
+	now = DWT->CYCCNT;
+
+	if (OLED_GRAY.Stats.Frames)
+	{
+		interval = now - OLED_GRAY.LastStart;
+		OLED_GRAY.SumInterval += interval;
+
+		if (interval < OLED_GRAY.Stats.MinInterval)
+		{
+			OLED_GRAY.Stats.MinInterval = interval;
+		}
+
+		if (interval > OLED_GRAY.Stats.MaxInterval)
+		{
+			OLED_GRAY.Stats.MaxInterval = interval;
+		}
+	}
+
+	OLED_GRAY.LastStart = now;
+
+	size = OLED_CANVAS_BUFFER_SIZE(canvas->Width, canvas->Height);
+
+	if (OLED_SSD1306_Send_DataAsync(&canvas->Buffer[OLED_GRAY.Sequence[OLED_GRAY.Slot] * size], size, OLED_GRAY_FrameDone))
+	{
+		OLED_GRAY.Stats.Frames++;
+
+		if (++OLED_GRAY.Slot == OLED_GRAY.Length)
+		{
+			OLED_GRAY.Slot = 0;
+		}
+	}
+	else
+	{
+		OLED_GRAY.Stats.Errors++;
+	}
+}
+
+
+/**
+ * @brief  Returns the flush timing gathered since @ref OLED_GRAY_Start() or @ref OLED_GRAY_ResetStats()
+ * @param  *stats: Filled in with the current figures
+ * @retval None
+ */
+void OLED_GRAY_GetStats(OLED_Gray_Stats_t* stats)
+{
+	uint32_t primask = __get_PRIMASK();
+
+	/* Also callable with interrupts already off, e.g. from an interrupt handler */
+	__disable_irq();
+
+	*stats = OLED_GRAY.Stats;
+	stats->AvgInterval = (stats->Frames > 1) ? OLED_GRAY.SumInterval / (stats->Frames - 1) : 0;
+
+	if (stats->Frames < 2)
+	{
+		stats->MinInterval = 0;
+	}
+
+	__set_PRIMASK(primask);
+}
+
+
+/**
+ * @brief  Clears the flush timing figures
+ * @retval None
+ */
+void OLED_GRAY_ResetStats(void)
+{
+	uint32_t primask = __get_PRIMASK();
+
+	__disable_irq();
+
+	memset(&OLED_GRAY.Stats, 0, sizeof(OLED_GRAY.Stats));
+	OLED_GRAY.Stats.MinInterval = 0xFFFFFFFF;
+	OLED_GRAY.SumInterval = 0;
+
+	__set_PRIMASK(primask);
+}
+
+
+/* TIM6 Handler */
+void TIM6_DAC_IRQHandler(void)
+{
+	if (TIM6->SR & TIM_SR_UIF)
+	{
+		TIM6->SR = ~TIM_SR_UIF;
+		OLED_GRAY_Tick();
+	}
+}
@@ -0,0 +1,165 @@
+/**
+  **********************************************************************************************************************
+   * @file   : OLED_SSD1306_Gray.h
+   * @author : Sharath N
+   * @brief  : Temporal dithering grayscale for the SSD1306 OLED Driver
+  **********************************************************************************************************************
+*/
+
+/*
+          The panel is monochrome. A grayscale canvas keeps one page-major bit-plane per bit of the gray level
+          and the flush shows plane k for 2^k of every (2^Bits - 1) frames, so a pixel is lit in proportion to
+          its level. Frames are paced by TIM6 and sent with OLED_SSD1306_Send_DataAsync(), one 1025 byte I2C
+          transfer each, so the CPU is free while the eye integrates the sequence.
+
+          At 400 kHz a frame takes about 23 ms on the bus. 2 bits (4 levels, 3 frames per cycle) is the
+          practical choice, 3 bits (8 levels, 7 frames) flickers visibly, 4 bits is only useful on a faster bus.
+*/
+
+#ifndef OLED_SSD1306_GRAY_H
+#define OLED_SSD1306_GRAY_H
+
+#include <stdint.h>
+#include "STM32F407_OLED_SSD1306_Driver.h"
+
+#define OLED_GRAY_MIN_BITS           2     // 4 gray levels
+#define OLED_GRAY_MAX_BITS           4     // 16 gray levels
+
+#define OLED_GRAY_MIN_FRAME_HZ       16    // TIM6 at 1 MHz, the 16 bit auto-reload limits the frame period
+
+/* Number of bytes needed by a grayscale canvas of w x h pixels with bits per pixel */
+#define OLED_GRAY_BUFFER_SIZE(w, h, bits)  ((bits) * OLED_CANVAS_BUFFER_SIZE(w, h))
+
+
+/**
+ * @brief  Grayscale canvas, stored as bit-planes in the driver's page-major layout
+ */
+typedef struct {
+	uint16_t Width;   /*!< Canvas width in pixels */
+	uint16_t Height;  /*!< Canvas height in pixels */
+	uint8_t Bits;     /*!< Bits per pixel, OLED_GRAY_MIN_BITS to OLED_GRAY_MAX_BITS */
+	uint8_t *Buffer;  /*!< Bits planes of OLED_CANVAS_BUFFER_SIZE(Width, Height) bytes, plane k holds bit k of the level */
+} OLED_Gray_Canvas_t;
+
+
+/**
+ * @brief  Flush timing, for tuning flicker against bus load
+ */
+typedef struct {
+	uint32_t Frames;       /*!< Bit-plane frames started */
+	uint32_t Overruns;     /*!< Timer ticks that found the previous frame still on the bus, the frame was delayed */
+	uint32_t Errors;       /*!< Frames that failed on the bus */
+	uint32_t MinInterval;  /*!< Shortest time between two frame starts, CPU cycles */
+	uint32_t MaxInterval;  /*!< Longest time between two frame starts, CPU cycles */
+	uint32_t AvgInterval;  /*!< Average time between two frame starts, CPU cycles */
+	uint32_t MaxTransfer;  /*!< Longest frame transfer, CPU cycles */
+} OLED_Gray_Stats_t;
+
+
+/**
+ * @brief  Initializes a grayscale canvas over a caller supplied buffer, all pixels at level 0
+ * @param  *canvas: Canvas to be initialized
+ * @param  *buffer: At least OLED_GRAY_BUFFER_SIZE(w, h, bits) bytes
+ * @param  w,h: Canvas size in pixels
+ * @param  bits: Bits per pixel, OLED_GRAY_MIN_BITS to OLED_GRAY_MAX_BITS
+ * @retval None
+ */
+void OLED_GRAY_CanvasInit(OLED_Gray_Canvas_t* canvas, uint8_t* buffer, uint16_t w, uint16_t h, uint8_t bits);
+
+
+/**
+ * @brief  Returns one bit-plane as a monochrome canvas
+ * @note   Any driver drawing function can render into the plane with @ref OLED_SSD1306_SetTarget().
+ *         The plane keeps its pixels, only @ref OLED_GRAY_CanvasInit() and @ref OLED_GRAY_Fill() clear it
+ * @param  *canvas: Grayscale canvas
+ * @param  plane: 0 (least significant) to canvas->Bits - 1
+ * @param  *out: Canvas set up over the plane's bytes
+ * @retval None
+ */
+void OLED_GRAY_GetPlane(const OLED_Gray_Canvas_t* canvas, uint8_t plane, OLED_Canvas_t* out);
+
+
+/**
+ * @brief  Fills the whole grayscale canvas with one level
+ * @param  *canvas: Grayscale canvas
+ * @param  level: 0 (black) to 2^Bits - 1 (white)
+ * @retval None
+ */
+void OLED_GRAY_Fill(const OLED_Gray_Canvas_t* canvas, uint8_t level);
+
+
+/**
+ * @brief  Draws a pixel on a grayscale canvas
+ * @param  *canvas: Grayscale canvas
+ * @param  x,y: Pixel position, pixels outside the canvas are ignored
+ * @param  level: 0 (black) to 2^Bits - 1 (white)
+ * @retval None
+ */
+void OLED_GRAY_DrawPixel(const OLED_Gray_Canvas_t* canvas, int16_t x, int16_t y, uint8_t level);
+
+
+/**
+ * @brief  Returns the level of a pixel on a grayscale canvas
+ * @param  *canvas: Grayscale canvas
+ * @param  x,y: Pixel position
+ * @retval Level of the pixel, 0 outside the canvas
+ */
+uint8_t OLED_GRAY_GetPixel(const OLED_Gray_Canvas_t* canvas, int16_t x, int16_t y);
+
+
+/**
+ * @brief  Fills a rectangle of a grayscale canvas with one level, e.g. a gauge bar
+ * @note   Uses the driver's byte-mask span fill on every plane, so it honours the clip stack.
+ *         Pixels outside the rectangle keep their levels
+ * @param  *canvas: Grayscale canvas
+ * @param  x,y: Top left corner
+ * @param  w,h: Rectangle size, covering w + 1 by h + 1 pixels like @ref OLED_SSD1306_DrawFilledRectangle()
+ * @param  level: 0 (black) to 2^Bits - 1 (white)
+ * @retval None
+ */
+void OLED_GRAY_DrawFilledRectangle(const OLED_Gray_Canvas_t* canvas, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint8_t level);
+
+
+/**
+ * @brief  Starts showing a grayscale canvas, frames are sent from the TIM6 interrupt until @ref OLED_GRAY_Stop()
+ * @note   The canvas stays in use, drawing into it shows up within one cycle of frames.
+ *         Do not call @ref OLED_SSD1306_UpdateScreen() while the flush is running
+ * @param  *canvas: OLED_WIDTH x OLED_HEIGHT grayscale canvas
+ * @param  frame_hz: Bit-plane frames per second, from OLED_GRAY_MIN_FRAME_HZ. One gray cycle is 2^Bits - 1 frames
+ * @retval 1 on success, 0 if the canvas is not screen sized or frame_hz is out of range
+ */
+uint8_t OLED_GRAY_Start(const OLED_Gray_Canvas_t* canvas, uint16_t frame_hz);
+
+
+/**
+ * @brief  Stops the grayscale flush after the frame on the bus
+ * @note   The panel keeps the last bit-plane until the next @ref OLED_SSD1306_UpdateScreen()
+ * @retval None
+ */
+void OLED_GRAY_Stop(void);
+
+
+/**
+ * @brief  Sends the next bit-plane frame, called from the TIM6 interrupt
+ * @note   Can be called from another timer instead, the weights only depend on the frame order
+ * @retval None
+ */
+void OLED_GRAY_Tick(void);
+
+
+/**
+ * @brief  Returns the flush timing gathered since @ref OLED_GRAY_Start() or @ref OLED_GRAY_ResetStats()
+ * @param  *stats: Filled in with the current figures
+ * @retval None
+ */
+void OLED_GRAY_GetStats(OLED_Gray_Stats_t* stats);
+
+
+/**
+ * @brief  Clears the flush timing figures
+ * @retval None
+ */
+void OLED_GRAY_ResetStats(void);
+
+
+#endif
@@ -22,7 +22,6 @@
 #ifndef STM32F407_OLED_SSD1306_DRIVER_H
 #define STM32F407_OLED_SSD1306_DRIVER_H
 
-#include <stdio.h>
 #include <string.h>
 #include "stdint.h"
 #include "stm32f4xx_hal.h"                 // Keil::Device:STM32Cube HAL:Common
@@ -32,10 +31,22 @@
 #define OLED_WIDTH                   128   // SSD1306 OLDE Display width in pixels
 #define OLED_HEIGHT                  64    // SSD1306 OLDE Display height in pixels
 
+#define OLED_CLIP_STACK_DEPTH        8     // Maximum nesting of OLED_SSD1306_PushClip()
+#define OLED_DITHER_MAX_WIDTH        OLED_WIDTH  // Columns per error diffusion strip of OLED_SSD1306_DrawGray8()
+#define OLED_BITMAP_CHUNK            64    // Columns transposed per pass by OLED_SSD1306_DrawBitmap(), multiple of 8
+#define OLED_TEXT_CACHE_ENTRIES      8     // Text runs kept by OLED_SSD1306_PutsCached()
+#define OLED_TEXT_CACHE_SLOT_SIZE    256   // Bytes of rendered pixels per text run, e.g. 18 characters of 7x10
+#define OLED_TEXT_CACHE_MAX_LEN      23    // Longest string OLED_SSD1306_PutsCached() keeps, longer ones are drawn directly
+#define OLED_NUM_MAX_WIDTH           24    // Widest field of OLED_SSD1306_PutInt(), PutFixed() and PutHex()
+#define OLED_TEXT_MAX_SCALE          4     // Largest factor of OLED_SSD1306_SetTextScale(), 2 to 4
+
 #define ABS(x)   ((x) > 0 ? (x) : -(x))    //Get the absolute value
 
+/* Number of bytes needed by a page-major canvas of w x h pixels */
+#define OLED_CANVAS_BUFFER_SIZE(w, h)  ((w) * (((h) + 7) / 8))
+
 /* SSD1306 data buffer */
-static uint8_t OLED_Buffer[(OLED_WIDTH * OLED_HEIGHT) / 8];
+extern uint8_t OLED_Buffer[OLED_CANVAS_BUFFER_SIZE(OLED_WIDTH, OLED_HEIGHT)];
 
 
 typedef enum {
@@ -44,6 +55,135 @@ typedef enum {
 } OLED_COLOR_t;
 
 
+/**
+ * @brief  Raster operation used to combine source pixels with the destination
+ */
+typedef enum {
+	OLED_ROP_COPY    = 0x00, /*!< dst = src */
+	OLED_ROP_OR      = 0x01, /*!< dst = dst | src */
+	OLED_ROP_AND_NOT = 0x02, /*!< dst = dst & ~src */
+	OLED_ROP_XOR     = 0x03  /*!< dst = dst ^ src */
+} OLED_ROP_t;
+
+
+/**
+ * @brief  What text draws besides its glyph bits, see @ref OLED_SSD1306_SetTextMode()
+ */
+typedef enum {
+	OLED_TEXT_OPAQUE      = 0x00, /*!< The whole cell, background in the opposite color (default) */
+	OLED_TEXT_TRANSPARENT = 0x01  /*!< Glyph bits only, whatever is underneath shows through */
+} OLED_TEXT_MODE_t;
+
+
+/**
+ * @brief  Screen rotation. Bit 0 swaps x and y in software, bit 1 is the controller's 180 degree re-map
+ */
+typedef enum {
+	OLED_ROTATION_0   = 0x00, /*!< Native orientation */
+	OLED_ROTATION_90  = 0x01, /*!< Software transpose */
+	OLED_ROTATION_180 = 0x02, /*!< Segment re-map and COM scan direction, no CPU cost */
+	OLED_ROTATION_270 = 0x03  /*!< Software transpose plus hardware 180 */
+} OLED_ROTATION_t;
+
+
+/**
+ * @brief  How @ref OLED_SSD1306_DrawGray8() turns gray values into black and white
+ */
+typedef enum {
+	OLED_DITHER_THRESHOLD       = 0x00, /*!< White above 127, no dithering */
+	OLED_DITHER_BAYER           = 0x01, /*!< 8x8 ordered dither, fastest, stable pattern when the image moves */
+	OLED_DITHER_FLOYD_STEINBERG = 0x02, /*!< Error diffusion, smoothest gradients */
+	OLED_DITHER_ATKINSON        = 0x03  /*!< Error diffusion dropping 1/4 of the error, more contrast */
+} OLED_DITHER_t;
+
+
+/**
+ * @brief  Position of the lines of @ref OLED_SSD1306_DrawTextBox() within the box
+ */
+typedef enum {
+	OLED_ALIGN_LEFT   = 0x00, /*!< Lines start at the left edge */
+	OLED_ALIGN_CENTER = 0x01, /*!< Lines are centered, odd spare pixels go to the right */
+	OLED_ALIGN_RIGHT  = 0x02  /*!< Lines end at the right edge */
+} OLED_ALIGN_t;
+
+
+/**
+ * @brief  How @ref OLED_SSD1306_DrawTextBox() breaks text into lines
+ */
+typedef enum {
+	OLED_WRAP_NONE = 0x00, /*!< Only at '\n', lines too wide end in "..." */
+	OLED_WRAP_WORD = 0x01  /*!< Also at the last space that fits, words longer than a line between characters */
+} OLED_WRAP_t;
+
+
+/**
+ * @brief  Layout of the numbers drawn by @ref OLED_SSD1306_PutInt(), @ref OLED_SSD1306_PutFixed() and
+ *         @ref OLED_SSD1306_PutHex(), values can be ORed together
+ */
+typedef enum {
+	OLED_NUM_DEFAULT  = 0x00, /*!< Right aligned in the field, padded with spaces, a sign only when negative */
+	OLED_NUM_ZERO_PAD = 0x01, /*!< Padded with '0' between the sign and the digits */
+	OLED_NUM_LEFT     = 0x02, /*!< Left aligned, padded with spaces after the digits. Overrides OLED_NUM_ZERO_PAD */
+	OLED_NUM_PLUS     = 0x04, /*!< '+' in front of positive values and zero */
+	OLED_NUM_LOWER    = 0x08  /*!< Hex digits a to f instead of A to F */
+} OLED_NUM_FLAGS_t;
+
+
+/**
+ * @brief  Off-screen canvas. Uses the same page-major layout as OLED_Buffer:
+ *         byte (x + page * Width) holds rows page * 8 (LSB) to page * 8 + 7 (MSB) of column x
+ */
+typedef struct {
+	uint16_t Width;   /*!< Canvas width in pixels */
+	uint16_t Height;  /*!< Canvas height in pixels */
+	uint8_t *Buffer;  /*!< OLED_CANVAS_BUFFER_SIZE(Width, Height) bytes of pixel data */
+} OLED_Canvas_t;
+
+
+/**
+ * @brief  Pixel layout of an @ref OLED_Bitmap_t
+ */
+typedef enum {
+	OLED_BITMAP_PAGE_MAJOR     = 0x00, /*!< Same layout as OLED_Buffer: one byte is 8 rows of a column, top row in the LSB */
+	OLED_BITMAP_ROW_MAJOR      = 0x01, /*!< Rows of (Width + 7) / 8 bytes, leftmost pixel in the MSB (image2cpp, GIMP C header) */
+	OLED_BITMAP_XBM            = 0x02, /*!< Rows of (Width + 7) / 8 bytes, leftmost pixel in the LSB (X11 bitmap) */
+	OLED_BITMAP_PAGE_MAJOR_RLE = 0x03, /*!< Page-major bytes, PackBits compressed as one stream (Tools/OLED_AssetCompiler) */
+	OLED_BITMAP_PAGE_MAJOR_LZ  = 0x04  /*!< Page-major bytes, LZ compressed with back references into the decoded bytes,
+	                                        data and mask each as one stream (Tools/OLED_AssetCompiler). Can be decoded
+	                                        in place by @ref OLED_SSD1306_UnpackBitmap() */
+} OLED_BITMAP_FORMAT_t;
+
+
+/**
+ * @brief  1 bit per pixel image, usually a const array in flash
+ */
+typedef struct {
+	uint16_t Width;         /*!< Bitmap width in pixels */
+	uint16_t Height;        /*!< Bitmap height in pixels */
+	uint8_t Format;         /*!< Layout of Data and Mask, a value of @ref OLED_BITMAP_FORMAT_t enumeration */
+	const uint8_t *Data;    /*!< Pixel data, a set bit is a set pixel */
+	const uint8_t *Mask;    /*!< Opaque pixels in the same layout, NULL when every pixel is opaque */
+} OLED_Bitmap_t;
+
+
+/**
+ * @brief  Counters of @ref OLED_SSD1306_PutsCached(), for sizing the text cache
+ */
+typedef struct {
+	uint32_t Hits;          /*!< Strings drawn with a single blit of a cached run */
+	uint32_t Misses;        /*!< Strings rendered and stored in a slot */
+	uint32_t Evictions;     /*!< Misses that replaced the least recently used run */
+	uint32_t Bypassed;      /*!< Strings drawn directly: too long for a slot or not entirely on the target */
+} OLED_TextCacheStats_t;
+
+
+/**
+ * @brief  Called from the I2C interrupt when an @ref OLED_SSD1306_Send_DataAsync() transfer ends
+ * @param  error: 0 when all data was sent, 1 when the transfer failed
+ */
+typedef void (*OLED_AsyncCallback_t)(uint8_t error);
+
+
 
 
 /************* SSD1306 OLED Commands - (Table 9-1: Command Table , Refer  Page 28 of OLED SSD1306 Data sheet **********/
@@ -55,6 +195,8 @@ typedef enum {
 #define OLED_VERTICAL_ADDR_MODE      0x01  // 01 : Vertical Addressing Mode
 #define OLED_PAGE_ADDR_MODE          0x02  // 10 : Page Addressing Mode (RESET)
 #define OLED_PAGE_START_ADDR         0xB0  // Page Start Address for Page Addressing Mode
+#define OLED_SET_COLUMN_ADDR         0x21  // Set Column Address (start, end) for Horizontal/Vertical Addressing Mode
+#define OLED_SET_PAGE_ADDR           0x22  // Set Page Address (start, end) for Horizontal/Vertical Addressing Mode
 #define OLED_COM_SCAN_DIR_NORMAL     0xC0  // normal mode (RESET) Scan from COM0 to COM[N 1] 
 #define OLED_COM_SCAN_DIR_REMAPPED   0xC8  // remapped mode. Scan from COM[N-1] to COM0
 #define OLED_LOW_COLUMN_START_ADDR   0x00  // lower nibble of the column start address
@@ -115,6 +257,227 @@ void OLED_SSD1306_Fill(OLED_COLOR_t color);
 void OLED_SSD1306_UpdateScreen(void);
 
 
+/**
+ * @brief  Selects a column and page window in horizontal addressing mode
+ * @note   Following data, blocking or @ref OLED_SSD1306_Send_DataAsync(), fills the window column by column,
+ *         page after page and wraps back to its top left corner, so repeated full window transfers need no
+ *         further commands. @ref OLED_SSD1306_UpdateScreen() switches back to page addressing by itself
+ * @param  x0,x1: First and last column, 0 to OLED_WIDTH - 1
+ * @param  page0,page1: First and last page, 0 to OLED_HEIGHT / 8 - 1
+ * @retval None
+ */
+void OLED_SSD1306_SetWindow(uint8_t x0, uint8_t x1, uint8_t page0, uint8_t page1);
+
+
+/**
+ * @brief  Starts an interrupt driven data transfer and returns at once
+ * @note   The data is copied first, the caller may change it as soon as this returns.
+ *         Blocking commands and @ref OLED_SSD1306_UpdateScreen() wait for the transfer to end
+ * @param  *data: Display data, usually pages of a window set by @ref OLED_SSD1306_SetWindow()
+ * @param  len: Number of bytes, at most OLED_CANVAS_BUFFER_SIZE(OLED_WIDTH, OLED_HEIGHT)
+ * @param  done: Called from the I2C interrupt when the transfer ends, may be NULL
+ * @retval 1 if the transfer was started, 0 if a transfer is still running or len is too large
+ */
+uint8_t OLED_SSD1306_Send_DataAsync(const uint8_t* data, uint16_t len, OLED_AsyncCallback_t done);
+
+
+/**
+ * @brief  Tells whether an interrupt driven data transfer is running
+ * @retval 1 while @ref OLED_SSD1306_Send_DataAsync() is transferring, 0 otherwise
+ */
+uint8_t OLED_SSD1306_IsBusy(void);
+
+
+/**
+ * @brief  Initializes an off-screen canvas over a caller supplied buffer
+ * @param  *canvas: Canvas to be initialized
+ * @param  *buffer: At least OLED_CANVAS_BUFFER_SIZE(w, h) bytes
+ * @param  w,h: Canvas size in pixels
+ * @retval None
+ */
+void OLED_SSD1306_CanvasInit(OLED_Canvas_t* canvas, uint8_t* buffer, uint16_t w, uint16_t h);
+
+
+/**
+ * @brief  Selects the canvas all drawing functions render into
+ * @param  *canvas: Canvas to draw into, NULL selects OLED_Buffer (the screen)
+ * @retval None
+ */
+void OLED_SSD1306_SetTarget(OLED_Canvas_t* canvas);
+
+
+/**
+ * @brief  Returns the canvas all drawing functions currently render into
+ * @retval Pointer to the current target canvas
+ */
+OLED_Canvas_t* OLED_SSD1306_GetTarget(void);
+
+
+/**
+ * @brief  Copies a whole canvas into the current target
+ * @note   Page aligned y is a straight byte copy, any other y is shifted and merged a byte at a time.
+ *         The canvas must not be the current target
+ * @param  *canvas: Source canvas
+ * @param  x,y: Top left position in the target, may be negative or partly outside the target
+ * @param  rop: How source pixels are combined with the target. This parameter can be a value of @ref OLED_ROP_t enumeration
+ * @retval None
+ */
+void OLED_SSD1306_Blit(const OLED_Canvas_t* canvas, int16_t x, int16_t y, OLED_ROP_t rop);
+
+
+/**
+ * @brief  Draws a 1 bit per pixel bitmap into the current target
+ * @note   Page-major bitmaps go through the same byte copy / shift and merge as @ref OLED_SSD1306_Blit().
+ *         Row-major and XBM bitmaps are transposed 8x8 pixels at a time, only the visible part.
+ *         Compressed bitmaps are unpacked OLED_BITMAP_CHUNK columns at a time on the stack, LZ bitmaps
+ *         with their back references kept in 1 KB of RAM per stream.
+ *         Data and mask are read where they are, const arrays stay in flash.
+ *         @ref OLED_SSD1306_UpdateScreen() must be called after that in order to see updated LCD screen
+ * @param  x,y: Top left position in the target, may be negative or partly outside the target
+ * @param  *bitmap: Bitmap to draw, see @ref OLED_Bitmap_t
+ * @param  rop: How set pixels are combined with the target. This parameter can be a value of @ref OLED_ROP_t enumeration
+ * @retval None
+ */
+void OLED_SSD1306_DrawBitmap(int16_t x, int16_t y, const OLED_Bitmap_t* bitmap, OLED_ROP_t rop);
+
+
+/**
+ * @brief  Decodes a page-major bitmap straight into a page aligned window of the current target
+ * @note   No intermediate buffer: PackBits runs and LZ back references are written and read in the target itself.
+ *         The bitmap replaces the window, rotation, clip rectangle, raster op and mask do not apply.
+ *         @ref OLED_SSD1306_DrawBitmap() applies all of them
+ * @param  x: Left column of the window in the target buffer
+ * @param  page: Top page of the window in the target buffer
+ * @param  *bitmap: OLED_BITMAP_PAGE_MAJOR, OLED_BITMAP_PAGE_MAJOR_RLE or OLED_BITMAP_PAGE_MAJOR_LZ bitmap
+ * @retval 1 on success, 0 if the format is not page-major or the bitmap does not fit the target at x, page
+ */
+uint8_t OLED_SSD1306_UnpackBitmap(uint16_t x, uint16_t page, const OLED_Bitmap_t* bitmap);
+
+
+/**
+ * @brief  Limits drawing to a rectangle until the matching @ref OLED_SSD1306_PopClip()
+ * @note   The new rectangle is intersected with the one on top of the stack, so nested widgets can never
+ *         draw outside their parent. Coordinates are drawing coordinates of the current target
+ * @param  x,y: Top left corner, may be negative
+ * @param  w,h: Size in pixels, zero gives an empty clip rectangle that rejects all drawing
+ * @retval 1 on success, 0 when the clip stack (OLED_CLIP_STACK_DEPTH) is full
+ */
+uint8_t OLED_SSD1306_PushClip(int16_t x, int16_t y, uint16_t w, uint16_t h);
+
+
+/**
+ * @brief  Restores the clip rectangle active before the last @ref OLED_SSD1306_PushClip()
+ * @retval None
+ */
+void OLED_SSD1306_PopClip(void);
+
+
+/**
+ * @brief  Sets the raster operation used by all drawing functions (pixels, lines, shapes, fills and text)
+ * @note   With OR, AND-NOT and XOR only white pixels touch the target. Drawing the same thing twice with
+ *         XOR restores what was underneath, e.g. for cursors and selection bars.
+ *         @ref OLED_SSD1306_DrawFilledTriangle() overdraws pixels and is exact only for COPY, OR and AND-NOT.
+ *         @ref OLED_SSD1306_Blit() takes its raster op as a parameter instead
+ * @param  rop: This parameter can be a value of @ref OLED_ROP_t enumeration
+ * @retval None
+ */
+void OLED_SSD1306_SetRasterOp(OLED_ROP_t rop);
+
+
+/**
+ * @brief  Returns the raster operation used by all drawing functions
+ * @retval Current raster op, a value of @ref OLED_ROP_t enumeration
+ */
+OLED_ROP_t OLED_SSD1306_GetRasterOp(void);
+
+
+/**
+ * @brief  Selects whether text paints its background
+ * @note   Opaque text draws the whole character cell, background in the opposite color, with the raster op.
+ *         Transparent text only changes its set pixels, with the operation @ref OLED_SSD1306_DrawPixel() uses for
+ *         the color: white text ORs them in and black text clears them under COPY. Both are byte writes
+ * @param  mode: This parameter can be a value of @ref OLED_TEXT_MODE_t enumeration
+ * @retval None
+ */
+void OLED_SSD1306_SetTextMode(OLED_TEXT_MODE_t mode);
+
+
+/**
+ * @brief  Returns whether text paints its background
+ * @retval Current text mode, a value of @ref OLED_TEXT_MODE_t enumeration
+ */
+OLED_TEXT_MODE_t OLED_SSD1306_GetTextMode(void);
+
+
+/**
+ * @brief  Sets the integer factor text is enlarged by, for big readouts from the existing fonts
+ * @note   Applies to Putc(), PutCodepoint(), Puts(), the number functions and DrawTextBox(). Every glyph bit becomes
+ *         a scale x scale block: each page byte is expanded to scale page bytes through a small lookup table and
+ *         the column repeated, then blitted like an unscaled cell. OLED_FONTS_GetStringSize() still measures
+ *         unscaled text, multiply its result by the scale
+ * @param  scale: 1 (default) to OLED_TEXT_MAX_SCALE, 0 is taken as 1 and larger values as OLED_TEXT_MAX_SCALE
+ * @retval None
+ */
+void OLED_SSD1306_SetTextScale(uint8_t scale);
+
+
+/**
+ * @brief  Returns the factor text is enlarged by
+ * @retval 1 to OLED_TEXT_MAX_SCALE
+ */
+uint8_t OLED_SSD1306_GetTextScale(void);
+
+
+/**
+ * @brief  Sets inverse display, done by the controller (0xA7/0xA6) with a single command
+ * @note   The framebuffer and canvases are not touched, white is still drawn as a set bit.
+ *         Takes effect immediately without @ref OLED_SSD1306_UpdateScreen()
+ * @param  inverted: 1 to show set bits dark on a lit background, 0 for normal display
+ * @retval None
+ */
+void OLED_SSD1306_SetInverted(uint8_t inverted);
+
+
+/**
+ * @brief  Returns whether the display is inverted
+ * @retval 1 if inverse display is on, 0 otherwise
+ */
+uint8_t OLED_SSD1306_GetInverted(void);
+
+
+/**
+ * @brief  Sets the screen rotation
+ * @note   180 degrees is done by the controller (segment re-map and COM scan direction) and costs no CPU time.
+ *         90 and 270 degrees swap x and y in software while drawing into the screen, 270 is 90 plus the
+ *         hardware 180. The segment re-map only applies to data written afterwards, so redraw and call
+ *         @ref OLED_SSD1306_UpdateScreen() after changing the rotation
+ * @param  rotation: This parameter can be a value of @ref OLED_ROTATION_t enumeration
+ * @retval None
+ */
+void OLED_SSD1306_SetRotation(OLED_ROTATION_t rotation);
+
+
+/**
+ * @brief  Returns the screen rotation
+ * @retval Current rotation, a value of @ref OLED_ROTATION_t enumeration
+ */
+OLED_ROTATION_t OLED_SSD1306_GetRotation(void);
+
+
+/**
+ * @brief  Returns the width of the current target as seen by the drawing functions
+ * @retval Width in pixels, OLED_HEIGHT for the screen at 90 or 270 degrees
+ */
+uint16_t OLED_SSD1306_GetWidth(void);
+
+
+/**
+ * @brief  Returns the height of the current target as seen by the drawing functions
+ * @retval Height in pixels, OLED_WIDTH for the screen at 90 or 270 degrees
+ */
+uint16_t OLED_SSD1306_GetHeight(void);
+
+
 /**
  * @brief  Draw Pixel
  * @param  x,y: pixel cordinates
@@ -134,8 +497,9 @@ void OLED_SSD1306_GotoXY(uint16_t x, uint16_t y);
 
 /**
  * @brief  Puts character on OLED
- * @note   @ref OLED_SSD1306_UpdateScreen() must be called after that in order to see updated LCD screen
- * @param  ch: Character to be written
+ * @note   @ref OLED_SSD1306_UpdateScreen() must be called after that in order to see updated LCD screen.
+ *         Proportional fonts move the position by the glyph's advance instead of FontWidth
+ * @param  ch: Character to be written, bytes from 0x80 are taken as Latin-1 (0xB0 is the degree sign)
  * @param  *Font: Pointer to @ref OLED_FontDef_t structure with used font
  * @param  color: Color used for drawing. This parameter can be a value of @ref OLED_COLOR_t enumeration
  * @retval Character written
@@ -143,17 +507,127 @@ void OLED_SSD1306_GotoXY(uint16_t x, uint16_t y);
 char OLED_SSD1306_Putc(char ch, OLED_FontDef_t* Font, OLED_COLOR_t color);
 
 
+/**
+ * @brief  Puts a Unicode character on OLED
+ * @note   @ref OLED_SSD1306_UpdateScreen() must be called after that in order to see updated LCD screen.
+ *         Characters the font does not have are drawn with its fallback glyph
+ * @param  codepoint: Character to be written
+ * @param  *Font: Pointer to @ref OLED_FontDef_t structure with used font
+ * @param  color: Color used for drawing. This parameter can be a value of @ref OLED_COLOR_t enumeration
+ * @retval Codepoint written, 0 if there is no room left on the line
+ */
+uint32_t OLED_SSD1306_PutCodepoint(uint32_t codepoint, OLED_FontDef_t* Font, OLED_COLOR_t color);
+
+
 /**
  * @brief  Puts string on OLED
- * @note   @ref OLED_SSD1306_UpdateScreen() must be called after that in order to see updated LCD screen
- * @param  *str: String to be written
+ * @note   @ref OLED_SSD1306_UpdateScreen() must be called after that in order to see updated LCD screen.
+ *         Kerning pairs of proportional fonts are applied between characters
+ * @param  *str: UTF-8 string to be written
  * @param  *Font: Pointer to @ref OLED_FontDef_t structure with used font
  * @param  color: Color used for drawing. This parameter can be a value of @ref OLED_COLOR_t enumeration
- * @retval Zero on success or character value when function failed
+ * @retval Zero on success or the first byte of the character that could not be written
  */
 char OLED_SSD1306_Puts(char* str, OLED_FontDef_t* Font, OLED_COLOR_t color);
 
 
+/**
+ * @brief  Draws a string in a box, wrapped into lines and aligned within it
+ * @note   @ref OLED_SSD1306_UpdateScreen() must be called after that in order to see updated LCD screen.
+ *         Lines are laid out in one pass with the advances and kerning Puts() draws with. Word wrap is greedy:
+ *         a line breaks at the last space that keeps it within w, a word longer than a line is broken between
+ *         characters and the spaces at a break are dropped. '\n' always starts a new line.
+ *         Only lines of full height are drawn. When text is left after the last one, it ends in "...", as does
+ *         any line too wide for the box with OLED_WRAP_NONE. Drawing is clipped to the box, lines outside the
+ *         clip rectangle are measured but not drawn, and layout stops at its bottom edge
+ * @param  x,y: Top left corner of the box
+ * @param  w,h: Size of the box in pixels
+ * @param  *str: UTF-8 string to be written
+ * @param  *Font: Pointer to @ref OLED_FontDef_t structure with used font
+ * @param  color: Color used for drawing. This parameter can be a value of @ref OLED_COLOR_t enumeration
+ * @param  align: Position of every line within w. This parameter can be a value of @ref OLED_ALIGN_t enumeration
+ * @param  wrap: This parameter can be a value of @ref OLED_WRAP_t enumeration
+ * @param  spacing: Pixels between the bottom of a line and the top of the next one
+ * @retval Offset in str of the text that did not fit: the first character replaced by "..." or the first line
+ *         not drawn, the length of str when everything is shown
+ */
+uint16_t OLED_SSD1306_DrawTextBox(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const char* str, OLED_FontDef_t* Font,
+                                  OLED_COLOR_t color, OLED_ALIGN_t align, OLED_WRAP_t wrap, uint8_t spacing);
+
+
+/**
+ * @brief  Puts a signed decimal number on OLED, like "%d" with a field width but without stdio
+ * @note   @ref OLED_SSD1306_UpdateScreen() must be called after that in order to see updated LCD screen.
+ *         The digits are produced in a small buffer on the stack and drawn with @ref OLED_SSD1306_Puts()
+ * @param  value: Number to be written
+ * @param  width: Minimum characters written, padded as flags say. 0 for just the digits
+ * @param  flags: Values of @ref OLED_NUM_FLAGS_t enumeration ORed together
+ * @param  *Font: Pointer to @ref OLED_FontDef_t structure with used font
+ * @param  color: Color used for drawing. This parameter can be a value of @ref OLED_COLOR_t enumeration
+ * @retval Zero on success or the first character that could not be written
+ */
+char OLED_SSD1306_PutInt(int32_t value, uint8_t width, uint8_t flags, OLED_FontDef_t* Font, OLED_COLOR_t color);
+
+
+/**
+ * @brief  Puts a fixed point number on OLED, value / 10^decimals with exactly that many digits after the point
+ * @note   @ref OLED_SSD1306_UpdateScreen() must be called after that in order to see updated LCD screen.
+ *         E.g. a temperature kept in tenths of a degree: PutFixed(-235, 1, ...) writes "-23.5", PutFixed(5, 2, ...)
+ *         writes "0.05". No rounding takes place, scale the value first
+ * @param  value: Number to be written, scaled by 10^decimals
+ * @param  decimals: Digits after the point, 0 to 9. 0 writes an integer
+ * @param  width: Minimum characters written including sign and point, padded as flags say
+ * @param  flags: Values of @ref OLED_NUM_FLAGS_t enumeration ORed together
+ * @param  *Font: Pointer to @ref OLED_FontDef_t structure with used font
+ * @param  color: Color used for drawing. This parameter can be a value of @ref OLED_COLOR_t enumeration
+ * @retval Zero on success or the first character that could not be written
+ */
+char OLED_SSD1306_PutFixed(int32_t value, uint8_t decimals, uint8_t width, uint8_t flags, OLED_FontDef_t* Font,
+                           OLED_COLOR_t color);
+
+
+/**
+ * @brief  Puts an unsigned hexadecimal number on OLED, like "%X" without stdio
+ * @note   @ref OLED_SSD1306_UpdateScreen() must be called after that in order to see updated LCD screen.
+ *         No "0x" prefix is written, e.g. PutHex(0x2F, 4, OLED_NUM_ZERO_PAD, ...) writes "002F"
+ * @param  value: Number to be written
+ * @param  width: Minimum characters written, padded as flags say. 0 for just the digits
+ * @param  flags: Values of @ref OLED_NUM_FLAGS_t enumeration ORed together, OLED_NUM_PLUS is ignored
+ * @param  *Font: Pointer to @ref OLED_FontDef_t structure with used font
+ * @param  color: Color used for drawing. This parameter can be a value of @ref OLED_COLOR_t enumeration
+ * @retval Zero on success or the first character that could not be written
+ */
+char OLED_SSD1306_PutHex(uint32_t value, uint8_t width, uint8_t flags, OLED_FontDef_t* Font, OLED_COLOR_t color);
+
+
+/**
+ * @brief  Puts string on OLED like @ref OLED_SSD1306_Puts(), through a cache of rendered text runs
+ * @note   Runs are kept page-major and keyed by font, string hash and color, a repeated label is one blit
+ *         with the current raster op. The least recently used run is replaced on a miss.
+ *         Call @ref OLED_SSD1306_ClearTextCache() after changing font data that lives in RAM
+ * @param  *str: UTF-8 string to be written
+ * @param  *Font: Pointer to @ref OLED_FontDef_t structure with used font
+ * @param  color: Color used for drawing. This parameter can be a value of @ref OLED_COLOR_t enumeration
+ * @retval Zero on success or character value when function failed
+ */
+char OLED_SSD1306_PutsCached(char* str, OLED_FontDef_t* Font, OLED_COLOR_t color);
+
+
+/**
+ * @brief  Drops all cached text runs and clears the counters
+ * @retval None
+ */
+void OLED_SSD1306_ClearTextCache(void);
+
+
+/**
+ * @brief  Returns the text cache counters gathered since @ref OLED_SSD1306_ClearTextCache()
+ * @param  *stats: Filled in with the current counters
+ * @retval None
+ */
+void OLED_SSD1306_GetTextCacheStats(OLED_TextCacheStats_t* stats);
+
+
 /**
  * @brief  Draws line on OLED
  * @note   @ref OLED_SSD1306_UpdateScreen() must be called after that in order to see updated LCD screen
@@ -168,6 +642,30 @@ void OLED_SSD1306_DrawLine(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, O
 
 
 
+/**
+ * @brief  Draws horizontal line on OLED
+ * @note   @ref OLED_SSD1306_UpdateScreen() must be called after that in order to see updated LCD screen
+ * @param  x: Line X start point. Valid input is 0 to OLED_WIDTH - 1
+ * @param  y: Line Y location. Valid input is 0 to OLED_HEIGHT - 1
+ * @param  w: Line length in units of pixels
+ * @param  color: Color to be used. This parameter can be a value of @ref OLED_COLOR_t enumeration
+ * @retval None
+ */
+void OLED_SSD1306_DrawHLine(uint16_t x, uint16_t y, uint16_t w, OLED_COLOR_t color);
+
+
+/**
+ * @brief  Draws vertical line on OLED
+ * @note   @ref OLED_SSD1306_UpdateScreen() must be called after that in order to see updated LCD screen
+ * @param  x: Line X location. Valid input is 0 to OLED_WIDTH - 1
+ * @param  y: Line Y start point. Valid input is 0 to OLED_HEIGHT - 1
+ * @param  h: Line length in units of pixels
+ * @param  color: Color to be used. This parameter can be a value of @ref OLED_COLOR_t enumeration
+ * @retval None
+ */
+void OLED_SSD1306_DrawVLine(uint16_t x, uint16_t y, uint16_t h, OLED_COLOR_t color);
+
+
 /**
  * @brief  Draws rectangle on OLED
  * @note   @ref OLED_SSD1306_UpdateScreen() must be called after that in order to see updated LCD screen
@@ -248,5 +746,20 @@ void OLED_SSD1306_DrawCircle(int16_t x0, int16_t y0, int16_t r, OLED_COLOR_t c);
 void OLED_SSD1306_DrawFilledCircle(int16_t x0, int16_t y0, int16_t r, OLED_COLOR_t c);
 
 
+/**
+ * @brief  Draws an 8-bit grayscale image, dithered to black and white
+ * @note   Writes whole page-major bytes of the target, 8 vertical pixels at a time. White pixels are drawn with
+ *         OLED_COLOR_WHITE and black ones with OLED_COLOR_BLACK under the current raster op, clipped like any
+ *         other primitive. Error diffusion starts at the first visible row and column and runs in strips of
+ *         OLED_DITHER_MAX_WIDTH columns.
+ *         @ref OLED_SSD1306_UpdateScreen() must be called after that in order to see updated LCD screen
+ * @param  x,y: Top left position, may be negative or partly outside the target
+ * @param  w,h: Image size in pixels
+ * @param  *src: w * h bytes, row by row, 0 is black and 255 is white
+ * @param  mode: Dithering method. This parameter can be a value of @ref OLED_DITHER_t enumeration
+ * @retval None
+ */
+void OLED_SSD1306_DrawGray8(int16_t x, int16_t y, uint16_t w, uint16_t h, const uint8_t* src, OLED_DITHER_t mode);
+
 
 #endif
@@ -0,0 +1,407 @@
+/**
+  **********************************************************************************************************************
+   * @file   : OLED_SSD1306_Anim.c
+   * @author : Sharath N
+   * @brief  : Compressed animation player for the SSD1306 OLED Driver
+  **********************************************************************************************************************
+*/
+
+#include "OLED_SSD1306_Anim.h"
+#include "stm32f4xx_hal.h"
+
+
+#define OLED_ANIM_PAGES              (OLED_HEIGHT / 8)
+
+/* Private playback state */
+typedef struct {
+	const OLED_Anim_t *Anim;
+	uint8_t Playing;
+	uint8_t Loop;
+	uint8_t X;                           /* Left column of the frames */
+	uint8_t Page;                        /* Top page of the frames */
+	uint8_t Pages;                       /* Pages per frame */
+	uint8_t Dirty;                       /* Something in DirtyX0..DirtyX1 */
+	uint8_t DirtyX0[OLED_ANIM_PAGES];    /* Changed columns per screen page, X0 > X1 when clean */
+	uint8_t DirtyX1[OLED_ANIM_PAGES];
+	uint16_t Next;                       /* Next frame to be decoded */
+	const uint8_t *Pos;                  /* Its header in the stream */
+	uint32_t Start;                      /* HAL tick at which frame 0 of this cycle is due */
+	uint32_t Behind;                     /* Frames advanced since the last flush */
+	OLED_Anim_Stats_t Stats;
+} OLED_Anim_Player_t;
+
+/* Private Variables */
+static OLED_Anim_Player_t OLED_ANIM;
+static uint8_t OLED_ANIM_Tx[OLED_CANVAS_BUFFER_SIZE(OLED_WIDTH, OLED_HEIGHT)];
+
+
+/* Header of the frame after this one */
+static const uint8_t *OLED_ANIM_NextFrame(const uint8_t *frame)
+{
+	return frame + OLED_ANIM_HEADER_SIZE + (frame[1] | (frame[2] << 8));
+}
+
+
+static void OLED_ANIM_Clean(void)
+{
+	memset(OLED_ANIM.DirtyX0, 0xFF, sizeof(OLED_ANIM.DirtyX0));
+	memset(OLED_ANIM.DirtyX1, 0x00, sizeof(OLED_ANIM.DirtyX1));
+	OLED_ANIM.Dirty = 0;
+}
+
+
+/* Decodes one frame into OLED_Buffer, only bytes that really change are written and marked dirty */
+static void OLED_ANIM_Decode(const uint8_t *frame)
+{
+	const OLED_Anim_t *anim = OLED_ANIM.Anim;
+	const uint8_t *p = frame + OLED_ANIM_HEADER_SIZE;
+	const uint8_t *end = OLED_ANIM_NextFrame(frame);
+	uint8_t key = (frame[0] == OLED_ANIM_KEYFRAME);
+	uint8_t *dst = &OLED_Buffer[OLED_ANIM.X + OLED_ANIM.Page * OLED_WIDTH];
+	uint16_t col = 0, page = OLED_ANIM.Page, n, step;
+	uint8_t c = 0, v, old;
+
+	while (page < OLED_ANIM.Page + OLED_ANIM.Pages)
+	{
+		/* Next run, a short payload skips the rest of the frame */
+		if (p < end)
+		{
+			c = *p++;
+			n = (c & 0x80) ? (c & 0x3F) + 1 : c + 1;
+		}
+		else
+		{
+			c = 0x00;
+			n = 0xFFFF;
+		}
+
+		/* Unchanged bytes of a delta frame: just move on */
+		if (!key && !(c & 0x80))
+		{
+			while (n && page < OLED_ANIM.Page + OLED_ANIM.Pages)
+			{
+				step = anim->Width - col;
+
+				if (step > n)
+				{
+					step = n;
+				}
+
+				n -= step;
+				col += step;
+
+				if (col == anim->Width)
+				{
+					col = 0;
+					page++;
+					dst += OLED_WIDTH;
+				}
+			}
+
+			continue;
+		}
+
+		for (; n && page < OLED_ANIM.Page + OLED_ANIM.Pages; n--)
+		{
+			if (!(c & 0x80))
+			{
+				v = 0x00;
+			}
+			else if (c & 0x40)
+			{
+				v = *p;
+			}
+			else
+			{
+				v = *p++;
+			}
+
+			old = dst[col];
+
+			if (!key)
+			{
+				v ^= old;
+			}
+
+			if (v != old)
+			{
+				dst[col] = v;
+
+				if (OLED_ANIM.X + col < OLED_ANIM.DirtyX0[page])
+				{
+					OLED_ANIM.DirtyX0[page] = OLED_ANIM.X + col;
+				}
+
+				if (OLED_ANIM.X + col > OLED_ANIM.DirtyX1[page])
+				{
+					OLED_ANIM.DirtyX1[page] = OLED_ANIM.X + col;
+				}
+
+				OLED_ANIM.Dirty = 1;
+			}
+
+			if (++col == anim->Width)
+			{
+				col = 0;
+				page++;
+				dst += OLED_WIDTH;
+			}
+		}
+
+		/* The fill byte */
+		if ((c & 0xC0) == 0xC0)
+		{
+			p++;
+		}
+	}
+}
+
+
+/* Called from the I2C interrupt at the end of a flush */
+static void OLED_ANIM_FlushDone(uint8_t error)
+{
+	if (error)
+	{
+		OLED_ANIM.Stats.Errors++;
+	}
+}
+
+
+/* Sends the bounding window of the dirty columns and pages, one transfer */
+static void OLED_ANIM_Flush(void)
+{
+	uint8_t p, p0 = 0xFF, p1 = 0, x0 = 0xFF, x1 = 0;
+	uint16_t w, len;
+	const uint8_t *data;
+
+	for (p = 0; p < OLED_ANIM_PAGES; p++)
+	{
+		if (OLED_ANIM.DirtyX0[p] <= OLED_ANIM.DirtyX1[p])
+		{
+			if (p0 == 0xFF)
+			{
+				p0 = p;
+			}
+
+			p1 = p;
+
+			if (OLED_ANIM.DirtyX0[p] < x0)
+			{
+				x0 = OLED_ANIM.DirtyX0[p];
+			}
+
+			if (OLED_ANIM.DirtyX1[p] > x1)
+			{
+				x1 = OLED_ANIM.DirtyX1[p];
+			}
+		}
+	}
+
+	w = x1 - x0 + 1;
+	len = w * (p1 - p0 + 1);
+
+	/* Full width windows are contiguous in OLED_Buffer, narrower ones are gathered page by page */
+	if (w == OLED_WIDTH)
+	{
+		data = &OLED_Buffer[p0 * OLED_WIDTH];
+	}
+	else
+	{
+		for (p = p0; p <= p1; p++)
+		{
+			memcpy(&OLED_ANIM_Tx[(p - p0) * w], &OLED_Buffer[x0 + p * OLED_WIDTH], w);
+		}
+
+		data = OLED_ANIM_Tx;
+	}
+
+	OLED_SSD1306_SetWindow(x0, x1, p0, p1);
+
+	if (OLED_SSD1306_Send_DataAsync(data, len, OLED_ANIM_FlushDone))
+	{
+		OLED_ANIM.Stats.Shown++;
+		OLED_ANIM.Stats.Skipped += OLED_ANIM.Behind - 1;
+		OLED_ANIM.Stats.Bytes += len;
+	}
+	else
+	{
+		OLED_ANIM.Stats.Errors++;
+	}
+
+	OLED_ANIM.Behind = 0;
+	OLED_ANIM_Clean();
+}
+
+
+/**
+ * @brief  Starts playing an animation, frames are decoded and sent from @ref OLED_ANIM_Poll()
+ * @note   Frames are drawn in panel coordinates, rotation and raster op do not apply.
+ *         Do not call @ref OLED_SSD1306_UpdateScreen() while the animation is playing
+ * @param  *anim: Animation to be played
+ * @param  x: Left column of the frames
+ * @param  page: Top page of the frames, 0 to OLED_HEIGHT / 8 - 1
+ * @param  loop: 1 to start over after the last frame, 0 to stop there
+ * @retval 1 on success, 0 if the frames do not fit on the screen at x, page
+ */
+uint8_t OLED_ANIM_Play(const OLED_Anim_t* anim, uint8_t x, uint8_t page, uint8_t loop)
+{
+	uint8_t pages = (anim->Height + 7) / 8;
+
+	if (anim->Frames == 0 || anim->FrameMs == 0 || anim->Width == 0 || pages == 0 ||
+	    x + anim->Width > OLED_WIDTH || page + pages > OLED_ANIM_PAGES || anim->Data[0] != OLED_ANIM_KEYFRAME)
+	{
+		return 0;
+	}
+
+	OLED_ANIM_Stop();
+
+	OLED_ANIM.Anim = anim;
+	OLED_ANIM.Loop = loop;
+	OLED_ANIM.X = x;
+	OLED_ANIM.Page = page;
+	OLED_ANIM.Pages = pages;
+	OLED_ANIM.Next = 0;
+	OLED_ANIM.Pos = anim->Data;
+	OLED_ANIM.Behind = 0;
+	OLED_ANIM_Clean();
+	OLED_ANIM_ResetStats();
+
+	OLED_ANIM.Start = HAL_GetTick();
+	OLED_ANIM.Playing = 1;
+
+	return 1;
+}
+
+
+/**
+ * @brief  Stops the animation after the flush on the bus, the last frame shown stays on the panel
+ * @retval None
+ */
+void OLED_ANIM_Stop(void)
+{
+	OLED_ANIM.Playing = 0;
+
+	while (OLED_SSD1306_IsBusy())
+	{
+	}
+}
+
+
+/**
+ * @brief  Decodes the frames that are due and sends what changed if the bus is free
+ * @note   Call it from the main loop as often as possible, it returns at once when there is nothing to do
+ * @retval 1 while the animation is playing, 0 once it has ended or was stopped
+ */
+uint8_t OLED_ANIM_Poll(void)
+{
+	const OLED_Anim_t *anim = OLED_ANIM.Anim;
+	const uint8_t *frame, *start;
+	uint32_t due, f, first;
+
+	if (!OLED_ANIM.Playing)
+	{
+		return 0;
+	}
+
+	due = (HAL_GetTick() - OLED_ANIM.Start) / anim->FrameMs;
+
+	if (due >= anim->Frames)
+	{
+		if (OLED_ANIM.Loop)
+		{
+			/* Over into the next cycle: the rest of this one is dropped, frame 0 is a keyframe */
+			OLED_ANIM.Stats.Jumped += anim->Frames - OLED_ANIM.Next;
+			OLED_ANIM.Behind += anim->Frames - OLED_ANIM.Next;
+			OLED_ANIM.Start += (due / anim->Frames) * anim->Frames * anim->FrameMs;
+			due %= anim->Frames;
+			OLED_ANIM.Next = 0;
+			OLED_ANIM.Pos = anim->Data;
+		}
+		else
+		{
+			due = anim->Frames - 1;
+		}
+	}
+
+	if (due >= OLED_ANIM.Next)
+	{
+		/* Nothing before the latest due keyframe matters */
+		frame = OLED_ANIM.Pos;
+		start = frame;
+		first = OLED_ANIM.Next;
+
+		for (f = OLED_ANIM.Next; f <= due; f++)
+		{
+			if (frame[0] == OLED_ANIM_KEYFRAME)
+			{
+				start = frame;
+				first = f;
+			}
+
+			frame = OLED_ANIM_NextFrame(frame);
+		}
+
+		OLED_ANIM.Stats.Jumped += first - OLED_ANIM.Next;
+
+		for (f = first, frame = start; f <= due; f++)
+		{
+			OLED_ANIM_Decode(frame);
+			frame = OLED_ANIM_NextFrame(frame);
+			OLED_ANIM.Stats.Decoded++;
+		}
+
+		OLED_ANIM.Behind += due + 1 - OLED_ANIM.Next;
+		OLED_ANIM.Next = due + 1;
+		OLED_ANIM.Pos = frame;
+	}
+
+	if (!OLED_ANIM.Dirty)
+	{
+		/* Frames without changes are on the panel already */
+		OLED_ANIM.Behind = 0;
+
+		if (!OLED_ANIM.Loop && OLED_ANIM.Next == anim->Frames)
+		{
+			OLED_ANIM.Playing = 0;
+		}
+	}
+	else if (!OLED_SSD1306_IsBusy())
+	{
+		OLED_ANIM_Flush();
+	}
+
+	return OLED_ANIM.Playing;
+}
+
+
+/**
+ * @brief  Returns the playback figures gathered since @ref OLED_ANIM_Play() or @ref OLED_ANIM_ResetStats()
+ * @param  *stats: Filled in with the current figures
+ * @retval None
+ */
+void OLED_ANIM_GetStats(OLED_Anim_Stats_t* stats)
+{
+	uint32_t primask = __get_PRIMASK();
+
+	__disable_irq();
+
+	*stats = OLED_ANIM.Stats;
+
+	__set_PRIMASK(primask);
+}
+
+
+/**
+ * @brief  Clears the playback figures
+ * @retval None
+ */
+void OLED_ANIM_ResetStats(void)
+{
+	uint32_t primask = __get_PRIMASK();
+
+	__disable_irq();
+
+	memset(&OLED_ANIM.Stats, 0, sizeof(OLED_ANIM.Stats));
+
+	__set_PRIMASK(primask);
+}
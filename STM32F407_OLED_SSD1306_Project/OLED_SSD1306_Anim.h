@@ -0,0 +1,112 @@
+/**
+  **********************************************************************************************************************
+   * @file   : OLED_SSD1306_Anim.h
+   * @author : Sharath N
+   * @brief  : Compressed animation player for the SSD1306 OLED Driver
+  **********************************************************************************************************************
+*/
+
+/*
+          An animation is a stream of frames in the driver's page-major layout. Every frame starts with a
+          3 byte header, its type and its payload length (little endian), so the player can step over frames
+          without decoding them:
+
+              OLED_ANIM_KEYFRAME     payload rebuilds the frame from black
+              OLED_ANIM_DELTA        payload is XORed onto the previous frame
+
+          The payload covers the Width x pages bytes of a frame in order, with three kinds of runs:
+
+              0x00 - 0x7F   skip    c + 1 bytes        (black in a keyframe, unchanged in a delta)
+              0x80 - 0xBF   copy    (c & 0x3F) + 1 literal bytes follow
+              0xC0 - 0xFF   fill    (c & 0x3F) + 1 bytes with the byte that follows
+
+          A payload may end early, the rest of the frame is then skipped. Frame 0 is always a keyframe.
+          Tools/OLED_AnimEncoder turns a sequence of PBM/PGM frames into such a stream.
+
+          The player decodes straight into OLED_Buffer, keeps a dirty column range per page and sends only
+          the bounding window of what changed with OLED_SSD1306_Send_DataAsync(). When the bus falls behind,
+          due frames are still decoded (or jumped over to the latest due keyframe) but shown together with
+          the next flush, so playback keeps its speed and drops frames instead of drifting.
+*/
+
+#ifndef OLED_SSD1306_ANIM_H
+#define OLED_SSD1306_ANIM_H
+
+#include <stdint.h>
+#include "STM32F407_OLED_SSD1306_Driver.h"
+
+#define OLED_ANIM_KEYFRAME           0x00
+#define OLED_ANIM_DELTA              0x01
+
+#define OLED_ANIM_HEADER_SIZE        3     // Type and 16 bit payload length in front of every frame
+
+
+/**
+ * @brief  Compressed animation, usually generated by Tools/OLED_AnimEncoder and kept in flash
+ */
+typedef struct {
+	uint16_t Width;       /*!< Frame width in pixels */
+	uint16_t Height;      /*!< Frame height in pixels, drawn in whole pages */
+	uint16_t Frames;      /*!< Number of frames in Data */
+	uint16_t FrameMs;     /*!< Time between two frames in milliseconds */
+	const uint8_t *Data;  /*!< Frame stream, see the top of this file */
+} OLED_Anim_t;
+
+
+/**
+ * @brief  Playback figures, for tuning the frame rate against bus load
+ */
+typedef struct {
+	uint32_t Decoded;     /*!< Frames decoded into OLED_Buffer */
+	uint32_t Jumped;      /*!< Frames stepped over to reach a later keyframe */
+	uint32_t Shown;       /*!< Flushes sent to the panel */
+	uint32_t Skipped;     /*!< Frames that were due but never reached the panel on their own */
+	uint32_t Bytes;       /*!< Display data bytes sent */
+	uint32_t Errors;      /*!< Flushes that failed on the bus */
+} OLED_Anim_Stats_t;
+
+
+/**
+ * @brief  Starts playing an animation, frames are decoded and sent from @ref OLED_ANIM_Poll()
+ * @note   Frames are drawn in panel coordinates, rotation and raster op do not apply.
+ *         Do not call @ref OLED_SSD1306_UpdateScreen() while the animation is playing
+ * @param  *anim: Animation to be played
+ * @param  x: Left column of the frames
+ * @param  page: Top page of the frames, 0 to OLED_HEIGHT / 8 - 1
+ * @param  loop: 1 to start over after the last frame, 0 to stop there
+ * @retval 1 on success, 0 if the frames do not fit on the screen at x, page
+ */
+uint8_t OLED_ANIM_Play(const OLED_Anim_t* anim, uint8_t x, uint8_t page, uint8_t loop);
+
+
+/**
+ * @brief  Stops the animation after the flush on the bus, the last frame shown stays on the panel
+ * @retval None
+ */
+void OLED_ANIM_Stop(void);
+
+
+/**
+ * @brief  Decodes the frames that are due and sends what changed if the bus is free
+ * @note   Call it from the main loop as often as possible, it returns at once when there is nothing to do
+ * @retval 1 while the animation is playing, 0 once it has ended or was stopped
+ */
+uint8_t OLED_ANIM_Poll(void);
+
+
+/**
+ * @brief  Returns the playback figures gathered since @ref OLED_ANIM_Play() or @ref OLED_ANIM_ResetStats()
+ * @param  *stats: Filled in with the current figures
+ * @retval None
+ */
+void OLED_ANIM_GetStats(OLED_Anim_Stats_t* stats);
+
+
+/**
+ * @brief  Clears the playback figures
+ * @retval None
+ */
+void OLED_ANIM_ResetStats(void);
+
+
+#endif
@@ -9,6 +9,10 @@
 #include "OLED_SSD1306_Fonts.h"
 
 
+/* The full font tables. Builds defining OLED_FONTS_SUBSET link the subset fonts generated by
+   Tools/OLED_FontSubset instead, with the same names */
+#ifndef OLED_FONTS_SUBSET
+
 const uint16_t OLED_Font7x10 [] = {
 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,  // sp
 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x0000, 0x1000, 0x0000, 0x0000,  // !
@@ -105,6 +109,47 @@ const uint16_t OLED_Font7x10 [] = {
 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,  // |
 0x3000, 0x1000, 0x1000, 0x1000, 0x0800, 0x0800, 0x1000, 0x1000, 0x1000, 0x3000,  // }
 0x0000, 0x0000, 0x0000, 0x7400, 0x4C00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,  // ~
+0x3000, 0x4800, 0x4800, 0x3000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,  // U+00B0
+0x0000, 0x0000, 0x4400, 0x4400, 0x4400, 0x4400, 0x4C00, 0x7400, 0x4000, 0x4000,  // U+00B5
+0x3800, 0x4400, 0x4400, 0x4400, 0x4400, 0x2800, 0x2800, 0x6C00, 0x0000, 0x0000,  // U+03A9
+0x2800, 0x7C00, 0x4000, 0x4000, 0x7800, 0x4000, 0x4000, 0x7C00, 0x0000, 0x0000,  // U+0401
+0x1000, 0x2800, 0x2800, 0x2800, 0x2800, 0x7C00, 0x4400, 0x4400, 0x0000, 0x0000,  // U+0410
+0x7C00, 0x4000, 0x4000, 0x7800, 0x4400, 0x4400, 0x4400, 0x7800, 0x0000, 0x0000,  // U+0411
+0x7800, 0x4400, 0x4400, 0x7800, 0x4400, 0x4400, 0x4400, 0x7800, 0x0000, 0x0000,  // U+0412
+0x7C00, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x0000, 0x0000,  // U+0413
+0x3C00, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x4400, 0xFE00, 0x8200, 0x0000,  // U+0414
+0x7C00, 0x4000, 0x4000, 0x7C00, 0x4000, 0x4000, 0x4000, 0x7C00, 0x0000, 0x0000,  // U+0415
+0x9200, 0x9200, 0x5400, 0x3800, 0x5400, 0x9200, 0x9200, 0x9200, 0x0000, 0x0000,  // U+0416
+0x3800, 0x4400, 0x0400, 0x1800, 0x0400, 0x0400, 0x4400, 0x3800, 0x0000, 0x0000,  // U+0417
+0x4400, 0x4400, 0x4C00, 0x5400, 0x5400, 0x6400, 0x4400, 0x4400, 0x0000, 0x0000,  // U+0418
+0x3800, 0x4400, 0x4C00, 0x4C00, 0x5400, 0x6400, 0x6400, 0x4400, 0x0000, 0x0000,  // U+0419
+0x4400, 0x4800, 0x5000, 0x6000, 0x5000, 0x4800, 0x4800, 0x4400, 0x0000, 0x0000,  // U+041A
+0x1C00, 0x2400, 0x2400, 0x2400, 0x2400, 0x2400, 0x4400, 0x8400, 0x0000, 0x0000,  // U+041B
+0x4400, 0x6C00, 0x6C00, 0x5400, 0x4400, 0x4400, 0x4400, 0x4400, 0x0000, 0x0000,  // U+041C
+0x4400, 0x4400, 0x4400, 0x7C00, 0x4400, 0x4400, 0x4400, 0x4400, 0x0000, 0x0000,  // U+041D
+0x3800, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x3800, 0x0000, 0x0000,  // U+041E
+0x7C00, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x0000, 0x0000,  // U+041F
+0x7800, 0x4400, 0x4400, 0x4400, 0x7800, 0x4000, 0x4000, 0x4000, 0x0000, 0x0000,  // U+0420
+0x3800, 0x4400, 0x4000, 0x4000, 0x4000, 0x4000, 0x4400, 0x3800, 0x0000, 0x0000,  // U+0421
+0x7C00, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x0000, 0x0000,  // U+0422
+0x4400, 0x4400, 0x4400, 0x2400, 0x1C00, 0x0400, 0x4400, 0x3800, 0x0000, 0x0000,  // U+0423
+0x1000, 0x7C00, 0x9200, 0x9200, 0x9200, 0x7C00, 0x1000, 0x1000, 0x0000, 0x0000,  // U+0424
+0x4400, 0x2800, 0x2800, 0x1000, 0x1000, 0x2800, 0x2800, 0x4400, 0x0000, 0x0000,  // U+0425
+0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x7E00, 0x0200, 0x0000,  // U+0426
+0x4400, 0x4400, 0x4400, 0x4400, 0x3C00, 0x0400, 0x0400, 0x0400, 0x0000, 0x0000,  // U+0427
+0x5400, 0x5400, 0x5400, 0x5400, 0x5400, 0x5400, 0x5400, 0x7C00, 0x0000, 0x0000,  // U+0428
+0x5400, 0x5400, 0x5400, 0x5400, 0x5400, 0x5400, 0x5400, 0x7E00, 0x0200, 0x0000,  // U+0429
+0xC000, 0x4000, 0x4000, 0x7800, 0x4400, 0x4400, 0x4400, 0x7800, 0x0000, 0x0000,  // U+042A
+0x8200, 0x8200, 0x8200, 0xF200, 0x8A00, 0x8A00, 0x8A00, 0xF200, 0x0000, 0x0000,  // U+042B
+0x4000, 0x4000, 0x4000, 0x7800, 0x4400, 0x4400, 0x4400, 0x7800, 0x0000, 0x0000,  // U+042C
+0x3800, 0x4400, 0x0400, 0x3C00, 0x0400, 0x0400, 0x4400, 0x3800, 0x0000, 0x0000,  // U+042D
+0x9800, 0xA400, 0xA400, 0xE400, 0xA400, 0xA400, 0xA400, 0x9800, 0x0000, 0x0000,  // U+042E
+0x3C00, 0x4400, 0x4400, 0x3C00, 0x1400, 0x2400, 0x4400, 0x4400, 0x0000, 0x0000,  // U+042F
+0x0000, 0x0000, 0x2000, 0x4000, 0xFE00, 0x4000, 0x2000, 0x0000, 0x0000, 0x0000,  // U+2190
+0x1000, 0x3800, 0x5400, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x0000, 0x0000,  // U+2191
+0x0000, 0x0000, 0x0800, 0x0400, 0xFE00, 0x0400, 0x0800, 0x0000, 0x0000, 0x0000,  // U+2192
+0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x5400, 0x3800, 0x1000, 0x0000, 0x0000,  // U+2193
+0x7C00, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x7C00, 0x0000, 0x0000,  // fallback box
 };
 
 const uint16_t OLED_Font11x18 [] = {
@@ -303,20 +348,1399 @@ const uint16_t OLED_Font16x26 [] = {
 0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x3F07,0x7FC7,0x73E7,0xF1FF,0xF07E,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000, // Ascii = [~]
 };
 
+/* The same glyphs pre-transposed to the display's page-major layout: FontWidth column bytes per page,
+   (FontHeight + 7) / 8 pages per character, bit 0 is the top row of a page. Generated from the tables above */
+const uint8_t OLED_Font7x10_Pages [] = {
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // sp
+0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '!'
+0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '"'
+0x00, 0xF4, 0x2F, 0x24, 0xF4, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '#'
+0x00, 0x66, 0x89, 0xFF, 0x89, 0x72, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,  // '$'
+0x00, 0x26, 0x19, 0x6E, 0x94, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '%'
+0x00, 0x60, 0x96, 0x99, 0x66, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '&'
+0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '''
+0x00, 0x00, 0xFC, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00,  // '('
+0x00, 0x00, 0x01, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00,  // ')'
+0x00, 0x00, 0x0A, 0x07, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '*'
+0x00, 0x10, 0x10, 0x7C, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '+'
+0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,  // ','
+0x00, 0x00, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '-'
+0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '.'
+0x00, 0x00, 0xC0, 0x3C, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '/'
+0x00, 0x7E, 0x81, 0x89, 0x81, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '0'
+0x00, 0x04, 0x02, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '1'
+0x00, 0x86, 0xC1, 0xA1, 0x91, 0x8E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '2'
+0x00, 0x42, 0x81, 0x89, 0x89, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '3'
+0x00, 0x30, 0x2C, 0x22, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '4'
+0x00, 0x4F, 0x89, 0x89, 0x89, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '5'
+0x00, 0x7E, 0x89, 0x89, 0x89, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '6'
+0x00, 0x01, 0xE1, 0x19, 0x05, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '7'
+0x00, 0x76, 0x89, 0x89, 0x89, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '8'
+0x00, 0x4E, 0x91, 0x91, 0x91, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '9'
+0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // ':'
+0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,  // ';'
+0x00, 0x10, 0x28, 0x28, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '<'
+0x00, 0x28, 0x28, 0x28, 0x28, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '='
+0x00, 0x44, 0x44, 0x28, 0x28, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '>'
+0x00, 0x02, 0x01, 0xB1, 0x09, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '?'
+0x00, 0x7E, 0x81, 0x99, 0x95, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '@'
+0x00, 0xE0, 0x3E, 0x21, 0x3E, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'A'
+0x00, 0xFF, 0x89, 0x89, 0x89, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'B'
+0x00, 0x7E, 0x81, 0x81, 0x81, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'C'
+0x00, 0xFF, 0x81, 0x81, 0x42, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'D'
+0x00, 0xFF, 0x89, 0x89, 0x89, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'E'
+0x00, 0xFF, 0x09, 0x09, 0x09, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'F'
+0x00, 0x7E, 0x81, 0x91, 0x91, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'G'
+0x00, 0xFF, 0x08, 0x08, 0x08, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'H'
+0x00, 0x00, 0x81, 0xFF, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'I'
+0x00, 0x40, 0x80, 0x80, 0x80, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'J'
+0x00, 0xFF, 0x08, 0x14, 0x62, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'K'
+0x00, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'L'
+0x00, 0xFF, 0x06, 0x08, 0x06, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'M'
+0x00, 0xFF, 0x06, 0x18, 0x60, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'N'
+0x00, 0x7E, 0x81, 0x81, 0x81, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'O'
+0x00, 0xFF, 0x11, 0x11, 0x11, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'P'
+0x00, 0x7E, 0x81, 0xC1, 0x81, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,  // 'Q'
+0x00, 0xFF, 0x11, 0x11, 0x71, 0x8E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'R'
+0x00, 0x46, 0x89, 0x89, 0x91, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'S'
+0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'T'
+0x00, 0x7F, 0x80, 0x80, 0x80, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'U'
+0x00, 0x07, 0x38, 0xC0, 0x38, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'V'
+0x00, 0x3F, 0xE0, 0x1C, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'W'
+0x00, 0x81, 0x66, 0x18, 0x66, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'X'
+0x00, 0x03, 0x0C, 0xF0, 0x0C, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'Y'
+0x00, 0xC1, 0xA1, 0x99, 0x85, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'Z'
+0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x00, 0x00,  // '['
+0x00, 0x00, 0x03, 0x3C, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '\'
+0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00,  // ']'
+0x00, 0x08, 0x06, 0x01, 0x06, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '^'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,  // '_'
+0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '`'
+0x00, 0x68, 0x94, 0x94, 0x54, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'a'
+0x00, 0xFF, 0x48, 0x84, 0x84, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'b'
+0x00, 0x78, 0x84, 0x84, 0x84, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'c'
+0x00, 0x78, 0x84, 0x84, 0x48, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'd'
+0x00, 0x78, 0x94, 0x94, 0x94, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'e'
+0x00, 0x04, 0x04, 0xFE, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'f'
+0x00, 0x78, 0x84, 0x84, 0x48, 0xFC, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x01, 0x00,  // 'g'
+0x00, 0xFF, 0x08, 0x04, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'h'
+0x00, 0x04, 0x04, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'i'
+0x00, 0x04, 0x04, 0xFD, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x01, 0x00, 0x00, 0x00,  // 'j'
+0x00, 0xFF, 0x10, 0x28, 0x44, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'k'
+0x00, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'l'
+0x00, 0xFC, 0x04, 0xFC, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'm'
+0x00, 0xFC, 0x08, 0x04, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'n'
+0x00, 0x78, 0x84, 0x84, 0x84, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'o'
+0x00, 0xFC, 0x48, 0x84, 0x84, 0x78, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'p'
+0x00, 0x78, 0x84, 0x84, 0x48, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,  // 'q'
+0x00, 0xFC, 0x08, 0x04, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'r'
+0x00, 0x48, 0x94, 0x94, 0xA4, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 's'
+0x00, 0x04, 0x7F, 0x84, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 't'
+0x00, 0x7C, 0x80, 0x80, 0x40, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'u'
+0x00, 0x0C, 0x70, 0x80, 0x70, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'v'
+0x00, 0x3C, 0xE0, 0x1C, 0xE0, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'w'
+0x00, 0x84, 0x48, 0x30, 0x48, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'x'
+0x00, 0x0C, 0x30, 0xC0, 0x30, 0x0C, 0x00, 0x00, 0x02, 0x02, 0x01, 0x00, 0x00, 0x00,  // 'y'
+0x00, 0xC4, 0xA4, 0x94, 0x8C, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'z'
+0x00, 0x00, 0x30, 0xCF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x00, 0x00,  // '{'
+0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,  // '|'
+0x00, 0x00, 0x01, 0xCF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00,  // '}'
+0x00, 0x18, 0x08, 0x08, 0x10, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '~'
+0x00, 0x06, 0x09, 0x09, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // U+00B0
+0x00, 0xFC, 0x80, 0x80, 0x40, 0xFC, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,  // U+00B5
+0x00, 0x9E, 0xE1, 0x01, 0xE1, 0x9E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // U+03A9
+0x00, 0xFE, 0x93, 0x92, 0x93, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // U+0401
+0x00, 0xE0, 0x3E, 0x21, 0x3E, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // U+0410
+0x00, 0xFF, 0x89, 0x89, 0x89, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // U+0411
+0x00, 0xFF, 0x89, 0x89, 0x89, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // U+0412
+0x00, 0xFF, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // U+0413
+0x80, 0xC0, 0xBF, 0x81, 0x81, 0xFF, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,  // U+0414
+0x00, 0xFF, 0x89, 0x89, 0x89, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // U+0415
+0xE3, 0x14, 0x08, 0xFF, 0x08, 0x14, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // U+0416
+0x00, 0x42, 0x81, 0x89, 0x89, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // U+0417
+0x00, 0xFF, 0x20, 0x18, 0x04, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // U+0418
+0x00, 0xFE, 0x61, 0x11, 0x0D, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // U+0419
+0x00, 0xFF, 0x08, 0x14, 0x62, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // U+041A
+0x80, 0x40, 0x3E, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // U+041B
+0x00, 0xFF, 0x06, 0x08, 0x06, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // U+041C
+0x00, 0xFF, 0x08, 0x08, 0x08, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // U+041D
+0x00, 0x7E, 0x81, 0x81, 0x81, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // U+041E
+0x00, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // U+041F
+0x00, 0xFF, 0x11, 0x11, 0x11, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // U+0420
+0x00, 0x7E, 0x81, 0x81, 0x81, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // U+0421
+0x00, 0x01, 0x01, 0xFF, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // U+0422
+0x00, 0x47, 0x88, 0x90, 0x90, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // U+0423
+0x1C, 0x22, 0x22, 0xFF, 0x22, 0x22, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // U+0424
+0x00, 0x81, 0x66, 0x18, 0x66, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // U+0425
+0x00, 0xFF, 0x80, 0x80, 0x80, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,  // U+0426
+0x00, 0x0F, 0x10, 0x10, 0x10, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // U+0427
+0x00, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // U+0428
+0x00, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,  // U+0429
+0x01, 0xFF, 0x88, 0x88, 0x88, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // U+042A
+0xFF, 0x88, 0x88, 0x88, 0x70, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // U+042B
+0x00, 0xFF, 0x88, 0x88, 0x88, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // U+042C
+0x00, 0x42, 0x89, 0x89, 0x89, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // U+042D
+0xFF, 0x08, 0x7E, 0x81, 0x81, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // U+042E
+0x00, 0xC6, 0x29, 0x19, 0x09, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // U+042F
+0x10, 0x38, 0x54, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // U+2190
+0x00, 0x04, 0x02, 0xFF, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // U+2191
+0x10, 0x10, 0x10, 0x10, 0x54, 0x38, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // U+2192
+0x00, 0x20, 0x40, 0xFF, 0x40, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // U+2193
+0x00, 0xFF, 0x81, 0x81, 0x81, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // fallback box
+};
+
+const uint8_t OLED_Font11x18_Pages [] = {
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // sp
+0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '!'
+0x00, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '"'
+0x00, 0x60, 0x60, 0xFE, 0xFE, 0x60, 0x60, 0xFE, 0xFE, 0x60, 0x00, 0x00, 0x06, 0x7F, 0x7F, 0x06, 0x06, 0x7F, 0x7F, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '#'
+0x00, 0x38, 0x7C, 0xEE, 0xC6, 0xFE, 0x86, 0x1C, 0x18, 0x00, 0x00, 0x00, 0x1C, 0x3C, 0x70, 0x60, 0xFF, 0x61, 0x3F, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,  // '$'
+0x3C, 0x7E, 0x42, 0x7E, 0x3C, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x00, 0x00, 0x18, 0x0C, 0x06, 0x03, 0x3D, 0x7E, 0x42, 0x7E, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '%'
+0x00, 0x00, 0x3C, 0x7E, 0xC6, 0xC6, 0x7E, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x3F, 0x61, 0x61, 0x63, 0x36, 0x1C, 0x7F, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '&'
+0x00, 0x00, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '''
+0x00, 0x00, 0x00, 0x00, 0xC0, 0xF8, 0x1C, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x7F, 0xE0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00,  // '('
+0x00, 0x00, 0x01, 0x06, 0x1C, 0xF8, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xE0, 0x7F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // ')'
+0x00, 0x00, 0x2C, 0x38, 0x1E, 0x1E, 0x38, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '*'
+0x80, 0x80, 0x80, 0x80, 0xF8, 0xF8, 0x80, 0x80, 0x80, 0x80, 0x00, 0x01, 0x01, 0x01, 0x01, 0x1F, 0x1F, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '+'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,  // ','
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '-'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '.'
+0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFE, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x7F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '/'
+0x00, 0xF0, 0xFC, 0x0E, 0x86, 0x86, 0x0E, 0xFC, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x3F, 0x70, 0x61, 0x61, 0x70, 0x3F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '0'
+0x00, 0x00, 0x30, 0x18, 0x0C, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '1'
+0x00, 0x38, 0x3C, 0x0E, 0x06, 0x06, 0x8E, 0xFC, 0x78, 0x00, 0x00, 0x00, 0x70, 0x78, 0x6C, 0x66, 0x63, 0x61, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '2'
+0x00, 0x18, 0x1C, 0x06, 0xC6, 0xC6, 0xFC, 0x38, 0x00, 0x00, 0x00, 0x00, 0x18, 0x38, 0x70, 0x60, 0x60, 0x71, 0x3F, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '3'
+0x00, 0x00, 0x80, 0xF0, 0x3C, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x0F, 0x0D, 0x0C, 0x7F, 0x7F, 0x0C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '4'
+0x00, 0xFE, 0xFE, 0x86, 0xC6, 0xC6, 0xC6, 0x86, 0x00, 0x00, 0x00, 0x00, 0x19, 0x39, 0x70, 0x60, 0x60, 0x71, 0x3F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '5'
+0x00, 0xF0, 0xFC, 0x8E, 0xC6, 0xC6, 0xCE, 0x9C, 0x18, 0x00, 0x00, 0x00, 0x0F, 0x3F, 0x71, 0x60, 0x60, 0x71, 0x3F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '6'
+0x00, 0x06, 0x06, 0x06, 0x06, 0xC6, 0xF6, 0x3E, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x7F, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '7'
+0x00, 0x38, 0x7C, 0x86, 0x86, 0x86, 0x8E, 0x7C, 0x38, 0x00, 0x00, 0x00, 0x1E, 0x3F, 0x61, 0x61, 0x61, 0x61, 0x3F, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '8'
+0x00, 0xF8, 0xFC, 0x8E, 0x06, 0x06, 0x8E, 0xFC, 0xF0, 0x00, 0x00, 0x00, 0x18, 0x39, 0x73, 0x63, 0x63, 0x71, 0x3F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '9'
+0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // ':'
+0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,  // ';'
+0x00, 0x00, 0x80, 0x80, 0xC0, 0x40, 0x60, 0x20, 0x30, 0x00, 0x00, 0x00, 0x01, 0x03, 0x02, 0x06, 0x04, 0x0C, 0x08, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '<'
+0x00, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x00, 0x00, 0x00, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '='
+0x00, 0x30, 0x20, 0x60, 0x40, 0xC0, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x18, 0x08, 0x0C, 0x04, 0x06, 0x02, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '>'
+0x00, 0x18, 0x1C, 0x0E, 0x06, 0x06, 0x86, 0xCE, 0xFC, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6E, 0x6F, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '?'
+0x00, 0xF0, 0xFC, 0x1E, 0xC6, 0xC6, 0x66, 0xFC, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0x3F, 0x70, 0x63, 0x67, 0x36, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '@'
+0x00, 0x00, 0x80, 0xF8, 0x7E, 0x06, 0x7E, 0xF8, 0x80, 0x00, 0x00, 0x00, 0x70, 0x7F, 0x0F, 0x06, 0x06, 0x06, 0x0F, 0x7F, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'A'
+0x00, 0xFE, 0xFE, 0x86, 0x86, 0x86, 0xFC, 0x78, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x61, 0x61, 0x61, 0x73, 0x3E, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'B'
+0x00, 0xF0, 0xFC, 0x0E, 0x06, 0x06, 0x06, 0x1C, 0x18, 0x00, 0x00, 0x00, 0x0F, 0x3F, 0x70, 0x60, 0x60, 0x60, 0x38, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'C'
+0x00, 0xFE, 0xFE, 0x06, 0x06, 0x06, 0x1C, 0xFC, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x60, 0x60, 0x60, 0x38, 0x1F, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'D'
+0x00, 0xFE, 0xFE, 0x86, 0x86, 0x86, 0x86, 0x86, 0x06, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x61, 0x61, 0x61, 0x61, 0x61, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'E'
+0x00, 0xFE, 0xFE, 0x86, 0x86, 0x86, 0x86, 0x86, 0x06, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'F'
+0x00, 0xF0, 0xFC, 0x0E, 0x06, 0x06, 0x06, 0x1C, 0x18, 0x00, 0x00, 0x00, 0x0F, 0x3F, 0x70, 0x60, 0x60, 0x63, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'G'
+0x00, 0xFE, 0xFE, 0x80, 0x80, 0x80, 0x80, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x01, 0x01, 0x01, 0x01, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'H'
+0x00, 0x00, 0x06, 0x06, 0xFE, 0xFE, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x7F, 0x7F, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'I'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x1C, 0x3C, 0x70, 0x60, 0x60, 0x70, 0x3F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'J'
+0x00, 0xFE, 0xFE, 0x80, 0xC0, 0x70, 0x38, 0x0C, 0x06, 0x02, 0x00, 0x00, 0x7F, 0x7F, 0x01, 0x01, 0x07, 0x0E, 0x38, 0x70, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'K'
+0x00, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'L'
+0x00, 0xFE, 0xFE, 0x1E, 0xF8, 0x80, 0xF8, 0x0E, 0xFE, 0xFE, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x01, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'M'
+0x00, 0xFE, 0xFE, 0x3E, 0xF8, 0xC0, 0x00, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x01, 0x1F, 0x7C, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'N'
+0x00, 0xF0, 0xFC, 0x0E, 0x06, 0x06, 0x0E, 0xFC, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x3F, 0x70, 0x60, 0x60, 0x70, 0x3F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'O'
+0x00, 0xFE, 0xFE, 0x06, 0x06, 0x06, 0x8E, 0xFC, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x03, 0x03, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'P'
+0x00, 0xF0, 0xFC, 0x0E, 0x06, 0x06, 0x0E, 0xFC, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x3F, 0x70, 0x60, 0x6C, 0x78, 0x3F, 0x2F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'Q'
+0x00, 0xFE, 0xFE, 0x86, 0x86, 0x86, 0xCE, 0xFC, 0x78, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x01, 0x01, 0x03, 0x0F, 0x3C, 0x70, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'R'
+0x00, 0x00, 0x78, 0xFC, 0xC6, 0x86, 0x86, 0x1C, 0x18, 0x00, 0x00, 0x00, 0x0C, 0x3C, 0x70, 0x60, 0x61, 0x63, 0x3F, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'S'
+0x06, 0x06, 0x06, 0x06, 0xFE, 0xFE, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'T'
+0x00, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0x3F, 0x70, 0x60, 0x60, 0x70, 0x3F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'U'
+0x00, 0x0E, 0x7E, 0xF0, 0x80, 0x00, 0x80, 0xF0, 0x7E, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x07, 0x3F, 0x78, 0x3F, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'V'
+0x7E, 0xFE, 0x00, 0x00, 0xC0, 0xC0, 0x00, 0x00, 0xFE, 0x7E, 0x00, 0x00, 0x7F, 0x70, 0x1E, 0x03, 0x03, 0x1E, 0x70, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'W'
+0x02, 0x0E, 0x3C, 0x70, 0xE0, 0xC0, 0x70, 0x38, 0x0E, 0x02, 0x00, 0x40, 0x70, 0x38, 0x1E, 0x0F, 0x07, 0x0E, 0x3C, 0x70, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'X'
+0x02, 0x0E, 0x3C, 0xF0, 0xC0, 0xC0, 0xF0, 0x3C, 0x0E, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'Y'
+0x00, 0x00, 0x06, 0x06, 0x86, 0xC6, 0x76, 0x3E, 0x0E, 0x00, 0x00, 0x00, 0x70, 0x78, 0x6E, 0x67, 0x61, 0x60, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'Z'
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00,  // '['
+0x00, 0x00, 0x00, 0x0E, 0xFE, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x7F, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '\'
+0x00, 0x00, 0x00, 0x03, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,  // ']'
+0x00, 0x80, 0xE0, 0x78, 0x0E, 0x0E, 0x78, 0xE0, 0x80, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '^'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,  // '_'
+0x00, 0x00, 0x02, 0x06, 0x0E, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '`'
+0x00, 0x80, 0xC0, 0x60, 0x60, 0x60, 0x60, 0xE0, 0xC0, 0x00, 0x00, 0x00, 0x38, 0x7C, 0x66, 0x66, 0x26, 0x36, 0x3F, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'a'
+0x00, 0xFE, 0xFE, 0xC0, 0x60, 0x60, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x30, 0x60, 0x60, 0x70, 0x3F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'b'
+0x00, 0x80, 0xC0, 0xE0, 0x60, 0x60, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x3F, 0x70, 0x60, 0x60, 0x70, 0x39, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'c'
+0x00, 0x80, 0xC0, 0xE0, 0x60, 0x60, 0xC0, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0x3F, 0x70, 0x60, 0x60, 0x30, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'd'
+0x00, 0x80, 0xC0, 0xE0, 0x60, 0x60, 0xE0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x3F, 0x76, 0x66, 0x66, 0x66, 0x37, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'e'
+0x00, 0x60, 0x60, 0x60, 0xFC, 0xFE, 0x66, 0x66, 0x66, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'f'
+0x00, 0xC0, 0xE0, 0x70, 0x30, 0x30, 0x60, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x8F, 0x9F, 0x38, 0x30, 0x30, 0x98, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00,  // 'g'
+0x00, 0xFE, 0xFE, 0xC0, 0x60, 0x60, 0x60, 0xE0, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'h'
+0x00, 0x00, 0x60, 0x60, 0x60, 0xE6, 0xE6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'i'
+0x00, 0x00, 0x30, 0x30, 0x30, 0xF3, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x03, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00,  // 'j'
+0x00, 0xFE, 0xFE, 0x00, 0x00, 0x80, 0xC0, 0x60, 0x20, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x06, 0x03, 0x07, 0x1C, 0x38, 0x60, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'k'
+0x00, 0x00, 0x06, 0x06, 0x06, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'l'
+0xE0, 0xE0, 0x40, 0x60, 0xE0, 0xE0, 0xC0, 0x60, 0xE0, 0xC0, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'm'
+0x00, 0xE0, 0xE0, 0xC0, 0x60, 0x60, 0x60, 0xE0, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'n'
+0x00, 0x80, 0xC0, 0xE0, 0x60, 0x60, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x1F, 0x3F, 0x70, 0x60, 0x60, 0x70, 0x3F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'o'
+0x00, 0xF0, 0xF0, 0x60, 0x30, 0x30, 0x70, 0xE0, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x18, 0x30, 0x30, 0x38, 0x1F, 0x0F, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'p'
+0x00, 0xC0, 0xE0, 0x70, 0x30, 0x30, 0x60, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0x1F, 0x38, 0x30, 0x30, 0x18, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00,  // 'q'
+0x00, 0x20, 0xE0, 0xC0, 0xC0, 0x60, 0x60, 0xE0, 0x40, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'r'
+0x00, 0x80, 0xC0, 0x60, 0x60, 0x60, 0x60, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x33, 0x37, 0x66, 0x66, 0x66, 0x66, 0x3E, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 's'
+0x00, 0x60, 0x60, 0xF8, 0xFC, 0x60, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x7F, 0x60, 0x60, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 't'
+0x00, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0x7F, 0x60, 0x60, 0x60, 0x30, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'u'
+0x00, 0x20, 0xE0, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0x20, 0x00, 0x00, 0x00, 0x01, 0x0F, 0x3E, 0x70, 0x7E, 0x0F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'v'
+0xE0, 0xE0, 0x00, 0xE0, 0xE0, 0xE0, 0x00, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0x78, 0x1F, 0x00, 0x1F, 0x78, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'w'
+0x00, 0x20, 0xE0, 0xC0, 0x00, 0x00, 0xC0, 0xE0, 0x20, 0x00, 0x00, 0x00, 0x40, 0x70, 0x39, 0x0F, 0x0F, 0x39, 0x70, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'x'
+0x00, 0x30, 0xF0, 0xC0, 0x00, 0x00, 0x80, 0xF0, 0x70, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8F, 0xFE, 0xF0, 0x7F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'y'
+0x00, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xE0, 0xE0, 0x60, 0x00, 0x00, 0x60, 0x70, 0x78, 0x6C, 0x66, 0x63, 0x61, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'z'
+0x00, 0x00, 0x00, 0x00, 0x80, 0xFE, 0xFF, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x03, 0x03, 0x00, 0x00,  // '{'
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,  // '|'
+0x00, 0x00, 0x03, 0x03, 0xFF, 0xFE, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,  // '}'
+0x00, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x03, 0x01, 0x01, 0x01, 0x03, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '~'
+};
+
+const uint8_t OLED_Font16x26_Pages [] = {
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // sp
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x7F, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '!'
+0x00, 0x00, 0x00, 0x7F, 0x7F, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '"'
+0x00, 0x80, 0xC0, 0xC0, 0xC0, 0xE0, 0xFE, 0xFF, 0xFF, 0xC7, 0xC0, 0xFC, 0xFF, 0xFF, 0xCF, 0xC0, 0x60, 0x60, 0x60, 0xE0, 0xFE, 0xFF, 0xFF, 0x6F, 0xE0, 0xFC, 0xFF, 0xFF, 0x7F, 0x60, 0x60, 0x60, 0x00, 0x00, 0x1C, 0x1F, 0x1F, 0x0F, 0x00, 0x18, 0x1F, 0x1F, 0x1F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '#'
+0x00, 0x00, 0x00, 0xFC, 0xFE, 0xFE, 0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0x03, 0x07, 0x07, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xF8, 0xF8, 0xF0, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x1C, 0x1C, 0x18, 0x7F, 0x7F, 0x7F, 0x7F, 0x1F, 0x0F, 0x0F, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '$'
+0xFE, 0xFE, 0xFF, 0x03, 0x01, 0xCF, 0xFF, 0xFE, 0xFC, 0x80, 0xE0, 0xF0, 0xFC, 0x3E, 0x1F, 0x07, 0x01, 0x01, 0x03, 0x83, 0xC2, 0xF3, 0xFB, 0x7F, 0xFF, 0xFF, 0xFB, 0xF9, 0x18, 0x18, 0xF8, 0xF8, 0x18, 0x1C, 0x1F, 0x0F, 0x07, 0x01, 0x00, 0x00, 0x07, 0x0F, 0x1F, 0x1F, 0x18, 0x18, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '%'
+0x00, 0x00, 0x00, 0x38, 0xFE, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFE, 0x7E, 0x00, 0x00, 0x00, 0xF8, 0xFC, 0xFC, 0xFE, 0x0F, 0x07, 0x1F, 0x3F, 0xFF, 0xFD, 0xF1, 0xE0, 0x80, 0xF0, 0xFC, 0xFC, 0x03, 0x07, 0x0F, 0x1F, 0x1E, 0x1C, 0x18, 0x18, 0x18, 0x1D, 0x1F, 0x0F, 0x1F, 0x1F, 0x1F, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '&'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x7F, 0x7F, 0x7F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '''
+0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xF0, 0xFC, 0xFC, 0x3E, 0x0F, 0x07, 0x03, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0F, 0x3F, 0x3F, 0x7C, 0xF0, 0xE0, 0xC0, 0xC0, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,  // '('
+0x00, 0x01, 0x01, 0x03, 0x03, 0x07, 0x0F, 0x3E, 0xFC, 0xFC, 0xF0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0xC0, 0xC0, 0xE0, 0xF0, 0x7C, 0x3F, 0x3F, 0x0F, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // ')'
+0x00, 0x00, 0x38, 0x38, 0x38, 0x30, 0xF3, 0xFF, 0x1F, 0xBF, 0xF1, 0xB0, 0x38, 0x38, 0x38, 0x30, 0x00, 0x00, 0x00, 0x04, 0x06, 0x0F, 0x0F, 0x07, 0x01, 0x03, 0x0F, 0x0F, 0x0F, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '*'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xFF, 0xFF, 0xFF, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '+'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFE, 0xFE, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // ','
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '-'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '.'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xF0, 0xFC, 0xFF, 0x3F, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xF0, 0xFC, 0xFF, 0x3F, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xF0, 0xFC, 0xFF, 0x3F, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '/'
+0x00, 0xE0, 0xF8, 0xFC, 0xFE, 0x7F, 0x0F, 0x07, 0x03, 0x07, 0x0F, 0x7F, 0xFE, 0xFC, 0xF8, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0x07, 0x0F, 0x1F, 0x1E, 0x1C, 0x18, 0x1C, 0x1E, 0x1F, 0x0F, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '0'
+0x00, 0x00, 0x0C, 0x0C, 0x0C, 0x0E, 0x0E, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '1'
+0x00, 0x00, 0x06, 0x06, 0x07, 0x07, 0x03, 0x03, 0x03, 0x07, 0xFF, 0xFE, 0xFE, 0xFC, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xE0, 0xF0, 0xF8, 0x7C, 0x3E, 0x1F, 0x0F, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x1F, 0x1F, 0x1F, 0x1B, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '2'
+0x00, 0x00, 0x00, 0x06, 0x07, 0x07, 0x03, 0x03, 0x03, 0x07, 0xFF, 0xFF, 0xFE, 0xFC, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x06, 0x06, 0x07, 0x0F, 0x1F, 0xFF, 0xFD, 0xF8, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x1C, 0x1C, 0x18, 0x18, 0x18, 0x1C, 0x1E, 0x0F, 0x0F, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '3'
+0x00, 0x00, 0x00, 0x00, 0x80, 0xE0, 0xF0, 0xF8, 0x7E, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x60, 0x78, 0x7C, 0x7F, 0x7F, 0x67, 0x63, 0x60, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '4'
+0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x07, 0x0F, 0xBF, 0xFE, 0xFE, 0xFC, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x1C, 0x1C, 0x18, 0x18, 0x18, 0x1C, 0x1F, 0x0F, 0x0F, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '5'
+0x00, 0x00, 0xE0, 0xF8, 0xFC, 0xFE, 0x3E, 0x0F, 0x07, 0x03, 0x03, 0x03, 0x07, 0x07, 0x06, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0x07, 0x03, 0x03, 0x07, 0x0F, 0xFF, 0xFE, 0xFC, 0xF8, 0x00, 0x00, 0x01, 0x07, 0x0F, 0x0F, 0x1F, 0x1C, 0x18, 0x18, 0x1C, 0x1E, 0x0F, 0x0F, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '6'
+0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0xC7, 0xF7, 0xFF, 0x7F, 0x3F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xE0, 0xF8, 0xFE, 0x7F, 0x1F, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x1F, 0x1F, 0x1F, 0x1F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '7'
+0x00, 0x00, 0x30, 0xFC, 0xFE, 0xFF, 0xFF, 0x87, 0x03, 0x03, 0x87, 0xFF, 0xFF, 0xFE, 0x7C, 0x00, 0x00, 0xC0, 0xF0, 0xF8, 0xFD, 0xFF, 0x1F, 0x07, 0x0F, 0x0F, 0x1F, 0x7F, 0xFD, 0xF8, 0xF0, 0xE0, 0x00, 0x01, 0x07, 0x0F, 0x0F, 0x1F, 0x1C, 0x1C, 0x18, 0x18, 0x1C, 0x1E, 0x0F, 0x0F, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '8'
+0x00, 0xE0, 0xF8, 0xFC, 0xFE, 0xFF, 0x07, 0x03, 0x03, 0x07, 0x0F, 0xFF, 0xFE, 0xFC, 0xF8, 0xE0, 0x00, 0x01, 0x07, 0x0F, 0x0F, 0x1F, 0x1C, 0x18, 0x18, 0x18, 0x1C, 0xEF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x0C, 0x1C, 0x1C, 0x18, 0x18, 0x18, 0x1C, 0x1C, 0x1F, 0x0F, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '9'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // ':'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFE, 0xFE, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // ';'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0xC0, 0xC0, 0x20, 0x20, 0x70, 0x70, 0xF8, 0xF8, 0xFC, 0xDC, 0x8E, 0x8E, 0x07, 0x07, 0x03, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x03, 0x07, 0x07, 0x0E, 0x0E, 0x1C, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '<'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x8C, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '='
+0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x03, 0x07, 0x07, 0x8E, 0x8E, 0xDC, 0xDC, 0xF8, 0xF8, 0x70, 0x70, 0x20, 0x18, 0x1C, 0x1C, 0x0E, 0x0E, 0x07, 0x07, 0x03, 0x03, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '>'
+0x00, 0x00, 0x1E, 0x1F, 0x1F, 0x03, 0x03, 0x03, 0x03, 0x03, 0x87, 0xFF, 0xFE, 0xFE, 0x7C, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x78, 0x7C, 0x7E, 0x7F, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '?'
+0x00, 0xE0, 0xF8, 0xFC, 0x7E, 0x1E, 0x8F, 0xC7, 0xE3, 0xF3, 0x73, 0x37, 0x7F, 0xFE, 0xFE, 0xF8, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0xC1, 0xC0, 0xF0, 0xFE, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0x03, 0x07, 0x0F, 0x0E, 0x1C, 0x1D, 0x19, 0x19, 0x19, 0x1D, 0x1C, 0x0D, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '@'
+0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xF8, 0xFF, 0xFF, 0xDF, 0xC3, 0xC0, 0xC7, 0xFF, 0xFF, 0xFF, 0xFC, 0xE0, 0x80, 0x1C, 0x1F, 0x1F, 0x1F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'A'
+0x00, 0x00, 0xF8, 0xF8, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x38, 0xF8, 0xF8, 0xF0, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x18, 0x18, 0x18, 0x3C, 0x3E, 0xFF, 0xF7, 0xE7, 0xE3, 0xC0, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1C, 0x1F, 0x0F, 0x0F, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'B'
+0x00, 0x00, 0xC0, 0xE0, 0xE0, 0xF0, 0x70, 0x38, 0x38, 0x18, 0x18, 0x18, 0x18, 0x38, 0x38, 0x38, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x07, 0x07, 0x0F, 0x0F, 0x1E, 0x1C, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1C, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'C'
+0x00, 0xF8, 0xF8, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x38, 0x38, 0xF8, 0xF0, 0xF0, 0xE0, 0xC0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x18, 0x18, 0x18, 0x18, 0x1C, 0x1C, 0x0F, 0x0F, 0x07, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'D'
+0x00, 0x00, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'E'
+0x00, 0x00, 0x00, 0xF8, 0xF8, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'F'
+0x00, 0x80, 0xC0, 0xE0, 0xF0, 0xF0, 0x78, 0x38, 0x38, 0x18, 0x18, 0x18, 0x18, 0x38, 0x38, 0x30, 0x3C, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0xF0, 0xF0, 0xF0, 0xF0, 0x00, 0x01, 0x03, 0x07, 0x0F, 0x0F, 0x1E, 0x1C, 0x1C, 0x18, 0x18, 0x18, 0x1F, 0x1F, 0x1F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'G'
+0x00, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'H'
+0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'I'
+0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x1C, 0x1C, 0x18, 0x18, 0x18, 0x1C, 0x1F, 0x0F, 0x0F, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'J'
+0x00, 0x00, 0xF8, 0xF8, 0xF8, 0xF8, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0xF8, 0x78, 0x38, 0x18, 0x08, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0x7F, 0xFF, 0xF7, 0xE3, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x03, 0x07, 0x0F, 0x1F, 0x1E, 0x1C, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'K'
+0x00, 0x00, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'L'
+0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF0, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x3F, 0xFF, 0xFE, 0xF0, 0xFE, 0xFF, 0x1F, 0x03, 0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'M'
+0x00, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xE0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0xF8, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x0F, 0x3F, 0xFF, 0xFC, 0xF8, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'N'
+0x00, 0xC0, 0xE0, 0xF0, 0xF0, 0x78, 0x38, 0x18, 0x18, 0x18, 0x38, 0x78, 0xF0, 0xF0, 0xE0, 0xC0, 0x7E, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0x07, 0x0F, 0x0F, 0x1E, 0x1C, 0x18, 0x18, 0x18, 0x1C, 0x1E, 0x0F, 0x0F, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'O'
+0x00, 0x00, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x38, 0xF8, 0xF8, 0xF0, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x30, 0x30, 0x38, 0x3C, 0x1F, 0x1F, 0x0F, 0x0F, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'P'
+0x00, 0xC0, 0xE0, 0xF0, 0xF0, 0x78, 0x38, 0x18, 0x18, 0x18, 0x38, 0x78, 0xF0, 0xF0, 0xE0, 0xC0, 0x7E, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0x07, 0x0F, 0x0F, 0x1E, 0x1C, 0x18, 0x18, 0x38, 0x7C, 0x7E, 0xFF, 0xEF, 0xC7, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,  // 'Q'
+0x00, 0x00, 0xF8, 0xF8, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0x38, 0x78, 0xF8, 0xF0, 0xF0, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x70, 0xF8, 0xF8, 0xFE, 0xDF, 0x8F, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x01, 0x03, 0x0F, 0x1F, 0x1F, 0x1E, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'R'
+0x00, 0x00, 0xE0, 0xF0, 0xF0, 0xF8, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x38, 0x38, 0x30, 0x00, 0x00, 0x00, 0x03, 0x07, 0x0F, 0x0F, 0x1E, 0x1C, 0x1C, 0x3C, 0x38, 0x78, 0xF8, 0xF0, 0xF0, 0xE0, 0x00, 0x00, 0x0E, 0x1C, 0x1C, 0x1C, 0x18, 0x18, 0x18, 0x18, 0x1C, 0x1E, 0x0F, 0x0F, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'S'
+0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'T'
+0x00, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0xF8, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x0F, 0x0F, 0x1F, 0x1C, 0x18, 0x18, 0x18, 0x1C, 0x1F, 0x0F, 0x0F, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'U'
+0x38, 0xF8, 0xF8, 0xF8, 0xE0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xF8, 0xF8, 0xF8, 0x00, 0x00, 0x07, 0x3F, 0xFF, 0xFF, 0xFC, 0xF0, 0x80, 0xE0, 0xF8, 0xFF, 0xFF, 0x1F, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'V'
+0xF8, 0xF8, 0xF8, 0xF0, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0xC0, 0xF8, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0xF0, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0xF8, 0xE0, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x03, 0x00, 0x03, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'W'
+0x08, 0x18, 0x78, 0xF8, 0xF8, 0xF0, 0xE0, 0x80, 0x00, 0x00, 0xC0, 0xE0, 0xF0, 0xF8, 0x78, 0x18, 0x00, 0x00, 0x00, 0x00, 0xC1, 0xE7, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0xE3, 0xC1, 0x80, 0x00, 0x00, 0x10, 0x1C, 0x1E, 0x1F, 0x0F, 0x03, 0x01, 0x00, 0x00, 0x01, 0x03, 0x07, 0x1F, 0x1F, 0x1E, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'X'
+0x08, 0x38, 0xF8, 0xF8, 0xF8, 0xE0, 0x80, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0xF8, 0xF8, 0x38, 0x00, 0x00, 0x00, 0x01, 0x07, 0x0F, 0xFF, 0xFF, 0xFC, 0xFE, 0xFF, 0x0F, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'Y'
+0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x98, 0xD8, 0xF8, 0xF8, 0xF8, 0x78, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0xF0, 0xF8, 0x7E, 0x3F, 0x1F, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x1C, 0x1E, 0x1F, 0x1F, 0x1F, 0x1B, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'Z'
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,  // '['
+0x00, 0x03, 0x0F, 0x3F, 0xFF, 0xFC, 0xF0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0F, 0x3F, 0xFF, 0xFC, 0xF0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0F, 0x3F, 0xFF, 0xFC, 0xF0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,  // '\'
+0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,  // ']'
+0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xF8, 0xFE, 0x7F, 0xFF, 0xF8, 0xE0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0xF0, 0xFC, 0xFF, 0x3F, 0x0F, 0x03, 0x00, 0x01, 0x0F, 0x3F, 0xFF, 0xFC, 0xF0, 0xC0, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '^'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '_'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '`'
+0x00, 0x00, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x80, 0xC1, 0xE1, 0xE1, 0xF1, 0x70, 0x30, 0x30, 0x31, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x07, 0x0F, 0x1F, 0x1F, 0x1E, 0x18, 0x18, 0x18, 0x1C, 0x0F, 0x0F, 0x1F, 0x1F, 0x1F, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'a'
+0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x01, 0x00, 0x00, 0x01, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x0F, 0x1C, 0x1C, 0x18, 0x18, 0x1C, 0x1F, 0x0F, 0x0F, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'b'
+0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x00, 0x70, 0xFE, 0xFF, 0xFF, 0xFF, 0x07, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x03, 0x07, 0x0F, 0x0F, 0x1F, 0x1C, 0x1C, 0x18, 0x18, 0x18, 0x18, 0x1C, 0x1C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'c'
+0x00, 0x00, 0x00, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x9F, 0x01, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0x07, 0x0F, 0x1F, 0x1F, 0x1C, 0x18, 0x18, 0x1C, 0x0E, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'd'
+0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0xF8, 0xFE, 0xFF, 0xFF, 0xFF, 0x33, 0x31, 0x30, 0x30, 0x31, 0x3F, 0x3F, 0x3F, 0x3F, 0x3C, 0x00, 0x00, 0x03, 0x07, 0x0F, 0x0F, 0x1E, 0x1C, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1C, 0x1C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'e'
+0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xF8, 0xFE, 0xFF, 0xFF, 0xFF, 0xC3, 0xC1, 0xC1, 0xC1, 0xC1, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'f'
+0x00, 0x00, 0x00, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x8F, 0x01, 0x00, 0x00, 0x01, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0x07, 0x0F, 0x1F, 0x1F, 0x1C, 0x18, 0x18, 0x1C, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x03, 0x03, 0x03, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x01, 0x00, 0x00,  // 'g'
+0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x03, 0x01, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'h'
+0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC3, 0xC3, 0xC3, 0xC3, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'i'
+0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00,  // 'j'
+0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0x40, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0xFC, 0xFE, 0xFF, 0xCF, 0x87, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x01, 0x03, 0x07, 0x1F, 0x1F, 0x1E, 0x1C, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'k'
+0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'l'
+0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x03, 0x07, 0xFF, 0xFF, 0xFF, 0x0F, 0x03, 0x03, 0xFF, 0xFF, 0xFF, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'm'
+0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x03, 0x01, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'n'
+0x00, 0x00, 0x00, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x07, 0x01, 0x00, 0x00, 0x00, 0x01, 0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0x07, 0x0F, 0x0F, 0x1F, 0x1C, 0x18, 0x18, 0x18, 0x1C, 0x1F, 0x0F, 0x0F, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'o'
+0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x01, 0x00, 0x00, 0x01, 0x03, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x1E, 0x1C, 0x18, 0x18, 0x1C, 0x1F, 0x1F, 0x0F, 0x07, 0x01, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'p'
+0x00, 0x00, 0x00, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x07, 0x01, 0x00, 0x00, 0x01, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0x07, 0x0F, 0x1F, 0x1F, 0x1C, 0x18, 0x18, 0x1C, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x00,  // 'q'
+0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x03, 0x01, 0x00, 0x00, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'r'
+0x00, 0x00, 0x00, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x0E, 0x1F, 0x1F, 0x3F, 0x3F, 0x38, 0x70, 0x70, 0xF0, 0xE0, 0xE1, 0xE1, 0xC1, 0x00, 0x00, 0x00, 0x0C, 0x1C, 0x1C, 0x1C, 0x18, 0x18, 0x18, 0x18, 0x1C, 0x1F, 0x0F, 0x0F, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 's'
+0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xF8, 0xF8, 0xF8, 0xF8, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0F, 0x1F, 0x1F, 0x1C, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 't'
+0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x07, 0x0F, 0x1F, 0x1F, 0x1C, 0x18, 0x1C, 0x1E, 0x0F, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'u'
+0x40, 0xC0, 0xC0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xC0, 0xC0, 0x00, 0x01, 0x0F, 0x3F, 0xFF, 0xFE, 0xF8, 0xC0, 0x00, 0xC0, 0xF0, 0xFE, 0xFF, 0x3F, 0x0F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'v'
+0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0xFC, 0xC0, 0xFE, 0xFF, 0xFF, 0x00, 0x01, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x01, 0x00, 0x01, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'w'
+0x00, 0x40, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xC0, 0xC0, 0x40, 0x00, 0x00, 0x01, 0x03, 0x07, 0xDF, 0xFF, 0xFE, 0xFC, 0xFC, 0xFF, 0xDF, 0x87, 0x03, 0x00, 0x00, 0x00, 0x10, 0x1C, 0x1E, 0x1F, 0x0F, 0x07, 0x01, 0x01, 0x03, 0x07, 0x1F, 0x1F, 0x1E, 0x1C, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'x'
+0x40, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xC0, 0xC0, 0x00, 0x01, 0x07, 0x3F, 0xFF, 0xFF, 0xF8, 0xE0, 0x80, 0xC0, 0xF8, 0xFE, 0xFF, 0x3F, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xFF, 0xFF, 0xFF, 0x7F, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'y'
+0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0x7C, 0x3E, 0x1F, 0x0F, 0x07, 0x03, 0x01, 0x00, 0x18, 0x1C, 0x1F, 0x1F, 0x1F, 0x1B, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'z'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0xFF, 0xFF, 0xC3, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x3C, 0xFF, 0xFF, 0xE7, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xFF, 0xFF, 0xFF, 0xC3, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,  // '{'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '|'
+0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x83, 0xFF, 0xFF, 0xFF, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0xE7, 0xFF, 0xFF, 0x3C, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0xC1, 0xFF, 0xFF, 0xFF, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '}'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xF0, 0xF8, 0xF8, 0x18, 0x18, 0x38, 0x78, 0x70, 0xF0, 0xE0, 0xC0, 0xC0, 0xF8, 0xF8, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '~'
+};
+
+/* Proportional versions of the 7x10 and 11x18 glyphs: cropped to their ink, 1 (2) pixel spacing, kerning pairs
+   where the shapes leave more room than that. Generated from the tables above */
+const uint8_t OLED_FontProp7x10_Bitmap [] = {
+0xBF,  // '!'
+0x07, 0x00, 0x07,  // '"'
+0xF4, 0x2F, 0x24, 0xF4, 0x2F,  // '#'
+0x66, 0x89, 0xFF, 0x89, 0x72, 0x00, 0x00, 0x01, 0x00, 0x00,  // '$'
+0x26, 0x19, 0x6E, 0x94, 0x62,  // '%'
+0x60, 0x96, 0x99, 0x66, 0x90,  // '&'
+0x07,  // '''
+0xFC, 0x02, 0x01, 0x00, 0x01, 0x02,  // '('
+0x01, 0x02, 0xFC, 0x02, 0x01, 0x00,  // ')'
+0x0A, 0x07, 0x0A,  // '*'
+0x04, 0x04, 0x1F, 0x04, 0x04,  // '+'
+0x07,  // ','
+0x01, 0x01, 0x01,  // '-'
+0x01,  // '.'
+0xC0, 0x3C, 0x03,  // '/'
+0x7E, 0x81, 0x89, 0x81, 0x7E,  // '0'
+0x04, 0x02, 0xFF,  // '1'
+0x86, 0xC1, 0xA1, 0x91, 0x8E,  // '2'
+0x42, 0x81, 0x89, 0x89, 0x76,  // '3'
+0x30, 0x2C, 0x22, 0xFF, 0x20,  // '4'
+0x4F, 0x89, 0x89, 0x89, 0x71,  // '5'
+0x7E, 0x89, 0x89, 0x89, 0x72,  // '6'
+0x01, 0xE1, 0x19, 0x05, 0x03,  // '7'
+0x76, 0x89, 0x89, 0x89, 0x76,  // '8'
+0x4E, 0x91, 0x91, 0x91, 0x7E,  // '9'
+0x21,  // ':'
+0x71,  // ';'
+0x04, 0x0A, 0x0A, 0x11, 0x11,  // '<'
+0x05, 0x05, 0x05, 0x05, 0x05,  // '='
+0x11, 0x11, 0x0A, 0x0A, 0x04,  // '>'
+0x02, 0x01, 0xB1, 0x09, 0x06,  // '?'
+0x7E, 0x81, 0x99, 0x95, 0x1E,  // '@'
+0xE0, 0x3E, 0x21, 0x3E, 0xE0,  // 'A'
+0xFF, 0x89, 0x89, 0x89, 0x76,  // 'B'
+0x7E, 0x81, 0x81, 0x81, 0x42,  // 'C'
+0xFF, 0x81, 0x81, 0x42, 0x3C,  // 'D'
+0xFF, 0x89, 0x89, 0x89, 0x89,  // 'E'
+0xFF, 0x09, 0x09, 0x09, 0x01,  // 'F'
+0x7E, 0x81, 0x91, 0x91, 0x72,  // 'G'
+0xFF, 0x08, 0x08, 0x08, 0xFF,  // 'H'
+0x81, 0xFF, 0x81,  // 'I'
+0x40, 0x80, 0x80, 0x80, 0x7F,  // 'J'
+0xFF, 0x08, 0x14, 0x62, 0x81,  // 'K'
+0xFF, 0x80, 0x80, 0x80, 0x80,  // 'L'
+0xFF, 0x06, 0x08, 0x06, 0xFF,  // 'M'
+0xFF, 0x06, 0x18, 0x60, 0xFF,  // 'N'
+0x7E, 0x81, 0x81, 0x81, 0x7E,  // 'O'
+0xFF, 0x11, 0x11, 0x11, 0x0E,  // 'P'
+0x7E, 0x81, 0xC1, 0x81, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x01,  // 'Q'
+0xFF, 0x11, 0x11, 0x71, 0x8E,  // 'R'
+0x46, 0x89, 0x89, 0x91, 0x62,  // 'S'
+0x01, 0x01, 0xFF, 0x01, 0x01,  // 'T'
+0x7F, 0x80, 0x80, 0x80, 0x7F,  // 'U'
+0x07, 0x38, 0xC0, 0x38, 0x07,  // 'V'
+0x3F, 0xE0, 0x1C, 0xE0, 0x3F,  // 'W'
+0x81, 0x66, 0x18, 0x66, 0x81,  // 'X'
+0x03, 0x0C, 0xF0, 0x0C, 0x03,  // 'Y'
+0xC1, 0xA1, 0x99, 0x85, 0x83,  // 'Z'
+0xFF, 0x01, 0x03, 0x02,  // '['
+0x03, 0x3C, 0xC0,  // '\'
+0x01, 0xFF, 0x02, 0x03,  // ']'
+0x08, 0x06, 0x01, 0x06, 0x08,  // '^'
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,  // '_'
+0x01, 0x02,  // '`'
+0x1A, 0x25, 0x25, 0x15, 0x3E,  // 'a'
+0xFF, 0x48, 0x84, 0x84, 0x78,  // 'b'
+0x1E, 0x21, 0x21, 0x21, 0x12,  // 'c'
+0x78, 0x84, 0x84, 0x48, 0xFF,  // 'd'
+0x1E, 0x25, 0x25, 0x25, 0x16,  // 'e'
+0x04, 0x04, 0xFE, 0x05, 0x05,  // 'f'
+0x9E, 0xA1, 0xA1, 0x92, 0x7F,  // 'g'
+0xFF, 0x08, 0x04, 0x04, 0xF8,  // 'h'
+0x04, 0x04, 0xFD,  // 'i'
+0x00, 0x04, 0x04, 0xFD, 0x02, 0x02, 0x02, 0x01,  // 'j'
+0xFF, 0x10, 0x28, 0x44, 0x80,  // 'k'
+0x01, 0x01, 0xFF,  // 'l'
+0x3F, 0x01, 0x3F, 0x01, 0x3E,  // 'm'
+0x3F, 0x02, 0x01, 0x01, 0x3E,  // 'n'
+0x1E, 0x21, 0x21, 0x21, 0x1E,  // 'o'
+0xFF, 0x12, 0x21, 0x21, 0x1E,  // 'p'
+0x1E, 0x21, 0x21, 0x12, 0xFF,  // 'q'
+0x3F, 0x02, 0x01, 0x01, 0x02,  // 'r'
+0x12, 0x25, 0x25, 0x29, 0x12,  // 's'
+0x04, 0x7F, 0x84, 0x84,  // 't'
+0x1F, 0x20, 0x20, 0x10, 0x3F,  // 'u'
+0x03, 0x1C, 0x20, 0x1C, 0x03,  // 'v'
+0x0F, 0x38, 0x07, 0x38, 0x0F,  // 'w'
+0x21, 0x12, 0x0C, 0x12, 0x21,  // 'x'
+0x83, 0x8C, 0x70, 0x0C, 0x03,  // 'y'
+0x31, 0x29, 0x25, 0x23, 0x21,  // 'z'
+0x30, 0xCF, 0x01, 0x00, 0x03, 0x02,  // '{'
+0xFF, 0x03,  // '|'
+0x01, 0xCF, 0x30, 0x02, 0x03, 0x00,  // '}'
+0x03, 0x01, 0x01, 0x02, 0x03,  // '~'
+};
+
+const OLED_FontGlyph_t OLED_FontProp7x10_Glyphs [] = {
+{    0,  0,  0, 0,  0,  3 },  // sp
+{    0,  1,  8, 0,  0,  2 },  // '!'
+{    1,  3,  3, 0,  0,  4 },  // '"'
+{    4,  5,  8, 0,  0,  6 },  // '#'
+{    9,  5,  9, 0,  0,  6 },  // '$'
+{   19,  5,  8, 0,  0,  6 },  // '%'
+{   24,  5,  8, 0,  0,  6 },  // '&'
+{   29,  1,  3, 0,  0,  2 },  // '''
+{   30,  3, 10, 0,  0,  4 },  // '('
+{   36,  3, 10, 0,  0,  4 },  // ')'
+{   42,  3,  4, 0,  0,  4 },  // '*'
+{   45,  5,  5, 0,  2,  6 },  // '+'
+{   50,  1,  3, 0,  7,  2 },  // ','
+{   51,  3,  1, 0,  5,  4 },  // '-'
+{   54,  1,  1, 0,  7,  2 },  // '.'
+{   55,  3,  8, 0,  0,  4 },  // '/'
+{   58,  5,  8, 0,  0,  6 },  // '0'
+{   63,  3,  8, 0,  0,  4 },  // '1'
+{   66,  5,  8, 0,  0,  6 },  // '2'
+{   71,  5,  8, 0,  0,  6 },  // '3'
+{   76,  5,  8, 0,  0,  6 },  // '4'
+{   81,  5,  8, 0,  0,  6 },  // '5'
+{   86,  5,  8, 0,  0,  6 },  // '6'
+{   91,  5,  8, 0,  0,  6 },  // '7'
+{   96,  5,  8, 0,  0,  6 },  // '8'
+{  101,  5,  8, 0,  0,  6 },  // '9'
+{  106,  1,  6, 0,  2,  2 },  // ':'
+{  107,  1,  7, 0,  3,  2 },  // ';'
+{  108,  5,  5, 0,  2,  6 },  // '<'
+{  113,  5,  3, 0,  3,  6 },  // '='
+{  118,  5,  5, 0,  2,  6 },  // '>'
+{  123,  5,  8, 0,  0,  6 },  // '?'
+{  128,  5,  8, 0,  0,  6 },  // '@'
+{  133,  5,  8, 0,  0,  6 },  // 'A'
+{  138,  5,  8, 0,  0,  6 },  // 'B'
+{  143,  5,  8, 0,  0,  6 },  // 'C'
+{  148,  5,  8, 0,  0,  6 },  // 'D'
+{  153,  5,  8, 0,  0,  6 },  // 'E'
+{  158,  5,  8, 0,  0,  6 },  // 'F'
+{  163,  5,  8, 0,  0,  6 },  // 'G'
+{  168,  5,  8, 0,  0,  6 },  // 'H'
+{  173,  3,  8, 0,  0,  4 },  // 'I'
+{  176,  5,  8, 0,  0,  6 },  // 'J'
+{  181,  5,  8, 0,  0,  6 },  // 'K'
+{  186,  5,  8, 0,  0,  6 },  // 'L'
+{  191,  5,  8, 0,  0,  6 },  // 'M'
+{  196,  5,  8, 0,  0,  6 },  // 'N'
+{  201,  5,  8, 0,  0,  6 },  // 'O'
+{  206,  5,  8, 0,  0,  6 },  // 'P'
+{  211,  5,  9, 0,  0,  6 },  // 'Q'
+{  221,  5,  8, 0,  0,  6 },  // 'R'
+{  226,  5,  8, 0,  0,  6 },  // 'S'
+{  231,  5,  8, 0,  0,  6 },  // 'T'
+{  236,  5,  8, 0,  0,  6 },  // 'U'
+{  241,  5,  8, 0,  0,  6 },  // 'V'
+{  246,  5,  8, 0,  0,  6 },  // 'W'
+{  251,  5,  8, 0,  0,  6 },  // 'X'
+{  256,  5,  8, 0,  0,  6 },  // 'Y'
+{  261,  5,  8, 0,  0,  6 },  // 'Z'
+{  266,  2, 10, 0,  0,  3 },  // '['
+{  270,  3,  8, 0,  0,  4 },  // '\'
+{  273,  2, 10, 0,  0,  3 },  // ']'
+{  277,  5,  4, 0,  0,  6 },  // '^'
+{  282,  7,  1, 0,  9,  8 },  // '_'
+{  289,  2,  2, 0,  0,  3 },  // '`'
+{  291,  5,  6, 0,  2,  6 },  // 'a'
+{  296,  5,  8, 0,  0,  6 },  // 'b'
+{  301,  5,  6, 0,  2,  6 },  // 'c'
+{  306,  5,  8, 0,  0,  6 },  // 'd'
+{  311,  5,  6, 0,  2,  6 },  // 'e'
+{  316,  5,  8, 0,  0,  6 },  // 'f'
+{  321,  5,  8, 0,  2,  6 },  // 'g'
+{  326,  5,  8, 0,  0,  6 },  // 'h'
+{  331,  3,  8, 0,  0,  4 },  // 'i'
+{  334,  4, 10, 0,  0,  5 },  // 'j'
+{  342,  5,  8, 0,  0,  6 },  // 'k'
+{  347,  3,  8, 0,  0,  4 },  // 'l'
+{  350,  5,  6, 0,  2,  6 },  // 'm'
+{  355,  5,  6, 0,  2,  6 },  // 'n'
+{  360,  5,  6, 0,  2,  6 },  // 'o'
+{  365,  5,  8, 0,  2,  6 },  // 'p'
+{  370,  5,  8, 0,  2,  6 },  // 'q'
+{  375,  5,  6, 0,  2,  6 },  // 'r'
+{  380,  5,  6, 0,  2,  6 },  // 's'
+{  385,  4,  8, 0,  0,  5 },  // 't'
+{  389,  5,  6, 0,  2,  6 },  // 'u'
+{  394,  5,  6, 0,  2,  6 },  // 'v'
+{  399,  5,  6, 0,  2,  6 },  // 'w'
+{  404,  5,  6, 0,  2,  6 },  // 'x'
+{  409,  5,  8, 0,  2,  6 },  // 'y'
+{  414,  5,  6, 0,  2,  6 },  // 'z'
+{  419,  3, 10, 0,  0,  4 },  // '{'
+{  425,  1, 10, 0,  0,  2 },  // '|'
+{  427,  3, 10, 0,  0,  4 },  // '}'
+{  433,  5,  2, 0,  3,  6 },  // '~'
+};
+
+const OLED_FontKern_t OLED_FontProp7x10_Kerning [] = {
+{ '"', ',', -2 }, { '"', '.', -2 }, { '"', 'A', -1 }, { '"', 'J', -2 }, { '\'', ',', -2 }, { '\'', '.', -2 }, { '\'', 'A', -1 }, { '\'', 'J', -2 },
+{ '.', '"', -2 }, { '.', '\'', -2 }, { '.', 'T', -2 }, { '.', 'V', -2 }, { '.', 'W', -1 }, { '.', 'Y', -2 }, { '.', 'v', -1 }, { '.', 'w', -1 },
+{ '.', 'y', -2 }, { 'A', '"', -1 }, { 'A', '\'', -1 }, { 'A', 'T', -1 }, { 'A', 'V', -1 }, { 'A', 'Y', -1 }, { 'A', 'v', -1 }, { 'A', 'y', -1 },
+{ 'F', ',', -2 }, { 'F', '.', -2 }, { 'F', 'A', -1 }, { 'F', 'J', -2 }, { 'F', 'a', -1 }, { 'F', 'c', -1 }, { 'F', 'd', -1 }, { 'F', 'e', -1 },
+{ 'F', 'g', -1 }, { 'F', 'm', -1 }, { 'F', 'n', -1 }, { 'F', 'o', -1 }, { 'F', 'p', -1 }, { 'F', 'q', -1 }, { 'F', 'r', -1 }, { 'F', 's', -1 },
+{ 'F', 'u', -1 }, { 'F', 'v', -1 }, { 'F', 'w', -1 }, { 'F', 'x', -1 }, { 'F', 'y', -1 }, { 'F', 'z', -1 }, { 'L', '"', -2 }, { 'L', '\'', -2 },
+{ 'L', 'T', -2 }, { 'L', 'V', -2 }, { 'L', 'W', -1 }, { 'L', 'Y', -2 }, { 'L', 'v', -1 }, { 'L', 'w', -1 }, { 'L', 'y', -2 }, { 'P', ',', -2 },
+{ 'P', '.', -2 }, { 'P', 'A', -1 }, { 'P', 'J', -2 }, { 'T', ',', -2 }, { 'T', '.', -2 }, { 'T', 'A', -1 }, { 'T', 'J', -2 }, { 'T', 'a', -2 },
+{ 'T', 'c', -2 }, { 'T', 'd', -2 }, { 'T', 'e', -2 }, { 'T', 'g', -2 }, { 'T', 'm', -2 }, { 'T', 'n', -2 }, { 'T', 'o', -2 }, { 'T', 'p', -2 },
+{ 'T', 'q', -2 }, { 'T', 'r', -2 }, { 'T', 's', -2 }, { 'T', 'u', -2 }, { 'T', 'v', -2 }, { 'T', 'w', -2 }, { 'T', 'x', -2 }, { 'T', 'y', -2 },
+{ 'T', 'z', -2 }, { 'V', ',', -2 }, { 'V', '.', -2 }, { 'V', 'A', -1 }, { 'V', 'J', -1 }, { 'W', ',', -1 }, { 'W', '.', -1 }, { 'Y', ',', -2 },
+{ 'Y', '.', -2 }, { 'Y', 'A', -1 }, { 'Y', 'J', -2 }, { 'Y', 'a', -1 }, { 'Y', 'c', -1 }, { 'Y', 'd', -1 }, { 'Y', 'e', -1 }, { 'Y', 'g', -1 },
+{ 'Y', 'o', -1 }, { 'Y', 'q', -1 }, { 'Y', 's', -1 }, { 'r', ',', -2 }, { 'r', '.', -2 }, { 'r', 'A', -1 }, { 'r', 'J', -2 }, { 'r', 'T', -2 },
+{ 'r', 'Y', -1 }, { 'v', ',', -1 }, { 'v', '.', -1 }, { 'v', 'A', -1 }, { 'v', 'J', -1 }, { 'v', 'T', -2 }, { 'w', ',', -1 }, { 'w', '.', -1 },
+{ 'w', 'T', -2 }, { 'y', ',', -2 }, { 'y', '.', -2 }, { 'y', 'A', -1 }, { 'y', 'J', -1 }, { 'y', 'T', -2 },
+};
+
+const OLED_FontMetrics_t OLED_FontProp7x10_Metrics = { OLED_FontProp7x10_Glyphs, OLED_FontProp7x10_Bitmap,
+                                                   OLED_FontProp7x10_Kerning, 118 };
+
+const uint8_t OLED_FontProp11x18_Bitmap [] = {
+0xFF, 0xFF, 0x37, 0x37,  // '!'
+0x1F, 0x1F, 0x00, 0x1F, 0x1F,  // '"'
+0x30, 0xB0, 0xFF, 0x7F, 0x30, 0xB0, 0xFF, 0x7F, 0x30, 0x03, 0x3F, 0x3F, 0x03, 0x03, 0x3F, 0x3F, 0x03, 0x03,  // '#'
+0x1C, 0x3E, 0x77, 0x63, 0xFF, 0xC3, 0x8E, 0x0C, 0x0E, 0x1E, 0x38, 0x30, 0xFF, 0x30, 0x1F, 0x0F,  // '$'
+0x1E, 0x3F, 0x21, 0x3F, 0x9E, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x00, 0x0C, 0x06, 0x03, 0x01, 0x1E, 0x3F, 0x21, 0x3F, 0x1E,  // '%'
+0x00, 0x9E, 0xBF, 0xE3, 0xE3, 0x3F, 0x1E, 0x80, 0x80, 0x0F, 0x1F, 0x30, 0x30, 0x31, 0x1B, 0x0E, 0x3F, 0x11,  // '&'
+0x1F, 0x1F,  // '''
+0xC0, 0xF8, 0x1C, 0x06, 0x01, 0x0F, 0x7F, 0xE0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02,  // '('
+0x01, 0x06, 0x1C, 0xF8, 0xC0, 0x00, 0x80, 0xE0, 0x7F, 0x0F, 0x02, 0x01, 0x00, 0x00, 0x00,  // ')'
+0x16, 0x1C, 0x0F, 0x0F, 0x1C, 0x16,  // '*'
+0x30, 0x30, 0x30, 0x30, 0xFF, 0xFF, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,  // '+'
+0x13, 0x0F,  // ','
+0x03, 0x03, 0x03, 0x03,  // '-'
+0x03, 0x03,  // '.'
+0x00, 0x80, 0xF8, 0x7F, 0x07, 0x38, 0x3F, 0x07, 0x00, 0x00,  // '/'
+0xF8, 0xFE, 0x07, 0xC3, 0xC3, 0x07, 0xFE, 0xF8, 0x07, 0x1F, 0x38, 0x30, 0x30, 0x38, 0x1F, 0x07,  // '0'
+0x18, 0x0C, 0x06, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x3F,  // '1'
+0x1C, 0x1E, 0x07, 0x03, 0x83, 0xC7, 0x7E, 0x3C, 0x38, 0x3C, 0x36, 0x33, 0x31, 0x30, 0x30, 0x30,  // '2'
+0x0C, 0x0E, 0x03, 0x63, 0x63, 0xFE, 0x9C, 0x00, 0x0C, 0x1C, 0x38, 0x30, 0x30, 0x38, 0x1F, 0x0F,  // '3'
+0x00, 0xC0, 0xF8, 0x1E, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0x07, 0x06, 0x06, 0x3F, 0x3F, 0x06, 0x06,  // '4'
+0xFF, 0xFF, 0x43, 0x63, 0x63, 0xE3, 0xC3, 0x80, 0x0C, 0x1C, 0x38, 0x30, 0x30, 0x38, 0x1F, 0x0F,  // '5'
+0xF8, 0xFE, 0xC7, 0x63, 0x63, 0xE7, 0xCE, 0x8C, 0x07, 0x1F, 0x38, 0x30, 0x30, 0x38, 0x1F, 0x0F,  // '6'
+0x03, 0x03, 0x03, 0x83, 0xE3, 0x7B, 0x1F, 0x07, 0x00, 0x00, 0x38, 0x3F, 0x03, 0x00, 0x00, 0x00,  // '7'
+0x1C, 0xBE, 0xC3, 0xC3, 0xC3, 0xC7, 0xBE, 0x1C, 0x0F, 0x1F, 0x30, 0x30, 0x30, 0x30, 0x1F, 0x0F,  // '8'
+0x7C, 0xFE, 0xC7, 0x83, 0x83, 0xC7, 0xFE, 0xF8, 0x0C, 0x1C, 0x39, 0x31, 0x31, 0x38, 0x1F, 0x07,  // '9'
+0x03, 0x03, 0x03, 0x03,  // ':'
+0x83, 0x83, 0x09, 0x07,  // ';'
+0x10, 0x38, 0x28, 0x6C, 0x44, 0xC6, 0x82, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,  // '<'
+0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,  // '='
+0x83, 0x82, 0xC6, 0x44, 0x6C, 0x28, 0x38, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // '>'
+0x0C, 0x0E, 0x07, 0x03, 0x83, 0xC3, 0xE7, 0x7E, 0x3C, 0x00, 0x00, 0x00, 0x37, 0x37, 0x01, 0x00, 0x00, 0x00,  // '?'
+0xF8, 0xFE, 0x0F, 0xE3, 0xE3, 0x33, 0xFE, 0xFC, 0x07, 0x1F, 0x38, 0x31, 0x33, 0x1B, 0x03, 0x03,  // '@'
+0x00, 0xC0, 0xFC, 0x3F, 0x03, 0x3F, 0xFC, 0xC0, 0x00, 0x38, 0x3F, 0x07, 0x03, 0x03, 0x03, 0x07, 0x3F, 0x38,  // 'A'
+0xFF, 0xFF, 0xC3, 0xC3, 0xC3, 0xFE, 0x3C, 0x00, 0x3F, 0x3F, 0x30, 0x30, 0x30, 0x39, 0x1F, 0x0E,  // 'B'
+0xF8, 0xFE, 0x07, 0x03, 0x03, 0x03, 0x0E, 0x0C, 0x07, 0x1F, 0x38, 0x30, 0x30, 0x30, 0x1C, 0x0C,  // 'C'
+0xFF, 0xFF, 0x03, 0x03, 0x03, 0x0E, 0xFE, 0xF8, 0x3F, 0x3F, 0x30, 0x30, 0x30, 0x1C, 0x0F, 0x03,  // 'D'
+0xFF, 0xFF, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x03, 0x3F, 0x3F, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,  // 'E'
+0xFF, 0xFF, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x03, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'F'
+0xF8, 0xFE, 0x07, 0x03, 0x03, 0x83, 0x8E, 0x8C, 0x07, 0x1F, 0x38, 0x30, 0x30, 0x31, 0x1F, 0x1F,  // 'G'
+0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F,  // 'H'
+0x03, 0x03, 0xFF, 0xFF, 0x03, 0x03, 0x30, 0x30, 0x3F, 0x3F, 0x30, 0x30,  // 'I'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x0E, 0x1E, 0x38, 0x30, 0x30, 0x38, 0x1F, 0x0F,  // 'J'
+0xFF, 0xFF, 0xC0, 0xE0, 0xB8, 0x1C, 0x06, 0x03, 0x01, 0x3F, 0x3F, 0x00, 0x00, 0x03, 0x07, 0x1C, 0x38, 0x20,  // 'K'
+0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,  // 'L'
+0xFF, 0xFF, 0x0F, 0x7C, 0xC0, 0x7C, 0x07, 0xFF, 0xFF, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F,  // 'M'
+0xFF, 0xFF, 0x1F, 0xFC, 0xE0, 0x00, 0xFF, 0xFF, 0x3F, 0x3F, 0x00, 0x00, 0x0F, 0x3E, 0x3F, 0x3F,  // 'N'
+0xF8, 0xFE, 0x07, 0x03, 0x03, 0x07, 0xFE, 0xF8, 0x07, 0x1F, 0x38, 0x30, 0x30, 0x38, 0x1F, 0x07,  // 'O'
+0xFF, 0xFF, 0x83, 0x83, 0x83, 0xC7, 0xFE, 0x7C, 0x3F, 0x3F, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,  // 'P'
+0xF8, 0xFE, 0x07, 0x03, 0x03, 0x07, 0xFE, 0xF8, 0x00, 0x07, 0x1F, 0x38, 0x30, 0x36, 0x3C, 0x1F, 0x17, 0x20,  // 'Q'
+0xFF, 0xFF, 0xC3, 0xC3, 0xC3, 0xE7, 0x7E, 0x3C, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x01, 0x07, 0x1E, 0x38, 0x20,  // 'R'
+0x00, 0x3C, 0x7E, 0x63, 0xC3, 0xC3, 0x8E, 0x0C, 0x06, 0x1E, 0x38, 0x30, 0x30, 0x31, 0x1F, 0x0F,  // 'S'
+0x03, 0x03, 0x03, 0x03, 0xFF, 0xFF, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00,  // 'T'
+0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x0F, 0x1F, 0x38, 0x30, 0x30, 0x38, 0x1F, 0x0F,  // 'U'
+0x07, 0x3F, 0xF8, 0xC0, 0x00, 0xC0, 0xF8, 0x3F, 0x07, 0x00, 0x00, 0x03, 0x1F, 0x3C, 0x1F, 0x03, 0x00, 0x00,  // 'V'
+0x3F, 0xFF, 0x00, 0x00, 0xE0, 0xE0, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x3F, 0x38, 0x0F, 0x01, 0x01, 0x0F, 0x38, 0x3F, 0x00,  // 'W'
+0x01, 0x07, 0x1E, 0x38, 0xF0, 0xE0, 0x38, 0x1C, 0x07, 0x01, 0x20, 0x38, 0x1C, 0x0F, 0x07, 0x03, 0x07, 0x1E, 0x38, 0x20,  // 'X'
+0x01, 0x07, 0x1E, 0x78, 0xE0, 0xE0, 0x78, 0x1E, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00,  // 'Y'
+0x00, 0x03, 0x03, 0xC3, 0xE3, 0x3B, 0x1F, 0x07, 0x38, 0x3C, 0x37, 0x33, 0x30, 0x30, 0x30, 0x30,  // 'Z'
+0xFF, 0xFF, 0x03, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03,  // '['
+0x07, 0x7F, 0xF8, 0x80, 0x00, 0x00, 0x00, 0x07, 0x3F, 0x38,  // '\'
+0x03, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x03, 0x03, 0x03, 0x03,  // ']'
+0xC0, 0xF0, 0x3C, 0x07, 0x07, 0x3C, 0xF0, 0xC0,  // '^'
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,  // '_'
+0x01, 0x03, 0x07, 0x04,  // '`'
+0xC4, 0xE6, 0x33, 0x33, 0x33, 0xB3, 0xFF, 0xFE, 0x00, 0x01, 0x03, 0x03, 0x03, 0x01, 0x01, 0x01, 0x03, 0x02,  // 'a'
+0xFF, 0xFF, 0x60, 0x30, 0x30, 0x70, 0xE0, 0xC0, 0x3F, 0x3F, 0x18, 0x30, 0x30, 0x38, 0x1F, 0x0F,  // 'b'
+0xFC, 0xFE, 0x87, 0x03, 0x03, 0x87, 0xCE, 0xCC, 0x00, 0x01, 0x03, 0x03, 0x03, 0x03, 0x01, 0x00,  // 'c'
+0xC0, 0xE0, 0x70, 0x30, 0x30, 0x60, 0xFF, 0xFF, 0x0F, 0x1F, 0x38, 0x30, 0x30, 0x18, 0x3F, 0x3F,  // 'd'
+0xFC, 0xFE, 0xB7, 0x33, 0x33, 0x37, 0xBE, 0xB8, 0x00, 0x01, 0x03, 0x03, 0x03, 0x03, 0x01, 0x00,  // 'e'
+0x30, 0x30, 0x30, 0xFE, 0xFF, 0x33, 0x33, 0x33, 0x03, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00,  // 'f'
+0xFC, 0xFE, 0x87, 0x03, 0x03, 0x86, 0xFF, 0xFF, 0x18, 0x39, 0x33, 0x33, 0x33, 0x39, 0x1F, 0x0F,  // 'g'
+0xFF, 0xFF, 0x60, 0x30, 0x30, 0x30, 0xF0, 0xE0, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F,  // 'h'
+0x30, 0x30, 0x30, 0xF3, 0xF3, 0x00, 0x00, 0x00, 0x3F, 0x3F,  // 'i'
+0x00, 0x30, 0x30, 0x30, 0xF3, 0xF3, 0x80, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0x03, 0x03, 0x03, 0x03, 0x01,  // 'j'
+0xFF, 0xFF, 0x00, 0x80, 0xC0, 0x60, 0x30, 0x10, 0x00, 0x3F, 0x3F, 0x03, 0x01, 0x03, 0x0E, 0x1C, 0x30, 0x20,  // 'k'
+0x03, 0x03, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0x3F,  // 'l'
+0xFF, 0xFF, 0x02, 0x03, 0xFF, 0xFF, 0x06, 0x03, 0xFF, 0xFE, 0x03, 0x03, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x03, 0x03,  // 'm'
+0xFF, 0xFF, 0x06, 0x03, 0x03, 0x03, 0xFF, 0xFE, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03,  // 'n'
+0xFC, 0xFE, 0x87, 0x03, 0x03, 0x87, 0xFE, 0xFC, 0x00, 0x01, 0x03, 0x03, 0x03, 0x03, 0x01, 0x00,  // 'o'
+0xFF, 0xFF, 0x86, 0x03, 0x03, 0x87, 0xFE, 0xFC, 0x3F, 0x3F, 0x01, 0x03, 0x03, 0x03, 0x01, 0x00,  // 'p'
+0xFC, 0xFE, 0x87, 0x03, 0x03, 0x86, 0xFF, 0xFF, 0x00, 0x01, 0x03, 0x03, 0x03, 0x01, 0x3F, 0x3F,  // 'q'
+0x01, 0xFF, 0xFE, 0x06, 0x03, 0x03, 0x07, 0x02, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,  // 'r'
+0x9C, 0xBE, 0x33, 0x33, 0x33, 0x33, 0xF6, 0xE6, 0x01, 0x01, 0x03, 0x03, 0x03, 0x03, 0x01, 0x00,  // 's'
+0x18, 0x18, 0xFE, 0xFF, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x0F, 0x1F, 0x18, 0x18, 0x18, 0x18,  // 't'
+0xFF, 0xFF, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x01, 0x03, 0x03, 0x03, 0x03, 0x01, 0x03, 0x03,  // 'u'
+0x01, 0x0F, 0x7E, 0xF0, 0x80, 0xF0, 0x7E, 0x0F, 0x01, 0x00, 0x00, 0x00, 0x01, 0x03, 0x03, 0x00, 0x00, 0x00,  // 'v'
+0x07, 0xFF, 0xC0, 0xFF, 0x07, 0xFF, 0xC0, 0xFF, 0x07, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,  // 'w'
+0x01, 0x87, 0xCE, 0x78, 0x78, 0xCE, 0x87, 0x01, 0x02, 0x03, 0x01, 0x00, 0x00, 0x01, 0x03, 0x02,  // 'x'
+0x03, 0x1F, 0xFC, 0xE0, 0x00, 0xF8, 0xFF, 0x07, 0x30, 0x30, 0x38, 0x1F, 0x1F, 0x07, 0x00, 0x00,  // 'y'
+0x03, 0x83, 0xC3, 0x63, 0x33, 0x1B, 0x0F, 0x07, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,  // 'z'
+0x00, 0x80, 0xFE, 0xFF, 0x03, 0x03, 0x03, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x03, 0x03,  // '{'
+0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x03,  // '|'
+0x03, 0x03, 0xFF, 0xFE, 0x80, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x07, 0x03, 0x03, 0x03, 0x03, 0x01, 0x00, 0x00,  // '}'
+0x06, 0x03, 0x03, 0x03, 0x06, 0x06, 0x06, 0x03,  // '~'
+};
+
+const OLED_FontGlyph_t OLED_FontProp11x18_Glyphs [] = {
+{    0,  0,  0, 0,  0,  5 },  // sp
+{    0,  2, 14, 0,  1,  4 },  // '!'
+{    4,  5,  5, 0,  1,  7 },  // '"'
+{    9,  9, 14, 0,  1, 11 },  // '#'
+{   27,  8, 16, 0,  1, 10 },  // '$'
+{   43, 10, 14, 0,  1, 12 },  // '%'
+{   63,  9, 14, 0,  1, 11 },  // '&'
+{   81,  2,  5, 0,  1,  4 },  // '''
+{   83,  5, 18, 0,  0,  7 },  // '('
+{   98,  5, 18, 0,  0,  7 },  // ')'
+{  113,  6,  5, 0,  1,  8 },  // '*'
+{  119, 10, 10, 0,  3, 12 },  // '+'
+{  139,  2,  5, 0, 13,  4 },  // ','
+{  141,  4,  2, 0,  9,  6 },  // '-'
+{  145,  2,  2, 0, 13,  4 },  // '.'
+{  147,  5, 14, 0,  1,  7 },  // '/'
+{  157,  8, 14, 0,  1, 10 },  // '0'
+{  173,  5, 14, 0,  1,  7 },  // '1'
+{  183,  8, 14, 0,  1, 10 },  // '2'
+{  199,  8, 14, 0,  1, 10 },  // '3'
+{  215,  8, 14, 0,  1, 10 },  // '4'
+{  231,  8, 14, 0,  1, 10 },  // '5'
+{  247,  8, 14, 0,  1, 10 },  // '6'
+{  263,  8, 14, 0,  1, 10 },  // '7'
+{  279,  8, 14, 0,  1, 10 },  // '8'
+{  295,  8, 14, 0,  1, 10 },  // '9'
+{  311,  2, 10, 0,  5,  4 },  // ':'
+{  315,  2, 12, 0,  6,  4 },  // ';'
+{  319,  8,  9, 0,  4, 10 },  // '<'
+{  335,  8,  6, 0,  5, 10 },  // '='
+{  343,  8,  9, 0,  4, 10 },  // '>'
+{  359,  9, 14, 0,  1, 11 },  // '?'
+{  377,  8, 14, 0,  1, 10 },  // '@'
+{  393,  9, 14, 0,  1, 11 },  // 'A'
+{  411,  8, 14, 0,  1, 10 },  // 'B'
+{  427,  8, 14, 0,  1, 10 },  // 'C'
+{  443,  8, 14, 0,  1, 10 },  // 'D'
+{  459,  8, 14, 0,  1, 10 },  // 'E'
+{  475,  8, 14, 0,  1, 10 },  // 'F'
+{  491,  8, 14, 0,  1, 10 },  // 'G'
+{  507,  8, 14, 0,  1, 10 },  // 'H'
+{  523,  6, 14, 0,  1,  8 },  // 'I'
+{  535,  8, 14, 0,  1, 10 },  // 'J'
+{  551,  9, 14, 0,  1, 11 },  // 'K'
+{  569,  8, 14, 0,  1, 10 },  // 'L'
+{  585,  9, 14, 0,  1, 11 },  // 'M'
+{  603,  8, 14, 0,  1, 10 },  // 'N'
+{  619,  8, 14, 0,  1, 10 },  // 'O'
+{  635,  8, 14, 0,  1, 10 },  // 'P'
+{  651,  9, 14, 0,  1, 11 },  // 'Q'
+{  669,  9, 14, 0,  1, 11 },  // 'R'
+{  687,  8, 14, 0,  1, 10 },  // 'S'
+{  703, 10, 14, 0,  1, 12 },  // 'T'
+{  723,  8, 14, 0,  1, 10 },  // 'U'
+{  739,  9, 14, 0,  1, 11 },  // 'V'
+{  757, 10, 14, 0,  1, 12 },  // 'W'
+{  777, 10, 14, 0,  1, 12 },  // 'X'
+{  797, 10, 14, 0,  1, 12 },  // 'Y'
+{  817,  8, 14, 0,  1, 10 },  // 'Z'
+{  833,  4, 18, 0,  0,  6 },  // '['
+{  845,  5, 14, 0,  1,  7 },  // '\'
+{  855,  4, 18, 0,  0,  6 },  // ']'
+{  867,  8,  8, 0,  1, 10 },  // '^'
+{  875, 11,  1, 0, 16, 13 },  // '_'
+{  886,  4,  3, 0,  1,  6 },  // '`'
+{  890,  9, 10, 0,  5, 11 },  // 'a'
+{  908,  8, 14, 0,  1, 10 },  // 'b'
+{  924,  8, 10, 0,  5, 10 },  // 'c'
+{  940,  8, 14, 0,  1, 10 },  // 'd'
+{  956,  8, 10, 0,  5, 10 },  // 'e'
+{  972,  9, 14, 0,  1, 11 },  // 'f'
+{  990,  8, 14, 0,  4, 10 },  // 'g'
+{ 1006,  8, 14, 0,  1, 10 },  // 'h'
+{ 1022,  5, 14, 0,  1,  7 },  // 'i'
+{ 1032,  6, 18, 0,  0,  8 },  // 'j'
+{ 1050,  9, 14, 0,  1, 11 },  // 'k'
+{ 1068,  5, 14, 0,  1,  7 },  // 'l'
+{ 1078, 10, 10, 0,  5, 12 },  // 'm'
+{ 1098,  8, 10, 0,  5, 10 },  // 'n'
+{ 1114,  8, 10, 0,  5, 10 },  // 'o'
+{ 1130,  8, 14, 0,  4, 10 },  // 'p'
+{ 1146,  8, 14, 0,  4, 10 },  // 'q'
+{ 1162,  8, 10, 0,  5, 10 },  // 'r'
+{ 1178,  8, 10, 0,  5, 10 },  // 's'
+{ 1194,  8, 13, 0,  2, 10 },  // 't'
+{ 1210,  8, 10, 0,  5, 10 },  // 'u'
+{ 1226,  9, 10, 0,  5, 11 },  // 'v'
+{ 1244,  9, 10, 0,  5, 11 },  // 'w'
+{ 1262,  8, 10, 0,  5, 10 },  // 'x'
+{ 1278,  8, 14, 0,  4, 10 },  // 'y'
+{ 1294,  9, 10, 0,  5, 11 },  // 'z'
+{ 1312,  6, 18, 0,  0,  8 },  // '{'
+{ 1330,  2, 18, 0,  0,  4 },  // '|'
+{ 1336,  6, 18, 0,  0,  8 },  // '}'
+{ 1354,  8,  3, 0,  7, 10 },  // '~'
+};
+
+const OLED_FontKern_t OLED_FontProp11x18_Kerning [] = {
+{ '"', ',', -3 }, { '"', '.', -3 }, { '"', 'A', -2 }, { '"', 'J', -3 }, { '"', 'a', -1 }, { '"', 'c', -1 }, { '"', 'd', -1 }, { '"', 'e', -1 },
+{ '"', 'o', -1 }, { '"', 's', -1 }, { '\'', ',', -3 }, { '\'', '.', -3 }, { '\'', 'A', -2 }, { '\'', 'J', -3 }, { '\'', 'a', -1 }, { '\'', 'c', -1 },
+{ '\'', 'd', -1 }, { '\'', 'e', -1 }, { '\'', 'o', -1 }, { '\'', 's', -1 }, { '.', '"', -3 }, { '.', '\'', -3 }, { '.', 'T', -3 }, { '.', 'V', -3 },
+{ '.', 'W', -1 }, { '.', 'Y', -3 }, { '.', 'q', -1 }, { '.', 'r', -1 }, { '.', 'v', -3 }, { '.', 'w', -1 }, { '.', 'y', -2 }, { 'A', '"', -2 },
+{ 'A', '\'', -2 }, { 'A', 'T', -2 }, { 'A', 'V', -2 }, { 'A', 'W', -1 }, { 'A', 'Y', -3 }, { 'A', 'r', -1 }, { 'A', 'v', -2 }, { 'A', 'w', -1 },
+{ 'A', 'y', -2 }, { 'F', ',', -3 }, { 'F', '.', -3 }, { 'F', 'A', -2 }, { 'F', 'J', -3 }, { 'F', 'a', -1 }, { 'F', 'c', -1 }, { 'F', 'd', -1 },
+{ 'F', 'e', -1 }, { 'F', 'g', -1 }, { 'F', 'm', -1 }, { 'F', 'n', -1 }, { 'F', 'o', -1 }, { 'F', 'p', -1 }, { 'F', 'q', -1 }, { 'F', 'r', -2 },
+{ 'F', 's', -1 }, { 'F', 'u', -1 }, { 'F', 'v', -2 }, { 'F', 'w', -1 }, { 'F', 'x', -2 }, { 'F', 'y', -2 }, { 'F', 'z', -1 }, { 'L', '"', -3 },
+{ 'L', '\'', -3 }, { 'L', 'T', -3 }, { 'L', 'V', -3 }, { 'L', 'W', -1 }, { 'L', 'Y', -3 }, { 'L', 'q', -1 }, { 'L', 'r', -1 }, { 'L', 'v', -3 },
+{ 'L', 'w', -1 }, { 'L', 'y', -2 }, { 'P', ',', -3 }, { 'P', '.', -3 }, { 'P', 'A', -1 }, { 'P', 'J', -2 }, { 'P', 'Y', -1 }, { 'T', ',', -3 },
+{ 'T', '.', -3 }, { 'T', 'A', -2 }, { 'T', 'J', -3 }, { 'T', 'a', -3 }, { 'T', 'c', -3 }, { 'T', 'd', -3 }, { 'T', 'e', -3 }, { 'T', 'g', -3 },
+{ 'T', 'm', -3 }, { 'T', 'n', -3 }, { 'T', 'o', -3 }, { 'T', 'p', -3 }, { 'T', 'q', -3 }, { 'T', 'r', -3 }, { 'T', 's', -3 }, { 'T', 'u', -3 },
+{ 'T', 'v', -3 }, { 'T', 'w', -3 }, { 'T', 'x', -3 }, { 'T', 'y', -3 }, { 'T', 'z', -3 }, { 'V', ',', -3 }, { 'V', '.', -3 }, { 'V', 'A', -2 },
+{ 'V', 'J', -2 }, { 'V', 'a', -1 }, { 'V', 'c', -1 }, { 'V', 'd', -1 }, { 'V', 'e', -1 }, { 'V', 'g', -1 }, { 'V', 'm', -1 }, { 'V', 'n', -1 },
+{ 'V', 'o', -1 }, { 'V', 'q', -1 }, { 'V', 'r', -1 }, { 'V', 's', -1 }, { 'V', 'u', -1 }, { 'V', 'v', -1 }, { 'V', 'w', -1 }, { 'V', 'x', -1 },
+{ 'V', 'z', -1 }, { 'W', ',', -1 }, { 'W', '.', -1 }, { 'W', 'A', -1 }, { 'W', 'J', -1 }, { 'Y', ',', -3 }, { 'Y', '.', -3 }, { 'Y', 'A', -3 },
+{ 'Y', 'J', -3 }, { 'Y', 'a', -3 }, { 'Y', 'c', -3 }, { 'Y', 'd', -3 }, { 'Y', 'e', -3 }, { 'Y', 'g', -2 }, { 'Y', 'm', -2 }, { 'Y', 'n', -2 },
+{ 'Y', 'o', -3 }, { 'Y', 'p', -1 }, { 'Y', 'q', -2 }, { 'Y', 'r', -2 }, { 'Y', 's', -3 }, { 'Y', 'u', -2 }, { 'Y', 'v', -2 }, { 'Y', 'w', -2 },
+{ 'Y', 'x', -2 }, { 'Y', 'y', -1 }, { 'Y', 'z', -2 }, { 'r', ',', -3 }, { 'r', '.', -3 }, { 'r', 'A', -1 }, { 'r', 'J', -3 }, { 'r', 'T', -3 },
+{ 'r', 'V', -1 }, { 'r', 'Y', -2 }, { 'v', ',', -3 }, { 'v', '.', -3 }, { 'v', 'A', -2 }, { 'v', 'J', -2 }, { 'v', 'T', -3 }, { 'v', 'V', -1 },
+{ 'v', 'Y', -2 }, { 'v', 'a', -1 }, { 'v', 'c', -1 }, { 'v', 'd', -1 }, { 'v', 'e', -1 }, { 'v', 'o', -1 }, { 'v', 's', -1 }, { 'w', ',', -1 },
+{ 'w', '.', -1 }, { 'w', 'A', -1 }, { 'w', 'J', -1 }, { 'w', 'T', -3 }, { 'w', 'V', -1 }, { 'w', 'Y', -2 }, { 'y', ',', -2 }, { 'y', '.', -2 },
+{ 'y', 'A', -1 }, { 'y', 'J', -1 }, { 'y', 'T', -3 }, { 'y', 'Y', -1 },
+};
+
+const OLED_FontMetrics_t OLED_FontProp11x18_Metrics = { OLED_FontProp11x18_Glyphs, OLED_FontProp11x18_Bitmap,
+                                                   OLED_FontProp11x18_Kerning, 180 };
+
+
+/* Bit-packed versions of the fixed width tables, the smaller of back to back bits and byte aligned glyphs with
+   a run-length coded version wherever that is shorter. Generated from the tables above */
+const uint8_t OLED_FontPacked7x10_Bits [] = {
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0B, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x40, 0xCF, 0x0B, 0x24, 0xD0,
+0xF3, 0x02, 0x00, 0x00, 0x98, 0x91, 0xC8, 0x7F, 0x89, 0xC8, 0x01, 0x00, 0x00, 0x26, 0x64, 0xE0,
+0x06, 0x25, 0x62, 0x00, 0x00, 0x00, 0x18, 0x96, 0x64, 0x62, 0x06, 0x24, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x8F, 0x40, 0x01, 0x02, 0x00, 0x00, 0x00,
+0x00, 0x04, 0x28, 0x10, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x1C, 0xA0, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x01, 0x04, 0x7C, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x3C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x11, 0x48,
+0x22, 0x81, 0xF8, 0x01, 0x00, 0x00, 0x04, 0x08, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x80, 0x21,
+0xC1, 0x84, 0x12, 0x89, 0x23, 0x00, 0x00, 0x20, 0x44, 0x20, 0x89, 0x24, 0x62, 0x07, 0x00, 0x00,
+0xC0, 0xC0, 0x82, 0x08, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x4F, 0x24, 0x92, 0x48, 0x22, 0x71, 0x00,
+0x00, 0x80, 0x1F, 0x89, 0x24, 0x92, 0x88, 0x1C, 0x00, 0x00, 0x10, 0x40, 0x38, 0x19, 0x14, 0x30,
+0x00, 0x00, 0x00, 0xD8, 0x91, 0x48, 0x22, 0x89, 0xD8, 0x01, 0x00, 0x00, 0x4E, 0x44, 0x12, 0x49,
+0x24, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x88, 0x03, 0x00, 0x00, 0x00, 0x00, 0x40, 0x80, 0x02, 0x0A, 0x44, 0x10, 0x01, 0x00, 0x00, 0x28,
+0xA0, 0x80, 0x02, 0x0A, 0x28, 0x00, 0x00, 0x00, 0x11, 0x44, 0xA0, 0x80, 0x02, 0x04, 0x00, 0x00,
+0x20, 0x40, 0x00, 0xB1, 0x24, 0x60, 0x00, 0x00, 0x00, 0xF8, 0x11, 0x48, 0x26, 0x95, 0x78, 0x00,
+0x00, 0x00, 0xE0, 0xF8, 0x10, 0x82, 0x0F, 0xE0, 0x00, 0x00, 0xC0, 0x3F, 0x89, 0x24, 0x92, 0x88,
+0x1D, 0x00, 0x00, 0xE0, 0x47, 0x20, 0x81, 0x04, 0x22, 0x04, 0x00, 0x00, 0xFC, 0x13, 0x48, 0x20,
+0x42, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x24, 0x92, 0x48, 0x22, 0x89, 0x00, 0x00, 0xC0, 0x3F, 0x09,
+0x24, 0x90, 0x40, 0x00, 0x00, 0x00, 0xE0, 0x47, 0x20, 0x91, 0x44, 0x22, 0x07, 0x00, 0x00, 0xFC,
+0x83, 0x00, 0x02, 0x08, 0xFC, 0x03, 0x00, 0x00, 0x00, 0x04, 0xF2, 0x4F, 0x20, 0x00, 0x00, 0x00,
+0x00, 0x10, 0x80, 0x00, 0x02, 0xC8, 0x1F, 0x00, 0x00, 0xF0, 0x0F, 0x02, 0x14, 0x88, 0x11, 0x08,
+0x00, 0x00, 0xFC, 0x03, 0x08, 0x20, 0x80, 0x00, 0x02, 0x00, 0x00, 0xFF, 0x18, 0x80, 0x80, 0x01,
+0xFF, 0x00, 0x00, 0xC0, 0x3F, 0x06, 0x60, 0x00, 0xC6, 0x3F, 0x00, 0x00, 0xE0, 0x47, 0x20, 0x81,
+0x04, 0xE2, 0x07, 0x00, 0x00, 0xFC, 0x13, 0x41, 0x04, 0x11, 0x38, 0x00, 0x00, 0x00, 0x7E, 0x04,
+0x12, 0x4C, 0x20, 0x7E, 0x01, 0x00, 0xC0, 0x3F, 0x11, 0x44, 0x10, 0x87, 0x23, 0x00, 0x00, 0x60,
+0x44, 0x22, 0x89, 0x44, 0x22, 0x06, 0x00, 0x00, 0x04, 0x10, 0xC0, 0x3F, 0x01, 0x04, 0x00, 0x00,
+0x00, 0x7F, 0x00, 0x02, 0x08, 0x20, 0x7F, 0x00, 0x00, 0xC0, 0x01, 0x38, 0x00, 0x83, 0xC3, 0x01,
+0x00, 0x00, 0xF0, 0x03, 0x38, 0x1C, 0x80, 0xF3, 0x03, 0x00, 0x00, 0x04, 0x62, 0x06, 0x06, 0x66,
+0x04, 0x02, 0x00, 0x00, 0x03, 0x30, 0x00, 0x0F, 0x03, 0x03, 0x00, 0x00, 0x40, 0x30, 0xA1, 0x64,
+0x52, 0xC8, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x07, 0x08, 0x00, 0x00, 0x00, 0x00, 0x30,
+0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x02, 0x06, 0x04, 0x60, 0x00, 0x02, 0x00, 0x00, 0x08, 0x20, 0x80, 0x00, 0x02, 0x08, 0x20, 0x80,
+0x00, 0x00, 0x10, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x50, 0x42, 0x09, 0x15, 0xF8,
+0x00, 0x00, 0xC0, 0x3F, 0x48, 0x10, 0x42, 0x08, 0x1E, 0x00, 0x00, 0x80, 0x07, 0x21, 0x84, 0x10,
+0x82, 0x04, 0x00, 0x00, 0xE0, 0x41, 0x08, 0x21, 0x48, 0xFC, 0x03, 0x00, 0x00, 0x78, 0x50, 0x42,
+0x09, 0x25, 0x58, 0x00, 0x00, 0x00, 0x01, 0x04, 0xF8, 0x53, 0x40, 0x01, 0x00, 0x00, 0x80, 0x27,
+0xA1, 0x84, 0x22, 0xC9, 0x1F, 0x00, 0x00, 0xFC, 0x83, 0x00, 0x01, 0x04, 0xE0, 0x03, 0x00, 0x00,
+0x04, 0x10, 0xD0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x20, 0x81, 0x04, 0xF6, 0x07, 0x00, 0x00, 0x00,
+0x00, 0xF0, 0x0F, 0x04, 0x28, 0x10, 0x01, 0x08, 0x00, 0x00, 0x04, 0x10, 0xC0, 0x3F, 0x00, 0x00,
+0x00, 0x00, 0x00, 0xFC, 0x10, 0xC0, 0x0F, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0x08, 0x10, 0x40,
+0x00, 0x3E, 0x00, 0x00, 0x80, 0x07, 0x21, 0x84, 0x10, 0x82, 0x07, 0x00, 0x00, 0xF0, 0x8F, 0x04,
+0x21, 0x84, 0xE0, 0x01, 0x00, 0x00, 0x78, 0x10, 0x42, 0x08, 0x12, 0xFC, 0x03, 0x00, 0x00, 0x3F,
+0x08, 0x10, 0x40, 0x00, 0x02, 0x00, 0x00, 0x80, 0x04, 0x25, 0x94, 0x90, 0x82, 0x04, 0x00, 0x00,
+0x10, 0xF0, 0x07, 0x21, 0x84, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x02, 0x08, 0x10, 0xFC, 0x00,
+0x00, 0x00, 0x03, 0x70, 0x00, 0x02, 0x07, 0x03, 0x00, 0x00, 0xC0, 0x03, 0x38, 0x1C, 0x80, 0xC3,
+0x03, 0x00, 0x00, 0x10, 0x82, 0x04, 0x0C, 0x48, 0x10, 0x02, 0x00, 0x00, 0x0C, 0xC2, 0x08, 0x1C,
+0x0C, 0x0C, 0x00, 0x00, 0x00, 0x31, 0xA4, 0x50, 0xC2, 0x08, 0x21, 0x00, 0x00, 0x00, 0x00, 0x0C,
+0xCF, 0x07, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x04, 0xF8, 0x3C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x06, 0x08, 0x20, 0x00, 0x01, 0x06, 0x00, 0x00,
+};
+
+const OLED_FontPacked_t OLED_FontPacked7x10 = { NULL, OLED_FontPacked7x10_Bits };
+
+const uint8_t OLED_FontPacked11x18_Bits [] = {
+0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x03,  // sp RLE
+0x0F, 0x0F, 0x0F, 0x0F, 0xBD, 0x21, 0xB4, 0x21, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x03,  // '!' RLE
+0x0F, 0x0F, 0x0F, 0x5A, 0x5D, 0x0F, 0x0F, 0x51, 0x5D, 0x0F, 0x0F, 0x0F, 0x0F, 0x06,  // '"' RLE
+0x0F, 0x28, 0x22, 0x2C, 0x71, 0xE4, 0x74, 0x21, 0x2C, 0x22, 0x2C, 0x71, 0xE4, 0x74, 0x21, 0x2C, 0x22, 0x0F, 0x0A,  // '#' RLE
+0x0F, 0x36, 0x34, 0x57, 0x43, 0x35, 0x31, 0x34, 0x24, 0x23, 0x25, 0xF4, 0x10, 0x22, 0x24, 0x24, 0x35, 0x63, 0x27, 0x44, 0x0F, 0x0F, 0x0B,  // '$' RLE
+0x42, 0x6D, 0x24, 0x16, 0x14, 0x23, 0x67, 0x22, 0x49, 0x22, 0x2F, 0x41, 0x2A, 0x61, 0x28, 0x12, 0x14, 0x27, 0x63, 0x26, 0x45, 0x0F, 0x07,  // '%' RLE
+0x0F, 0x4C, 0x47, 0x62, 0x65, 0x11, 0x24, 0x24, 0x33, 0x24, 0x24, 0x43, 0x23, 0x64, 0x22, 0x21, 0x46, 0x34, 0x7D, 0x2B, 0x13, 0x0F, 0x07,  // '&' RLE
+0x0F, 0x0F, 0x0F, 0x0F, 0x5D, 0x5D, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0C,  // ''' RLE
+0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x63, 0xC9, 0x35, 0x38, 0x23, 0x2C, 0x11, 0x0F, 0x11, 0x0F, 0x0F, 0x06,  // '(' RLE
+0x0F, 0x0F, 0x16, 0x0F, 0x11, 0x21, 0x2C, 0x33, 0x38, 0xC5, 0x69, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x03,  // ')' RLE
+0x0F, 0x0F, 0x28, 0x11, 0x3F, 0x4D, 0x4E, 0x0F, 0x31, 0x2E, 0x11, 0x0F, 0x0F, 0x0F, 0x0F, 0x06,  // '*' RLE
+0x27, 0x0F, 0x21, 0x0F, 0x21, 0x0F, 0x21, 0xAC, 0xA8, 0x2C, 0x0F, 0x21, 0x0F, 0x21, 0x0F, 0x21, 0x0F, 0x0C,  // '+' RLE
+0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x2A, 0x12, 0x4D, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01,  // ',' RLE
+0x0F, 0x0F, 0x0F, 0x0F, 0x23, 0x0F, 0x21, 0x0F, 0x21, 0x0F, 0x21, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x04,  // '-' RLE
+0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x2A, 0x0F, 0x21, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x03,  // '.' RLE
+0x0F, 0x0F, 0x0F, 0x0F, 0x36, 0x7B, 0x87, 0x77, 0x3B, 0x0F, 0x0F, 0x0F, 0x0F, 0x08,  // '/' RLE
+0x0F, 0x87, 0xC8, 0x35, 0x38, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x34, 0x38, 0xC5, 0x88, 0x0F, 0x0F, 0x0C,  // '0' RLE
+0x0F, 0x0F, 0x2A, 0x2F, 0x2F, 0xEF, 0xE4, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,  // '1' RLE
+0x0F, 0x36, 0x36, 0x45, 0x45, 0x34, 0x26, 0x21, 0x24, 0x26, 0x22, 0x24, 0x25, 0x23, 0x34, 0x23, 0x24, 0x65, 0x25, 0x46, 0x26, 0x0F, 0x0F, 0x09,  // '2' RLE
+0x0F, 0x26, 0x26, 0x37, 0x36, 0x25, 0x39, 0x24, 0x23, 0x25, 0x24, 0x23, 0x25, 0x75, 0x33, 0x36, 0x62, 0x4D, 0x0F, 0x0F, 0x0B,  // '3' RLE
+0x0F, 0x3C, 0x5D, 0x5A, 0x21, 0x48, 0x24, 0xE7, 0xE4, 0x2D, 0x0F, 0x21, 0x0F, 0x0F, 0x0C,  // '4' RLE
+0x0F, 0x84, 0x22, 0x86, 0x32, 0x25, 0x14, 0x34, 0x24, 0x23, 0x25, 0x24, 0x23, 0x25, 0x24, 0x33, 0x33, 0x24, 0x74, 0x5C, 0x0F, 0x0F, 0x0B,  // '5' RLE
+0x0F, 0x87, 0xC8, 0x35, 0x23, 0x33, 0x24, 0x23, 0x25, 0x24, 0x23, 0x25, 0x34, 0x32, 0x33, 0x35, 0x72, 0x27, 0x53, 0x0F, 0x0F, 0x0B,  // '6' RLE
+0x0F, 0x24, 0x0F, 0x21, 0x0F, 0x21, 0x39, 0x24, 0x75, 0x24, 0x53, 0x28, 0x41, 0x5B, 0x3D, 0x0F, 0x0F, 0x0F, 0x05,  // '7' RLE
+0x0F, 0x36, 0x43, 0x57, 0x61, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x34, 0x23, 0x24, 0x55, 0x61, 0x37, 0x43, 0x0F, 0x0F, 0x0B,  // '8' RLE
+0x0F, 0x56, 0x23, 0x77, 0x32, 0x35, 0x33, 0x32, 0x24, 0x25, 0x23, 0x24, 0x25, 0x23, 0x34, 0x23, 0x33, 0xC5, 0x88, 0x0F, 0x0F, 0x0C,  // '9' RLE
+0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x22, 0x26, 0x28, 0x26, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x03,  // ':' RLE
+0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x23, 0x25, 0x12, 0x26, 0x45, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01,  // ';' RLE
+0x0F, 0x1B, 0x0F, 0x31, 0x1F, 0x11, 0x2E, 0x21, 0x1D, 0x13, 0x2C, 0x23, 0x1B, 0x15, 0x2A, 0x25, 0x0F, 0x0F, 0x0B,  // '<' RLE
+0x0F, 0x28, 0x22, 0x2C, 0x22, 0x2C, 0x22, 0x2C, 0x22, 0x2C, 0x22, 0x2C, 0x22, 0x2C, 0x22, 0x2C, 0x22, 0x0F, 0x0F, 0x0D,  // '=' RLE
+0x0F, 0x27, 0x25, 0x1A, 0x15, 0x2B, 0x23, 0x1C, 0x13, 0x2D, 0x21, 0x1E, 0x11, 0x3F, 0x0F, 0x11, 0x0F, 0x0F, 0x0F,  // '>' RLE
+0x0F, 0x26, 0x3F, 0x3E, 0x2F, 0x36, 0x21, 0x24, 0x45, 0x21, 0x24, 0x34, 0x39, 0x32, 0x6B, 0x4D, 0x0F, 0x0E,  // '?' RLE
+0x0F, 0x87, 0xC8, 0x45, 0x37, 0x24, 0x43, 0x23, 0x24, 0x53, 0x22, 0x24, 0x22, 0x22, 0x21, 0x96, 0x8A, 0x0F, 0x0F, 0x0D,  // '@' RLE
+0x0F, 0x3F, 0x8A, 0x96, 0x67, 0x22, 0x28, 0x26, 0x68, 0x22, 0x9A, 0x8D, 0x3F, 0x0F, 0x06,  // 'A' RLE
+0x0F, 0xE4, 0xE4, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x85, 0x32, 0x46, 0x52, 0x3E, 0x0F, 0x0F, 0x0B,  // 'B' RLE
+0x0F, 0x87, 0xC8, 0x35, 0x38, 0x24, 0x2A, 0x24, 0x2A, 0x24, 0x2A, 0x35, 0x36, 0x27, 0x26, 0x0F, 0x0F, 0x0B,  // 'C' RLE
+0x0F, 0xE4, 0xE4, 0x24, 0x2A, 0x24, 0x2A, 0x24, 0x2A, 0x35, 0x36, 0xB6, 0x79, 0x0F, 0x0F, 0x0D,  // 'D' RLE
+0x0F, 0xE4, 0xE4, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x2A, 0x0F, 0x0F, 0x09,  // 'E' RLE
+0x0F, 0xE4, 0xE4, 0x24, 0x24, 0x2A, 0x24, 0x2A, 0x24, 0x2A, 0x24, 0x2A, 0x24, 0x2A, 0x0F, 0x0F, 0x0F, 0x06,  // 'F' RLE
+0x0F, 0x87, 0xC8, 0x35, 0x38, 0x24, 0x2A, 0x24, 0x2A, 0x24, 0x25, 0x23, 0x35, 0x63, 0x27, 0x63, 0x0F, 0x0F, 0x0A,  // 'G' RLE
+0x0F, 0xE4, 0xE4, 0x2A, 0x0F, 0x21, 0x0F, 0x21, 0x0F, 0x21, 0xEA, 0xE4, 0x0F, 0x0F, 0x09,  // 'H' RLE
+0x0F, 0x0F, 0x27, 0x2A, 0x24, 0x2A, 0xE4, 0xE4, 0x24, 0x2A, 0x24, 0x2A, 0x0F, 0x0F, 0x0F, 0x0C,  // 'I' RLE
+0x0F, 0x3D, 0x4F, 0x0F, 0x31, 0x0F, 0x21, 0x0F, 0x21, 0x3F, 0xD4, 0xC5, 0x0F, 0x0F, 0x0B,  // 'J' RLE
+0x0F, 0xE4, 0xE4, 0x2A, 0x3F, 0x3D, 0x31, 0x3A, 0x33, 0x28, 0x37, 0x25, 0x39, 0x14, 0x1C, 0x0F, 0x06,  // 'K' RLE
+0x0F, 0xE4, 0xE4, 0x0F, 0x21, 0x0F, 0x21, 0x0F, 0x21, 0x0F, 0x21, 0x0F, 0x21, 0x0F, 0x21, 0x0F, 0x0F, 0x09,  // 'L' RLE
+0x0F, 0xE4, 0xE4, 0x44, 0x0F, 0x51, 0x0F, 0x22, 0x5C, 0x3B, 0xEF, 0xE4, 0x0F, 0x06,  // 'M' RLE
+0x0F, 0xE4, 0xE4, 0x54, 0x6F, 0x7F, 0x5F, 0xE4, 0xE4, 0x0F, 0x0F, 0x09,  // 'N' RLE
+0x0F, 0x87, 0xC8, 0x35, 0x38, 0x24, 0x2A, 0x24, 0x2A, 0x34, 0x38, 0xC5, 0x88, 0x0F, 0x0F, 0x0C,  // 'O' RLE
+0x0F, 0xE4, 0xE4, 0x24, 0x25, 0x29, 0x25, 0x29, 0x25, 0x39, 0x33, 0x7A, 0x5C, 0x0F, 0x0F, 0x0F, 0x01,  // 'P' RLE
+0x0F, 0x87, 0xC8, 0x35, 0x38, 0x24, 0x2A, 0x24, 0x27, 0x21, 0x34, 0x47, 0xC5, 0x88, 0x11, 0x0F, 0x13, 0x0F, 0x06,  // 'Q' RLE
+0x0F, 0xE4, 0xE4, 0x24, 0x24, 0x2A, 0x24, 0x2A, 0x34, 0x39, 0x62, 0x68, 0x42, 0x47, 0x35, 0x0F, 0x12, 0x0F, 0x06,  // 'R' RLE
+0x0F, 0x2D, 0x49, 0x43, 0x66, 0x34, 0x24, 0x23, 0x25, 0x24, 0x24, 0x24, 0x24, 0x34, 0x23, 0x35, 0x63, 0x27, 0x44, 0x0F, 0x0F, 0x0B,  // 'S' RLE
+0x21, 0x0F, 0x21, 0x0F, 0x21, 0x0F, 0x21, 0x0F, 0xE1, 0xE4, 0x24, 0x0F, 0x21, 0x0F, 0x21, 0x0F, 0x21, 0x0F, 0x0F, 0x03,  // 'T' RLE
+0x0F, 0xC4, 0xD6, 0x0F, 0x31, 0x0F, 0x21, 0x0F, 0x21, 0x3F, 0xD4, 0xC5, 0x0F, 0x0F, 0x0B,  // 'U' RLE
+0x0F, 0x34, 0x6F, 0x7F, 0x7E, 0x4F, 0x7A, 0x78, 0x68, 0x3C, 0x0F, 0x0F, 0x02,  // 'V' RLE
+0x61, 0xEC, 0x3F, 0x4C, 0x4B, 0x4E, 0x0F, 0x42, 0x0F, 0x32, 0xE4, 0x64, 0x0F, 0x0E,  // 'W' RLE
+0x11, 0x1C, 0x34, 0x38, 0x45, 0x35, 0x38, 0x42, 0x7A, 0x5C, 0x3B, 0x32, 0x39, 0x44, 0x35, 0x38, 0x14, 0x1C, 0x0F, 0x06,  // 'X' RLE
+0x11, 0x0F, 0x32, 0x0F, 0x41, 0x0F, 0x41, 0x0F, 0x91, 0x99, 0x47, 0x4C, 0x3D, 0x1F, 0x0F, 0x0F, 0x04,  // 'Y' RLE
+0x0F, 0x3F, 0x24, 0x48, 0x24, 0x36, 0x21, 0x24, 0x44, 0x22, 0x24, 0x33, 0x24, 0x24, 0x31, 0x26, 0x54, 0x27, 0x34, 0x29, 0x0F, 0x0F, 0x09,  // 'Z' RLE
+0x0F, 0x0F, 0x0F, 0x0F, 0xFC, 0xF0, 0x80, 0x4E, 0x2E, 0x0F, 0x0F, 0x0F, 0x09,  // '[' RLE
+0x0F, 0x0F, 0x0F, 0x3A, 0x7F, 0x8E, 0x7E, 0x3F, 0x0F, 0x0F, 0x0F, 0x0C,  // '\' RLE
+0x0F, 0x0F, 0x0F, 0x29, 0x4E, 0xFE, 0xF0, 0x80, 0x0F, 0x0F, 0x0F, 0x0F, 0x0C,  // ']' RLE
+0x0F, 0x2A, 0x4E, 0x4C, 0x3C, 0x3F, 0x0F, 0x42, 0x0F, 0x41, 0x0F, 0x21, 0x0F, 0x0F, 0x0F,  // '^' RLE
+0x0F, 0x11, 0x0F, 0x12, 0x0F, 0x12, 0x0F, 0x12, 0x0F, 0x12, 0x0F, 0x12, 0x0F, 0x12, 0x0F, 0x12, 0x0F, 0x12, 0x0F, 0x12, 0x0F, 0x12, 0x01,  // '_' RLE
+0x0F, 0x0F, 0x17, 0x0F, 0x22, 0x0F, 0x31, 0x0F, 0x12, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0E,  // '`' RLE
+0x0F, 0x1A, 0x33, 0x2A, 0x52, 0x28, 0x22, 0x22, 0x28, 0x22, 0x22, 0x28, 0x22, 0x12, 0x29, 0x22, 0x21, 0x99, 0x9A, 0x0F, 0x12, 0x0F, 0x06,  // 'a' RLE
+0x0F, 0xE4, 0xE4, 0x29, 0x24, 0x29, 0x26, 0x28, 0x26, 0x38, 0x34, 0x89, 0x6B, 0x0F, 0x0F, 0x0B,  // 'b' RLE
+0x0F, 0x6A, 0x8B, 0x39, 0x34, 0x28, 0x26, 0x28, 0x26, 0x38, 0x34, 0x39, 0x32, 0x2B, 0x22, 0x0F, 0x0F, 0x0B,  // 'c' RLE
+0x0F, 0x6A, 0x8B, 0x39, 0x34, 0x28, 0x26, 0x28, 0x26, 0x29, 0x24, 0xE5, 0xE4, 0x0F, 0x0F, 0x09,  // 'd' RLE
+0x0F, 0x6A, 0x8B, 0x39, 0x21, 0x31, 0x28, 0x22, 0x22, 0x28, 0x22, 0x22, 0x38, 0x21, 0x22, 0x59, 0x21, 0x3C, 0x11, 0x0F, 0x0F, 0x0B,  // 'e' RLE
+0x0F, 0x28, 0x0F, 0x21, 0x0F, 0x21, 0xDD, 0xE4, 0x24, 0x22, 0x2C, 0x22, 0x2C, 0x22, 0x2C, 0x0F, 0x0F, 0x03,  // 'f' RLE
+0x0F, 0x69, 0x23, 0x86, 0x32, 0x34, 0x34, 0x22, 0x24, 0x26, 0x22, 0x24, 0x26, 0x22, 0x25, 0x24, 0x32, 0xD4, 0xC5, 0x0F, 0x0F, 0x08,  // 'g' RLE
+0x0F, 0xE4, 0xE4, 0x29, 0x2F, 0x0F, 0x21, 0x0F, 0x21, 0x0F, 0xA1, 0x99, 0x0F, 0x0F, 0x09,  // 'h' RLE
+0x0F, 0x0F, 0x2B, 0x0F, 0x21, 0x0F, 0x21, 0x2C, 0xA2, 0x24, 0xA2, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,  // 'i' RLE
+0x0F, 0x0F, 0x23, 0x25, 0x2A, 0x24, 0x2A, 0x24, 0x4A, 0xF2, 0x10, 0xD2, 0x0F, 0x0F, 0x0F, 0x0F, 0x0D,  // 'j' RLE
+0x0F, 0xE4, 0xE4, 0x2C, 0x2F, 0x4F, 0x2D, 0x32, 0x2A, 0x34, 0x19, 0x27, 0x0F, 0x12, 0x0F, 0x06,  // 'k' RLE
+0x0F, 0x0F, 0x27, 0x0F, 0x21, 0x0F, 0x21, 0x0F, 0xE1, 0xE4, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,  // 'l' RLE
+0xA5, 0xA8, 0x19, 0x0F, 0x21, 0x0F, 0xA1, 0xA8, 0x29, 0x2F, 0x0F, 0xA1, 0x99, 0x0F, 0x06,  // 'm' RLE
+0x0F, 0xA8, 0xA8, 0x29, 0x2F, 0x0F, 0x21, 0x0F, 0x21, 0x0F, 0xA1, 0x99, 0x0F, 0x0F, 0x09,  // 'n' RLE
+0x0F, 0x6A, 0x8B, 0x39, 0x34, 0x28, 0x26, 0x28, 0x26, 0x38, 0x34, 0x89, 0x6B, 0x0F, 0x0F, 0x0B,  // 'o' RLE
+0x0F, 0xE7, 0xE4, 0x25, 0x24, 0x29, 0x26, 0x28, 0x26, 0x38, 0x34, 0x89, 0x6B, 0x0F, 0x0F, 0x0C,  // 'p' RLE
+0x0F, 0x69, 0x8B, 0x39, 0x34, 0x28, 0x26, 0x28, 0x26, 0x29, 0x24, 0xE9, 0xE4, 0x0F, 0x0F, 0x06,  // 'q' RLE
+0x0F, 0x18, 0x0F, 0xA2, 0x99, 0x29, 0x2F, 0x0F, 0x21, 0x0F, 0x31, 0x0F, 0x11, 0x0F, 0x0F, 0x0F, 0x02,  // 'r' RLE
+0x0F, 0x3A, 0x22, 0x5A, 0x21, 0x29, 0x22, 0x22, 0x28, 0x22, 0x22, 0x28, 0x22, 0x22, 0x28, 0x22, 0x22, 0x29, 0x51, 0x2A, 0x32, 0x0F, 0x0F, 0x0B,  // 's' RLE
+0x0F, 0x28, 0x0F, 0x21, 0xBE, 0xD6, 0x28, 0x26, 0x28, 0x26, 0x28, 0x26, 0x0F, 0x21, 0x0F, 0x0F, 0x09,  // 't' RLE
+0x0F, 0x98, 0xA9, 0x0F, 0x21, 0x0F, 0x21, 0x0F, 0x21, 0x2F, 0xA9, 0xA8, 0x0F, 0x0F, 0x09,  // 'u' RLE
+0x0F, 0x18, 0x0F, 0x42, 0x6F, 0x5F, 0x0F, 0x31, 0x6C, 0x69, 0x4B, 0x1E, 0x0F, 0x0F,  // 'v' RLE
+0x35, 0x8F, 0x0F, 0x41, 0x88, 0x3A, 0x8F, 0x0F, 0x41, 0x88, 0x3A, 0x0F, 0x0F, 0x0F, 0x01,  // 'w' RLE
+0x0F, 0x18, 0x18, 0x38, 0x34, 0x39, 0x32, 0x4C, 0x4E, 0x3C, 0x32, 0x39, 0x34, 0x18, 0x18, 0x0F, 0x0F, 0x09,  // 'x' RLE
+0x0F, 0x27, 0x2A, 0x54, 0x27, 0x66, 0x33, 0x89, 0x5D, 0x88, 0x87, 0x3A, 0x0F, 0x0F, 0x0F, 0x02,  // 'y' RLE
+0x0F, 0x28, 0x26, 0x28, 0x35, 0x28, 0x44, 0x28, 0x23, 0x21, 0x28, 0x22, 0x22, 0x28, 0x21, 0x23, 0x48, 0x24, 0x38, 0x25, 0x28, 0x26, 0x0F, 0x06,  // 'z' RLE
+0x0F, 0x0F, 0x0F, 0x0F, 0x22, 0x4F, 0xF8, 0x10, 0x81, 0xA2, 0x4E, 0x2E, 0x0F, 0x0F, 0x06,  // '{' RLE
+0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0xFF, 0xF0, 0x60, 0x0F, 0x0F, 0x0F, 0x0F, 0x0C,  // '|' RLE
+0x0F, 0x0F, 0x26, 0x4E, 0xAE, 0x82, 0xF1, 0x10, 0x48, 0x2F, 0x0F, 0x0F, 0x0F, 0x0F, 0x02,  // '}' RLE
+0x0F, 0x2B, 0x2F, 0x0F, 0x21, 0x0F, 0x21, 0x0F, 0x22, 0x0F, 0x21, 0x0F, 0x21, 0x2F, 0x0F, 0x0F, 0x0F,  // '~' RLE
+};
+
+const uint16_t OLED_FontPacked11x18_Offsets [] = {
+0x8000, 0x800E, 0x801D, 0x802B, 0x803E, 0x8055, 0x806C, 0x8083, 0x8090, 0x80A1, 0x80B2, 0x80C2,
+0x80D4, 0x80E3, 0x80F4, 0x8103, 0x8111, 0x8123, 0x812F, 0x8147, 0x815C, 0x816B, 0x8182, 0x8198,
+0x81AB, 0x81C3, 0x81D9, 0x81E9, 0x81FA, 0x820D, 0x8221, 0x8234, 0x8246, 0x825A, 0x8269, 0x827D,
+0x828F, 0x829F, 0x82B6, 0x82C8, 0x82DB, 0x82EA, 0x82FA, 0x8309, 0x831A, 0x832C, 0x833A, 0x8346,
+0x8356, 0x8367, 0x837A, 0x838D, 0x83A3, 0x83B7, 0x83C6, 0x83D3, 0x83E1, 0x83F5, 0x8406, 0x841D,
+0x842A, 0x8436, 0x8443, 0x8452, 0x8469, 0x8479, 0x8490, 0x84A0, 0x84B2, 0x84C2, 0x84D8, 0x84EA,
+0x8500, 0x850F, 0x851F, 0x8530, 0x8540, 0x854F, 0x855E, 0x856D, 0x857D, 0x858D, 0x859D, 0x85AE,
+0x85C6, 0x85D7, 0x85E6, 0x85F4, 0x8603, 0x8615, 0x8625, 0x863D, 0x864C, 0x8659, 0x8668, 0x0679,
+};
+
+const OLED_FontPacked_t OLED_FontPacked11x18 = { OLED_FontPacked11x18_Offsets, OLED_FontPacked11x18_Bits };
+
+const uint8_t OLED_FontPacked16x26_Bits [] = {
+0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0B,  // sp RLE
+0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0xA6, 0x38, 0xF5, 0x33, 0xF5, 0x33, 0xF5, 0x33, 0x85, 0x3A, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,  // '!' RLE
+0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x73, 0x0F, 0x74, 0x0F, 0x74, 0x0F, 0x74, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x77, 0x0F, 0x74, 0x0F, 0x74, 0x0F, 0x74, 0x0F, 0x0F, 0x0F, 0x0F, 0x0B,  // '"' RLE
+0x2D, 0x0F, 0x13, 0x25, 0x0F, 0x22, 0x25, 0x33, 0x2B, 0x85, 0x2B, 0xC1, 0xFA, 0xF7, 0xCA, 0x21, 0x24, 0x85, 0x85, 0x35, 0x23, 0xB2, 0xFB, 0xF7, 0xF9, 0x8B, 0x25, 0x4B, 0x22, 0x25, 0x0F, 0x22, 0x25, 0x0B,  // '#' RLE
+0x0F, 0x0F, 0x0F, 0x0F, 0x2A, 0x68, 0x2A, 0x87, 0x39, 0x96, 0x38, 0xB5, 0x28, 0x35, 0xF4, 0x10, 0xF3, 0x80, 0xF3, 0x80, 0xF3, 0x80, 0x23, 0xB8, 0x35, 0x98, 0x36, 0x98, 0x27, 0x79, 0x0F, 0x0F, 0x03,  // '$' RLE
+0x81, 0x2A, 0x86, 0x39, 0xA5, 0x56, 0x25, 0x26, 0x55, 0x16, 0x18, 0x54, 0x47, 0x42, 0x52, 0xA9, 0x51, 0xEB, 0xFD, 0x20, 0xDE, 0x5B, 0xA1, 0x59, 0xA2, 0x67, 0x23, 0x26, 0x56, 0x25, 0x26, 0x55, 0xA6, 0x35, 0xA8, 0x05,  // '%' RLE
+0x7B, 0x0F, 0x93, 0x0F, 0xA2, 0x39, 0xC3, 0xB6, 0x45, 0xB5, 0x37, 0xD5, 0x26, 0xE5, 0x25, 0x25, 0x95, 0x23, 0x95, 0x71, 0x31, 0x95, 0x93, 0x76, 0x75, 0x67, 0x68, 0x0F, 0x92, 0xBF, 0x7F, 0x31, 0x05,  // '&' RLE
+0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x66, 0x0F, 0x75, 0x0F, 0x74, 0x0F, 0x74, 0x0F, 0x54, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x01,  // ''' RLE
+0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x87, 0xEF, 0xFB, 0x10, 0xF8, 0x50, 0x76, 0x76, 0x55, 0x5C, 0x43, 0x0F, 0x41, 0x32, 0x0F, 0x33, 0x22, 0x0F, 0x35, 0x21, 0x0F, 0x35, 0x11, 0x0F, 0x27, 0x11, 0x0F, 0x27, 0x01,  // '(' RLE
+0x0F, 0x1B, 0x0F, 0x27, 0x11, 0x0F, 0x27, 0x21, 0x0F, 0x35, 0x21, 0x0F, 0x35, 0x31, 0x0F, 0x33, 0x42, 0x0F, 0x41, 0x53, 0x5C, 0x75, 0x76, 0xF6, 0x50, 0xF8, 0x10, 0xEB, 0x8F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0D,  // ')' RLE
+0x0F, 0x0F, 0x0F, 0x3A, 0x0F, 0x38, 0x14, 0x0F, 0x33, 0x23, 0x0F, 0x24, 0x42, 0x2E, 0x82, 0xBE, 0x5F, 0x13, 0x0F, 0x62, 0x31, 0x0F, 0x11, 0x83, 0x0F, 0x23, 0x51, 0x0F, 0x32, 0x42, 0x0F, 0x32, 0x14, 0x0F, 0x33, 0x0F, 0x29, 0x0F, 0x05,  // '*' RLE
+0x2D, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0xF2, 0xFB, 0xFB, 0x0F, 0x23, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0x29, 0x0B,  // '+' RLE
+0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x48, 0x14, 0x0F, 0x92, 0x0F, 0x92, 0x0F, 0x82, 0x0F, 0x73, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0C,  // ',' RLE
+0x0F, 0x0F, 0x0F, 0x0F, 0x23, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0x0F, 0x09,  // '-' RLE
+0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x48, 0x0F, 0x47, 0x0F, 0x47, 0x0F, 0x47, 0x0F, 0x47, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,  // '.' RLE
+0x0F, 0x19, 0x0F, 0x38, 0x0F, 0x56, 0x0F, 0x74, 0x0F, 0x82, 0x0F, 0x81, 0x0F, 0x81, 0x0F, 0x81, 0x0F, 0x81, 0x0F, 0x81, 0x0F, 0x81, 0x0F, 0x81, 0x0F, 0x81, 0x0F, 0x63, 0x0F, 0x45, 0x0F, 0x27, 0x0F, 0x09,  // '/' RLE
+0x0F, 0x0F, 0xB1, 0xFD, 0xFA, 0x20, 0xF8, 0x40, 0x76, 0x77, 0x45, 0x4D, 0x35, 0x3F, 0x25, 0x0F, 0x22, 0x35, 0x3F, 0x45, 0x4D, 0x75, 0x77, 0xF6, 0x40, 0xF8, 0x20, 0xFA, 0xBD, 0x0A,  // '0' RLE
+0x0F, 0x0F, 0x0F, 0x29, 0x2F, 0x27, 0x2F, 0x27, 0x2F, 0x36, 0x2F, 0x36, 0x2F, 0xF6, 0x50, 0xF5, 0x60, 0xF5, 0x60, 0xF5, 0x60, 0xF5, 0x60, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0x29, 0x05,  // '1' RLE
+0x0F, 0x0F, 0x0F, 0x28, 0x4E, 0x26, 0x5D, 0x35, 0x6C, 0x35, 0x8A, 0x25, 0x6A, 0x21, 0x25, 0x59, 0x23, 0x25, 0x58, 0x24, 0x35, 0x56, 0x25, 0xD5, 0x26, 0xB6, 0x27, 0xA6, 0x28, 0x87, 0x29, 0x39, 0x2C, 0x0F, 0x0F, 0x01,  // '2' RLE
+0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x24, 0x3F, 0x35, 0x26, 0x37, 0x35, 0x26, 0x37, 0x25, 0x27, 0x28, 0x25, 0x27, 0x28, 0x25, 0x36, 0x28, 0x35, 0x45, 0x36, 0xD5, 0x44, 0xF5, 0x50, 0x87, 0xA1, 0x68, 0x83, 0x3A, 0x66, 0x0F, 0x0F, 0x04,  // '3' RLE
+0x2D, 0x0F, 0x47, 0x0F, 0x56, 0x0F, 0x74, 0x0F, 0x83, 0x0F, 0x61, 0x22, 0x6F, 0x23, 0x5E, 0x25, 0x6C, 0x26, 0xFB, 0x60, 0xF5, 0x60, 0xF5, 0x60, 0xF5, 0x60, 0x0F, 0x23, 0x0F, 0x29, 0x0F, 0x29, 0x0B,  // '4' RLE
+0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0xA3, 0x38, 0xA5, 0x38, 0xA5, 0x38, 0xA5, 0x29, 0x35, 0x25, 0x29, 0x35, 0x35, 0x28, 0x35, 0x45, 0x36, 0x35, 0x65, 0x61, 0x35, 0xB6, 0x36, 0xB6, 0x36, 0x97, 0x0F, 0x54, 0x0F, 0x0F, 0x05,  // '5' RLE
+0x0F, 0x0F, 0x26, 0x0F, 0xC4, 0xFC, 0x10, 0xF9, 0x30, 0xF7, 0x40, 0x57, 0x33, 0x54, 0x45, 0x34, 0x37, 0x35, 0x25, 0x29, 0x25, 0x26, 0x29, 0x25, 0x36, 0x37, 0x25, 0x46, 0x45, 0x35, 0xC5, 0x36, 0xB6, 0x27, 0x97, 0x0F, 0x73, 0x08,  // '6' RLE
+0x0F, 0x0F, 0x0F, 0x37, 0x0F, 0x38, 0x0F, 0x21, 0x35, 0x5D, 0x35, 0x6C, 0x35, 0x8A, 0x35, 0xA8, 0x35, 0x96, 0x38, 0x75, 0x3B, 0x73, 0x3D, 0x71, 0x9F, 0x0F, 0x72, 0x0F, 0x64, 0x0F, 0x45, 0x0F, 0x07,  // '7' RLE
+0x0F, 0x0F, 0x3A, 0x2D, 0x76, 0x69, 0x93, 0x87, 0xA1, 0xF6, 0x60, 0xD5, 0x35, 0x35, 0x44, 0x37, 0x25, 0x46, 0x27, 0x25, 0x46, 0x27, 0x35, 0x64, 0x35, 0xF5, 0x42, 0x95, 0xA1, 0x77, 0x93, 0x58, 0x75, 0x0F, 0x55, 0x08,  // '8' RLE
+0x0F, 0x0F, 0x41, 0x0F, 0x85, 0x27, 0xA8, 0x36, 0xB6, 0x36, 0xD5, 0x26, 0x35, 0x37, 0x26, 0x25, 0x29, 0x26, 0x25, 0x29, 0x35, 0x35, 0x28, 0x35, 0x45, 0x36, 0x53, 0xC5, 0x71, 0xF7, 0x30, 0xF9, 0x10, 0xEB, 0x9E, 0x0C,  // '9' RLE
+0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x4C, 0x47, 0x4B, 0x47, 0x4B, 0x47, 0x4B, 0x47, 0x4B, 0x47, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,  // ':' RLE
+0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x4C, 0x47, 0x23, 0x46, 0x97, 0x46, 0x97, 0x46, 0x87, 0x47, 0x77, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0C,  // ';' RLE
+0x1D, 0x0F, 0x1A, 0x0F, 0x39, 0x0F, 0x38, 0x0F, 0x57, 0x0F, 0x56, 0x0F, 0x75, 0x0F, 0x34, 0x31, 0x0F, 0x33, 0x33, 0x0F, 0x32, 0x33, 0x0F, 0x31, 0x35, 0x3F, 0x35, 0x3E, 0x37, 0x3D, 0x37, 0x3C, 0x39, 0x3B, 0x39, 0x05,  // '<' RLE
+0x2A, 0x23, 0x0F, 0x24, 0x23, 0x0F, 0x24, 0x23, 0x0F, 0x24, 0x23, 0x0F, 0x24, 0x23, 0x0F, 0x24, 0x23, 0x0F, 0x24, 0x23, 0x0F, 0x24, 0x23, 0x0F, 0x24, 0x23, 0x0F, 0x24, 0x23, 0x0F, 0x24, 0x23, 0x0F, 0x24, 0x23, 0x0F, 0x24, 0x23, 0x0F, 0x24, 0x23, 0x0F, 0x24, 0x23, 0x0F, 0x24, 0x23, 0x09,  // '=' RLE
+0x26, 0x2B, 0x3B, 0x39, 0x3B, 0x39, 0x3C, 0x37, 0x3D, 0x37, 0x3E, 0x35, 0x3F, 0x35, 0x0F, 0x31, 0x33, 0x0F, 0x32, 0x33, 0x0F, 0x33, 0x31, 0x0F, 0x34, 0x31, 0x0F, 0x55, 0x0F, 0x56, 0x0F, 0x37, 0x0F, 0x38, 0x0F, 0x19, 0x0C,  // '>' RLE
+0x0F, 0x0F, 0x0F, 0x48, 0x0F, 0x56, 0x0F, 0x56, 0x0F, 0x26, 0x2B, 0x33, 0x25, 0x49, 0x33, 0x25, 0x58, 0x33, 0x25, 0x67, 0x33, 0x25, 0x76, 0x33, 0x35, 0x44, 0xAF, 0x0F, 0x82, 0x0F, 0x73, 0x0F, 0x55, 0x0F, 0x27, 0x0F, 0x06,  // '?' RLE
+0x68, 0x0F, 0xC2, 0xFC, 0xFA, 0x20, 0x68, 0x58, 0x47, 0x3C, 0x46, 0x93, 0x32, 0x35, 0xB3, 0x31, 0x25, 0xC3, 0x22, 0x25, 0x52, 0x35, 0x22, 0x25, 0x32, 0x37, 0x22, 0x35, 0x21, 0x56, 0x31, 0x75, 0x72, 0x32, 0xF6, 0x10, 0x21, 0xF7, 0x10, 0xEC, 0x09,  // '@' RLE
+0x0F, 0x33, 0x0F, 0x56, 0x0F, 0x83, 0x0F, 0xA1, 0xAD, 0xBD, 0xAD, 0x21, 0x7D, 0x24, 0x5D, 0x26, 0x8D, 0x23, 0xDD, 0xCF, 0x0F, 0xB2, 0x0F, 0xB2, 0x0F, 0x83, 0x0F, 0x65, 0x05,  // 'A' RLE
+0x0F, 0x0F, 0x0F, 0xFA, 0x30, 0xF8, 0x30, 0xF8, 0x30, 0xF8, 0x30, 0x28, 0x26, 0x26, 0x28, 0x26, 0x26, 0x28, 0x26, 0x26, 0x28, 0x45, 0x25, 0x38, 0x53, 0x25, 0xD8, 0x32, 0x88, 0x91, 0x79, 0x72, 0x5B, 0x73, 0x0F, 0x55, 0x07,  // 'B' RLE
+0x0F, 0x0F, 0x84, 0x0F, 0xC1, 0xED, 0xEC, 0x5B, 0x65, 0x3A, 0x49, 0x39, 0x4B, 0x38, 0x3C, 0x28, 0x2E, 0x28, 0x2E, 0x28, 0x2E, 0x28, 0x2E, 0x38, 0x2D, 0x38, 0x3C, 0x38, 0x3C, 0x05,  // 'C' RLE
+0x0F, 0xFE, 0x30, 0xF8, 0x30, 0xF8, 0x30, 0xF8, 0x30, 0x28, 0x2E, 0x28, 0x2E, 0x28, 0x2E, 0x28, 0x2E, 0x38, 0x3C, 0x38, 0x3C, 0x58, 0x48, 0xFA, 0x10, 0xFA, 0xEC, 0xBD, 0x09,  // 'D' RLE
+0x0F, 0x0F, 0x0F, 0xFA, 0x30, 0xF8, 0x30, 0xF8, 0x30, 0xF8, 0x30, 0xF8, 0x30, 0x28, 0x26, 0x26, 0x28, 0x26, 0x26, 0x28, 0x26, 0x26, 0x28, 0x26, 0x26, 0x28, 0x26, 0x26, 0x28, 0x26, 0x26, 0x28, 0x26, 0x26, 0x28, 0x26, 0x26, 0x28, 0x2E, 0x05,  // 'E' RLE
+0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0xF6, 0x30, 0xF8, 0x30, 0xF8, 0x30, 0xF8, 0x30, 0x28, 0x26, 0x0F, 0x21, 0x26, 0x0F, 0x21, 0x26, 0x0F, 0x21, 0x26, 0x0F, 0x21, 0x26, 0x0F, 0x21, 0x26, 0x0F, 0x21, 0x26, 0x0F, 0x21, 0x26, 0x0F, 0x21, 0x26, 0x0D,  // 'F' RLE
+0x4A, 0x0F, 0xA4, 0xCF, 0xED, 0xFB, 0x10, 0x5A, 0x56, 0x49, 0x4A, 0x38, 0x3C, 0x38, 0x3C, 0x28, 0x27, 0x25, 0x28, 0x27, 0x25, 0x28, 0x27, 0x25, 0x28, 0x97, 0x38, 0x96, 0x38, 0x96, 0x29, 0x86, 0x06,  // 'G' RLE
+0x0F, 0xFE, 0x30, 0xF8, 0x30, 0xF8, 0x30, 0xF8, 0x30, 0xF8, 0x30, 0x0F, 0x21, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0xF1, 0x30, 0xF8, 0x30, 0xF8, 0x30, 0xF8, 0x30, 0xF8, 0x30, 0x05,  // 'H' RLE
+0x0F, 0x0F, 0x0F, 0x2A, 0x2E, 0x28, 0x2E, 0x28, 0x2E, 0x28, 0x2E, 0xF8, 0x30, 0xF8, 0x30, 0xF8, 0x30, 0xF8, 0x30, 0xF8, 0x30, 0x28, 0x2E, 0x28, 0x2E, 0x28, 0x2E, 0x28, 0x2E, 0x28, 0x2E, 0x05,  // 'I' RLE
+0x0F, 0x0F, 0x0F, 0x0F, 0x3A, 0x28, 0x3D, 0x28, 0x3D, 0x28, 0x2E, 0x28, 0x2E, 0x28, 0x2E, 0x28, 0x3D, 0xF8, 0x30, 0xF8, 0x20, 0xF9, 0x20, 0xF9, 0x10, 0xDA, 0x0F, 0x0F, 0x0F, 0x0F, 0x02,  // 'J' RLE
+0x0F, 0x0F, 0x0F, 0xFA, 0x30, 0xF8, 0x30, 0xF8, 0x30, 0xF8, 0x30, 0x5E, 0x0F, 0x75, 0x0F, 0x93, 0x0F, 0x51, 0x61, 0x5D, 0x63, 0x5A, 0x66, 0x49, 0x59, 0x38, 0x4B, 0x28, 0x3D, 0x18, 0x2F, 0x05,  // 'K' RLE
+0x0F, 0x0F, 0x0F, 0xFA, 0x30, 0xF8, 0x30, 0xF8, 0x30, 0xF8, 0x30, 0xF8, 0x30, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0x29, 0x05,  // 'L' RLE
+0xF3, 0x30, 0xF8, 0x30, 0xF8, 0x30, 0xF8, 0x30, 0x98, 0x0F, 0xA3, 0x0F, 0xB3, 0x0F, 0x83, 0x0F, 0x56, 0x0F, 0x83, 0xAF, 0xAD, 0x0F, 0x71, 0x0F, 0xF4, 0x30, 0xF8, 0x30, 0xF8, 0x30, 0x05,  // 'M' RLE
+0x0F, 0xFE, 0x30, 0xF8, 0x30, 0xF8, 0x30, 0xF8, 0x30, 0x88, 0x0F, 0x75, 0x0F, 0x85, 0x0F, 0x85, 0x0F, 0x75, 0x0F, 0x85, 0x0F, 0x85, 0xF8, 0x30, 0xF8, 0x30, 0xF8, 0x30, 0xF8, 0x30, 0x05,  // 'N' RLE
+0x69, 0x0F, 0xC2, 0xED, 0xFB, 0x10, 0xFA, 0x10, 0x49, 0x4A, 0x38, 0x3C, 0x28, 0x2E, 0x28, 0x2E, 0x28, 0x2E, 0x38, 0x3C, 0x48, 0x4A, 0xF9, 0x10, 0xFA, 0x10, 0xEB, 0xCD, 0x08,  // 'O' RLE
+0x0F, 0x0F, 0x0F, 0xFA, 0x30, 0xF8, 0x30, 0xF8, 0x30, 0xF8, 0x30, 0xF8, 0x30, 0x28, 0x27, 0x2F, 0x27, 0x2F, 0x27, 0x2F, 0x36, 0x3F, 0x44, 0xAF, 0x0F, 0xA1, 0x0F, 0x82, 0x0F, 0x83, 0x0E,  // 'P' RLE
+0x69, 0x0F, 0xC2, 0xED, 0xFB, 0x10, 0xFA, 0x10, 0x49, 0x4A, 0x38, 0x3C, 0x28, 0x2E, 0x28, 0x2E, 0x28, 0x3E, 0x37, 0x5C, 0x46, 0x6A, 0xF7, 0x50, 0xF6, 0x10, 0x31, 0xE7, 0x33, 0xC7, 0x34, 0x01,  // 'Q' RLE
+0x0F, 0x0F, 0x0F, 0xFA, 0x30, 0xF8, 0x30, 0xF8, 0x30, 0xF8, 0x30, 0x28, 0x27, 0x2F, 0x37, 0x2E, 0x56, 0x3D, 0x65, 0x4C, 0x92, 0xAB, 0x61, 0x8A, 0x63, 0x89, 0x54, 0x5A, 0x47, 0x0F, 0x29, 0x05,  // 'R' RLE
+0x0F, 0x0F, 0x0F, 0x5C, 0x37, 0x7A, 0x37, 0x89, 0x36, 0x98, 0x36, 0x38, 0x43, 0x26, 0x28, 0x35, 0x26, 0x28, 0x35, 0x26, 0x28, 0x45, 0x25, 0x28, 0x36, 0x34, 0x28, 0x46, 0x42, 0x38, 0x95, 0x39, 0x86, 0x2A, 0x76, 0x0F, 0x55, 0x08,  // 'S' RLE
+0x23, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0xF9, 0x30, 0xF8, 0x30, 0xF8, 0x30, 0xF8, 0x30, 0xF8, 0x30, 0x28, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0x06,  // 'T' RLE
+0x0F, 0xDE, 0xFD, 0x10, 0xFA, 0x20, 0xF9, 0x20, 0xF9, 0x30, 0x0F, 0x38, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0x38, 0x0F, 0x56, 0xF8, 0x20, 0xF9, 0x20, 0xF9, 0x10, 0xDA, 0x0A,  // 'U' RLE
+0x33, 0x0F, 0x58, 0x0F, 0x86, 0x0F, 0xB3, 0x0F, 0xB2, 0x0F, 0xC2, 0x0F, 0xB2, 0x0F, 0x92, 0x0F, 0x65, 0x0F, 0x83, 0x0F, 0xA1, 0xBD, 0xAD, 0xAD, 0x0F, 0x81, 0x0F, 0x53, 0x0F, 0x03,  // 'V' RLE
+0x73, 0x0F, 0xE4, 0xFC, 0x30, 0xF9, 0x20, 0x0F, 0xA1, 0x0F, 0x92, 0xEC, 0xBC, 0x7F, 0x0F, 0xB4, 0xEF, 0x0F, 0xA1, 0x0F, 0x83, 0xFB, 0xF8, 0x30, 0xD8, 0x0A,  // 'W' RLE
+0x13, 0x0F, 0x11, 0x28, 0x3D, 0x48, 0x4A, 0x58, 0x58, 0x68, 0x65, 0x7A, 0x52, 0xCD, 0x0F, 0x91, 0x0F, 0x73, 0x0F, 0x94, 0xCF, 0x5D, 0x63, 0x5B, 0x75, 0x58, 0x67, 0x48, 0x4A, 0x28, 0x3D, 0x05,  // 'X' RLE
+0x13, 0x0F, 0x3A, 0x0F, 0x58, 0x0F, 0x66, 0x0F, 0x85, 0x0F, 0x75, 0x0F, 0xE6, 0xDD, 0xBF, 0xCE, 0xDD, 0x6B, 0x0F, 0x64, 0x0F, 0x63, 0x0F, 0x55, 0x0F, 0x36, 0x0F, 0x05,  // 'Y' RLE
+0x0F, 0x2E, 0x3D, 0x28, 0x4C, 0x28, 0x5B, 0x28, 0x79, 0x28, 0x88, 0x28, 0x67, 0x21, 0x28, 0x56, 0x23, 0x28, 0x64, 0x24, 0x28, 0x63, 0x25, 0x28, 0x62, 0x26, 0x28, 0x51, 0x28, 0x78, 0x29, 0x68, 0x2A, 0x58, 0x2B, 0x48, 0x2C, 0x05,  // 'Z' RLE
+0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0xFA, 0xA0, 0xF1, 0xA0, 0xF1, 0xA0, 0xF1, 0xA0, 0x11, 0x0F, 0x27, 0x11, 0x0F, 0x27, 0x11, 0x0F, 0x27, 0x11, 0x0F, 0x27, 0x11, 0x0F, 0x27, 0x11, 0x0F, 0x27, 0x11, 0x0F, 0x27, 0x01,  // '[' RLE
+0x0F, 0x2B, 0x0F, 0x49, 0x0F, 0x67, 0x0F, 0x85, 0x0F, 0x85, 0x0F, 0x85, 0x0F, 0x85, 0x0F, 0x85, 0x0F, 0x85, 0x0F, 0x85, 0x0F, 0x85, 0x0F, 0x85, 0x0F, 0x75, 0x0F, 0x56, 0x0F, 0x38, 0x01,  // '\' RLE
+0x0F, 0x1B, 0x0F, 0x27, 0x11, 0x0F, 0x27, 0x11, 0x0F, 0x27, 0x11, 0x0F, 0x27, 0x11, 0x0F, 0x27, 0x11, 0x0F, 0x27, 0x11, 0x0F, 0x27, 0xF1, 0xA0, 0xF1, 0xA0, 0xF1, 0xA0, 0xF1, 0xA0, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,  // ']' RLE
+0x0F, 0x0F, 0x2B, 0x0F, 0x56, 0x0F, 0x74, 0x0F, 0x92, 0x9E, 0x9F, 0x9F, 0x0F, 0x71, 0x0F, 0x94, 0x0F, 0x95, 0x0F, 0x94, 0x0F, 0x94, 0x0F, 0x75, 0x0F, 0x56, 0x0F, 0x38, 0x09,  // '^' RLE
+0x0F, 0x26, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0x29, 0x03,  // '_' RLE
+0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x1D, 0x0F, 0x1A, 0x0F, 0x1A, 0x0F, 0x1A, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x09,  // '`' RLE
+0x0F, 0x0F, 0x4B, 0x2E, 0x65, 0x2D, 0x84, 0x3B, 0x84, 0x3B, 0x43, 0x41, 0x2B, 0x34, 0x24, 0x2B, 0x24, 0x25, 0x2B, 0x24, 0x25, 0x3B, 0x23, 0x34, 0xEB, 0xEC, 0xFC, 0xEC, 0xCE, 0x0F, 0x29, 0x05,  // 'a' RLE
+0x0F, 0x0F, 0x0F, 0xF7, 0x60, 0xF5, 0x60, 0xF5, 0x60, 0xF5, 0x50, 0x3D, 0x38, 0x3B, 0x39, 0x2B, 0x2B, 0x2B, 0x2B, 0x3B, 0x39, 0x4B, 0x56, 0xEB, 0xDD, 0xCD, 0x0F, 0x81, 0x09,  // 'b' RLE
+0x0F, 0x0F, 0x38, 0x0F, 0x95, 0x0F, 0xB1, 0xDE, 0xDD, 0x5C, 0x55, 0x3B, 0x39, 0x3B, 0x39, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x3B, 0x39, 0x3B, 0x39, 0x2C, 0x29, 0x06,  // 'c' RLE
+0x0F, 0x0F, 0x76, 0x0F, 0xB2, 0xDE, 0xED, 0x7B, 0x62, 0x3B, 0x39, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x3A, 0x3B, 0x38, 0xF6, 0x60, 0xF5, 0x60, 0xF5, 0x60, 0xF5, 0x60, 0xF5, 0x60, 0x05,  // 'd' RLE
+0x0F, 0x0F, 0x57, 0x0F, 0x94, 0x0F, 0xB1, 0xDE, 0xDD, 0x4C, 0x22, 0x43, 0x3B, 0x23, 0x34, 0x2B, 0x24, 0x25, 0x2B, 0x24, 0x25, 0x3B, 0x23, 0x25, 0x8B, 0x25, 0x8B, 0x25, 0x7C, 0x34, 0x6D, 0x34, 0x4F, 0x24, 0x06,  // 'e' RLE
+0x0F, 0x0F, 0x22, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0xF6, 0x30, 0xF6, 0x50, 0xF5, 0x60, 0xF5, 0x60, 0xF5, 0x60, 0x25, 0x24, 0x0F, 0x13, 0x25, 0x0F, 0x13, 0x25, 0x0F, 0x13, 0x25, 0x0F, 0x13, 0x25, 0x0F, 0x23, 0x24, 0x0F, 0x03,  // 'f' RLE
+0x0F, 0x0F, 0x76, 0x0F, 0xB2, 0x25, 0xD7, 0x24, 0xE7, 0x23, 0x66, 0x63, 0x14, 0x36, 0x39, 0x14, 0x26, 0x2B, 0x14, 0x26, 0x2B, 0x14, 0x36, 0x39, 0x23, 0x36, 0x38, 0x24, 0xF7, 0x40, 0xF6, 0x50, 0xF6, 0x40, 0xF7, 0x30, 0xF8, 0x05,  // 'g' RLE
+0x0F, 0x0F, 0x0F, 0xF7, 0x60, 0xF5, 0x60, 0xF5, 0x60, 0xF5, 0x60, 0x4C, 0x0F, 0x46, 0x0F, 0x37, 0x0F, 0x28, 0x0F, 0x29, 0x0F, 0xF9, 0xFB, 0xFB, 0xEC, 0xCE, 0x05,  // 'h' RLE
+0x0F, 0x0F, 0x22, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0x23, 0xF4, 0x25, 0xF4, 0x25, 0xF4, 0x25, 0xF4, 0x25, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x08,  // 'i' RLE
+0x0F, 0x0F, 0x0F, 0x25, 0x26, 0x0F, 0x21, 0x26, 0x0F, 0x21, 0x26, 0x0F, 0x12, 0x26, 0x0F, 0x12, 0x26, 0x0F, 0x12, 0x26, 0x0F, 0x41, 0xF4, 0x70, 0xF4, 0x70, 0xF4, 0x70, 0xF4, 0x40, 0x21, 0xF4, 0x20, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x06,  // 'j' RLE
+0x0F, 0x0F, 0x0F, 0xF7, 0x60, 0xF5, 0x60, 0xF5, 0x60, 0xF5, 0x60, 0x0F, 0x32, 0x0F, 0x66, 0x0F, 0x84, 0x0F, 0xA2, 0x5F, 0x52, 0x5D, 0x64, 0x4B, 0x56, 0x3B, 0x48, 0x2B, 0x3A, 0x1B, 0x2C, 0x05,  // 'k' RLE
+0x0F, 0x1B, 0x0F, 0x1A, 0x0F, 0x1A, 0x0F, 0x1A, 0x0F, 0x1A, 0x0F, 0x1A, 0x0F, 0xFA, 0x60, 0xF5, 0x60, 0xF5, 0x60, 0xF5, 0x60, 0xF5, 0x60, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x04,  // 'l' RLE
+0xF6, 0xFB, 0xFB, 0xFB, 0x5C, 0x0F, 0x45, 0x0F, 0x57, 0x0F, 0xF6, 0xFB, 0xEC, 0x5C, 0x0F, 0x45, 0x0F, 0x47, 0x0F, 0xF7, 0xFB, 0xEC, 0x05,  // 'm' RLE
+0x0F, 0x0F, 0x0F, 0xFD, 0xFB, 0xFB, 0xFB, 0x4C, 0x0F, 0x46, 0x0F, 0x37, 0x0F, 0x28, 0x0F, 0x29, 0x0F, 0xF9, 0xFB, 0xFB, 0xEC, 0xCE, 0x05,  // 'n' RLE
+0x0F, 0x0F, 0x76, 0x0F, 0xB2, 0xDE, 0xDD, 0x5C, 0x55, 0x3B, 0x39, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x3B, 0x39, 0x5B, 0x55, 0xDC, 0xDD, 0xBE, 0x0F, 0x91, 0x08,  // 'o' RLE
+0x0F, 0x0F, 0x0F, 0xFD, 0x50, 0xF6, 0x50, 0xF6, 0x50, 0xF6, 0x50, 0x37, 0x47, 0x3B, 0x39, 0x2B, 0x2B, 0x2B, 0x2B, 0x3B, 0x39, 0x4B, 0x56, 0xFB, 0xDC, 0xCD, 0x0F, 0x81, 0x09,  // 'p' RLE
+0x0F, 0x0F, 0x86, 0x0F, 0xB1, 0xDE, 0xED, 0x5B, 0x55, 0x3B, 0x39, 0x2B, 0x2B, 0x2B, 0x2B, 0x3B, 0x39, 0x3B, 0x38, 0xFD, 0x40, 0xF6, 0x50, 0xF6, 0x50, 0xF6, 0x50, 0x0F, 0x0B,  // 'q' RLE
+0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0xF9, 0xFB, 0xFB, 0xFB, 0xFB, 0x4C, 0x0F, 0x46, 0x0F, 0x37, 0x0F, 0x28, 0x0F, 0x29, 0x0F, 0x59, 0x0F, 0x56, 0x0F, 0x56, 0x0F,  // 'r' RLE
+0x0F, 0x0F, 0x0F, 0x0F, 0x31, 0x26, 0x6D, 0x35, 0x6C, 0x35, 0x8B, 0x34, 0x8B, 0x25, 0x2B, 0x33, 0x25, 0x2B, 0x34, 0x24, 0x2B, 0x34, 0x24, 0x2B, 0x44, 0x32, 0x2B, 0x85, 0x3B, 0x74, 0x3C, 0x74, 0x2D, 0x55, 0x0F, 0x0F, 0x03,  // 's' RLE
+0x0F, 0x0F, 0x22, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0xF6, 0x10, 0xFA, 0x20, 0xF9, 0x30, 0xF8, 0x30, 0x2B, 0x3A, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x05,  // 't' RLE
+0x0F, 0x0F, 0x0F, 0xDD, 0xED, 0xFC, 0xFB, 0x0F, 0x38, 0x0F, 0x29, 0x0F, 0x38, 0x0F, 0x47, 0x0F, 0x46, 0xFC, 0xFB, 0xFB, 0xFB, 0x0F, 0x0F, 0x01,  // 'u' RLE
+0x16, 0x0F, 0x3A, 0x0F, 0x68, 0x0F, 0x85, 0x0F, 0xA4, 0x0F, 0xA3, 0x0F, 0xA3, 0x0F, 0x74, 0x0F, 0x56, 0x0F, 0x74, 0x0F, 0x92, 0xAE, 0x9E, 0x0F, 0x81, 0x0F, 0x63, 0x0F, 0x35, 0x0F, 0x02,  // 'v' RLE
+0x66, 0x0F, 0xB5, 0xFF, 0xFB, 0x0F, 0x92, 0x0F, 0x92, 0xDD, 0xAC, 0x0F, 0x61, 0x0F, 0xA5, 0x0F, 0xE1, 0xBF, 0x0F, 0x74, 0xCE, 0xFB, 0xBB, 0x09,  // 'w' RLE
+0x0F, 0x0F, 0x12, 0x1D, 0x3B, 0x39, 0x4B, 0x47, 0x5B, 0x55, 0x7B, 0x61, 0xCD, 0x0F, 0x81, 0x0F, 0x74, 0x0F, 0x84, 0x0F, 0xB1, 0x6E, 0x71, 0x5B, 0x64, 0x4B, 0x47, 0x2B, 0x3A, 0x1B, 0x2C, 0x05,  // 'x' RLE
+0x16, 0x0F, 0x3A, 0x0F, 0x11, 0x56, 0x1E, 0x86, 0x1B, 0xA6, 0x28, 0xA8, 0x35, 0xFB, 0xDD, 0xAF, 0x9F, 0x9E, 0x9F, 0x9F, 0x0F, 0x81, 0x0F, 0x53, 0x0F, 0x36, 0x0F, 0x02,  // 'y' RLE
+0x0F, 0x0F, 0x2F, 0x2B, 0x3A, 0x2B, 0x58, 0x2B, 0x67, 0x2B, 0x76, 0x2B, 0x55, 0x21, 0x2B, 0x54, 0x22, 0x2B, 0x53, 0x23, 0x2B, 0x52, 0x24, 0x2B, 0x51, 0x25, 0x7B, 0x26, 0x6B, 0x27, 0x5B, 0x28, 0x4B, 0x29, 0x3B, 0x2A, 0x05,  // 'z' RLE
+0x0F, 0x0F, 0x0F, 0x0F, 0x23, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0x29, 0x5E, 0x44, 0x54, 0xF3, 0x90, 0xF2, 0x90, 0xB2, 0xC2, 0x21, 0x34, 0x36, 0x34, 0x11, 0x0F, 0x27, 0x11, 0x0F, 0x27, 0x11, 0x0F, 0x27, 0x11, 0x0F, 0x27, 0x0F, 0x0C,  // '{' RLE
+0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0xF2, 0xA0, 0xF1, 0xA0, 0xF1, 0xA0, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x07,  // '|' RLE
+0x0F, 0x0F, 0x0F, 0x17, 0x0F, 0x27, 0x11, 0x0F, 0x27, 0x11, 0x0F, 0x27, 0x11, 0x0F, 0x27, 0x21, 0x25, 0x26, 0x35, 0xB1, 0xC2, 0xF1, 0x90, 0xF2, 0x90, 0x53, 0x44, 0x54, 0x2E, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0x0F, 0x09,  // '}' RLE
+0x2E, 0x0F, 0x47, 0x0F, 0x56, 0x0F, 0x56, 0x0F, 0x26, 0x0F, 0x29, 0x0F, 0x39, 0x0F, 0x48, 0x0F, 0x38, 0x0F, 0x48, 0x0F, 0x38, 0x0F, 0x29, 0x0F, 0x29, 0x0F, 0x56, 0x0F, 0x56, 0x0F, 0x46, 0x0B,  // '~' RLE
+};
+
+const uint16_t OLED_FontPacked16x26_Offsets [] = {
+0x8000, 0x801C, 0x8039, 0x8057, 0x8079, 0x809A, 0x80BE, 0x80DF, 0x80FD, 0x8121, 0x8144, 0x816B,
+0x8189, 0x81A7, 0x81C7, 0x81E4, 0x8206, 0x8224, 0x8244, 0x8268, 0x828E, 0x82AF, 0x82D3, 0x82F9,
+0x831A, 0x833E, 0x8362, 0x837F, 0x839D, 0x83C1, 0x83F1, 0x8416, 0x843B, 0x8464, 0x8481, 0x84A6,
+0x84C4, 0x84E1, 0x8509, 0x8531, 0x8552, 0x8573, 0x8593, 0x85B2, 0x85D2, 0x85F2, 0x8611, 0x8630,
+0x864D, 0x866C, 0x868C, 0x86AC, 0x86D2, 0x86F3, 0x8711, 0x872F, 0x8749, 0x8769, 0x8785, 0x87AB,
+0x87D1, 0x87F0, 0x8815, 0x8832, 0x8853, 0x8870, 0x8890, 0x88AD, 0x88CB, 0x88E9, 0x890C, 0x8933,
+0x8959, 0x8974, 0x8994, 0x89BB, 0x89DB, 0x89FA, 0x8A11, 0x8A28, 0x8A43, 0x8A60, 0x8A7D, 0x8A97,
+0x8ABC, 0x8ADD, 0x8AF5, 0x8B14, 0x8B2C, 0x8B4C, 0x8B68, 0x8B8D, 0x8BB3, 0x8BD0, 0x8BF6, 0x0C16,
+};
+
+const OLED_FontPacked_t OLED_FontPacked16x26 = { OLED_FontPacked16x26_Offsets, OLED_FontPacked16x26_Bits };
+
+
+/* Codepoints of the 7x10 glyphs after '~': degree, micro (also Greek mu), ohm (also Greek omega), Cyrillic Io
+   and A to Ya, arrows. The last glyph is the box drawn for anything else */
+const OLED_FontRange_t OLED_Font7x10_Ranges [] = {
+{ 0x0020, 0x007E,   0 }, { 0x00B0, 0x00B0,  95 }, { 0x00B5, 0x00B5,  96 }, { 0x03A9, 0x03A9,  97 }, { 0x03BC, 0x03BC,  96 },
+{ 0x0401, 0x0401,  98 }, { 0x0410, 0x042F,  99 }, { 0x2126, 0x2126,  97 }, { 0x2190, 0x2193, 131 }, { 0x25A1, 0x25A1, 135 },
+};
+
+const OLED_FontCharset_t OLED_Font7x10_Charset = { OLED_Font7x10_Ranges, 10, 136, 135, NULL };
 
-OLED_FontDef_t OLED_Font_7x10 = { 7, 10, OLED_Font7x10 };
 
-OLED_FontDef_t OLED_Font_11x18 = { 11, 18, OLED_Font11x18 };
+OLED_FontDef_t OLED_Font_7x10 = { 7, 10, OLED_Font7x10, OLED_Font7x10_Pages, NULL, NULL, &OLED_Font7x10_Charset };
 
-OLED_FontDef_t OLED_Font_16x26 = { 16, 26, OLED_Font16x26 };
+OLED_FontDef_t OLED_Font_11x18 = { 11, 18, OLED_Font11x18, OLED_Font11x18_Pages, NULL, NULL, NULL };
+
+OLED_FontDef_t OLED_Font_16x26 = { 16, 26, OLED_Font16x26, OLED_Font16x26_Pages, NULL, NULL, NULL };
+
+OLED_FontDef_t OLED_Font_Packed7x10 = { 7, 10, NULL, NULL, NULL, &OLED_FontPacked7x10, NULL };
+
+OLED_FontDef_t OLED_Font_Packed11x18 = { 11, 18, NULL, NULL, NULL, &OLED_FontPacked11x18, NULL };
+
+OLED_FontDef_t OLED_Font_Packed16x26 = { 16, 26, NULL, NULL, NULL, &OLED_FontPacked16x26, NULL };
+
+OLED_FontDef_t OLED_Font_Prop7x10 = { 8, 10, NULL, NULL, &OLED_FontProp7x10_Metrics, NULL, NULL };
+
+OLED_FontDef_t OLED_Font_Prop11x18 = { 13, 18, NULL, NULL, &OLED_FontProp11x18_Metrics, NULL, NULL };
+
+#endif /* OLED_FONTS_SUBSET */
 
 
 char* OLED_FONTS_GetStringSize(char* str, OLED_Fonts_Size_t* SizeStruct, OLED_FontDef_t* Font) 
 {
+	const char *p = str;
+	uint32_t ch, next;
+	
 	/* Fill settings */
 	SizeStruct->Height = Font->FontHeight;
-	SizeStruct->Length = Font->FontWidth * strlen(str);
+	SizeStruct->Length = 0;
+	
+	/* Pen movement of OLED_SSD1306_Puts(): cells, or advances plus kerning */
+	for (ch = OLED_FONTS_DecodeUtf8(&p); ch != 0; ch = next)
+	{
+		next = OLED_FONTS_DecodeUtf8(&p);
+		
+		if (Font->metrics == NULL)
+		{
+			SizeStruct->Length += Font->FontWidth;
+		}
+		else
+		{
+			SizeStruct->Length += Font->metrics->Glyphs[OLED_FONTS_GetGlyph(Font, ch)].Advance +
+			                      OLED_FONTS_GetKerning(Font, ch, next);
+		}
+	}
 	
 	/* Return pointer */
 	return str;
 }
+
+
+/**
+ * @brief  Looks up the kerning between two characters of a proportional font
+ * @note   Binary search in the font's kerning pairs, which only hold codepoints up to 255
+ * @param  *Font: Pointer to @ref OLED_FontDef_t font
+ * @param  left: Codepoint drawn first
+ * @param  right: Codepoint that follows it, 0 at the end of a string
+ * @retval Pixels to add to the advance of left, 0 for fixed width fonts and pairs without kerning
+ */
+int8_t OLED_FONTS_GetKerning(const OLED_FontDef_t* Font, uint32_t left, uint32_t right)
+{
+	const OLED_FontKern_t *kern;
+	uint16_t key, k, lo = 0, hi;
+	
+	if (Font->metrics == NULL || Font->metrics->Kerning == NULL || left > 0xFF || right > 0xFF || right == 0)
+	{
+		return 0;
+	}
+	
+	key = (uint16_t)((left << 8) | right);
+	hi = Font->metrics->KerningCount;
+	
+	while (lo < hi)
+	{
+		kern = &Font->metrics->Kerning[(lo + hi) / 2];
+		k = (kern->Left << 8) | kern->Right;
+		
+		if (k == key)
+		{
+			return kern->Adjust;
+		}
+		
+		if (k < key)
+		{
+			lo = (lo + hi) / 2 + 1;
+		}
+		else
+		{
+			hi = (lo + hi) / 2;
+		}
+	}
+	
+	return 0;
+}
+
+
+/**
+ * @brief  Decodes the next character of a UTF-8 string
+ * @note   Malformed sequences (stray continuation bytes, overlong forms, surrogates) give @ref OLED_FONTS_INVALID
+ *         and skip only the bytes that were examined, so decoding always moves on
+ * @param  **str: Pointer to the string, moved past the character. Left alone at the terminating zero
+ * @retval Codepoint, 0 at the end of the string
+ */
+uint32_t OLED_FONTS_DecodeUtf8(const char** str)
+{
+	static const uint32_t min[4] = { 0, 0x80, 0x800, 0x10000 };
+	const uint8_t *s = (const uint8_t *)*str;
+	uint32_t cp;
+	uint8_t n, i;
+	
+	/* ASCII, the common case */
+	if (s[0] < 0x80)
+	{
+		*str += (s[0] != 0);
+		return s[0];
+	}
+	
+	if ((s[0] & 0xE0) == 0xC0)
+	{
+		cp = s[0] & 0x1F;
+		n = 1;
+	}
+	else if ((s[0] & 0xF0) == 0xE0)
+	{
+		cp = s[0] & 0x0F;
+		n = 2;
+	}
+	else if ((s[0] & 0xF8) == 0xF0)
+	{
+		cp = s[0] & 0x07;
+		n = 3;
+	}
+	else
+	{
+		*str += 1;
+		return OLED_FONTS_INVALID;
+	}
+	
+	for (i = 1; i <= n; i++)
+	{
+		/* Truncated sequence: the byte that ended it starts the next character */
+		if ((s[i] & 0xC0) != 0x80)
+		{
+			*str += i;
+			return OLED_FONTS_INVALID;
+		}
+		
+		cp = (cp << 6) | (s[i] & 0x3F);
+	}
+	
+	*str += n + 1;
+	
+	if (cp < min[n] || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF))
+	{
+		return OLED_FONTS_INVALID;
+	}
+	
+	return cp;
+}
+
+
+/**
+ * @brief  Encodes a codepoint as UTF-8
+ * @param  codepoint: Codepoint, up to 0x10FFFF
+ * @param  *out: At least 5 bytes, filled with the sequence and a terminating zero
+ * @retval Number of bytes in the sequence, 0 for invalid codepoints
+ */
+uint8_t OLED_FONTS_EncodeUtf8(uint32_t codepoint, char* out)
+{
+	uint8_t n, i;
+	
+	if (codepoint < 0x80)
+	{
+		n = 1;
+	}
+	else if (codepoint < 0x800)
+	{
+		n = 2;
+	}
+	else if (codepoint < 0x10000)
+	{
+		n = 3;
+	}
+	else
+	{
+		n = 4;
+	}
+	
+	if (codepoint > 0x10FFFF || (codepoint >= 0xD800 && codepoint <= 0xDFFF))
+	{
+		out[0] = 0;
+		return 0;
+	}
+	
+	/* Continuation bytes from the last one back, then the lead byte with the length in its top bits */
+	for (i = n - 1; i > 0; i--)
+	{
+		out[i] = (char)(0x80 | (codepoint & 0x3F));
+		codepoint >>= 6;
+	}
+	
+	out[0] = (char)((n == 1) ? codepoint : ((0xF00 >> n) & 0xFF) | codepoint);
+	out[n] = 0;
+	
+	return n;
+}
+
+
+/**
+ * @brief  Finds the glyph drawn for a codepoint
+ * @note   ' ' to '~' are found directly (through the map of a subset font), other codepoints by binary search in
+ *         the font's ranges
+ * @param  *Font: Pointer to @ref OLED_FontDef_t font
+ * @param  codepoint: Character to be drawn
+ * @retval Glyph index in the font's tables, the fallback glyph for codepoints the font does not have
+ */
+uint16_t OLED_FONTS_GetGlyph(const OLED_FontDef_t* Font, uint32_t codepoint)
+{
+	const OLED_FontCharset_t *charset = Font->charset;
+	const OLED_FontRange_t *range;
+	uint16_t lo = 1, hi;
+	
+	if (codepoint - ' ' < OLED_FONTS_CHARS)
+	{
+		return (charset == NULL || charset->Map == NULL) ? (uint16_t)(codepoint - ' ') : charset->Map[codepoint - ' '];
+	}
+	
+	if (charset == NULL)
+	{
+		return '?' - ' ';
+	}
+	
+	/* Last range starting at or before the codepoint */
+	hi = charset->RangeCount;
+	
+	while (lo < hi)
+	{
+		range = &charset->Ranges[(lo + hi) / 2];
+		
+		if (range->First <= codepoint)
+		{
+			lo = (lo + hi) / 2 + 1;
+		}
+		else
+		{
+			hi = (lo + hi) / 2;
+		}
+	}
+	
+	range = &charset->Ranges[lo - 1];
+	
+	if (lo > 1 && codepoint <= range->Last)
+	{
+		return (uint16_t)(range->Index + codepoint - range->First);
+	}
+	
+	return charset->Fallback;
+}
+
+
+/**
+ * @brief  Calculates the flash taken by a font: its descriptor and every table it points to
+ * @note   Tables shared by several fonts are counted for each of them
+ * @param  *Font: Pointer to @ref OLED_FontDef_t font
+ * @retval Size in bytes
+ */
+uint32_t OLED_FONTS_GetFlashSize(const OLED_FontDef_t* Font)
+{
+	const OLED_FontGlyph_t *glyph;
+	uint32_t size = sizeof(OLED_FontDef_t), end = 0;
+	uint16_t i, count = OLED_FONTS_CHARS;
+	
+	if (Font->charset != NULL)
+	{
+		count = Font->charset->GlyphCount;
+		size += sizeof(OLED_FontCharset_t) + Font->charset->RangeCount * sizeof(OLED_FontRange_t);
+		
+		if (Font->charset->Map != NULL)
+		{
+			size += OLED_FONTS_CHARS;
+		}
+	}
+	
+	if (Font->data != NULL)
+	{
+		size += count * Font->FontHeight * sizeof(uint16_t);
+	}
+	
+	if (Font->glyphs != NULL)
+	{
+		size += count * ((Font->FontHeight + 7) / 8) * Font->FontWidth;
+	}
+	
+	if (Font->metrics != NULL)
+	{
+		/* The bitmap ends with the glyph stored last */
+		for (i = 0; i < count; i++)
+		{
+			glyph = &Font->metrics->Glyphs[i];
+			
+			if (glyph->Start + (uint32_t)glyph->Width * ((glyph->Height + 7) / 8) > end)
+			{
+				end = glyph->Start + (uint32_t)glyph->Width * ((glyph->Height + 7) / 8);
+			}
+		}
+		
+		size += sizeof(OLED_FontMetrics_t) + count * sizeof(OLED_FontGlyph_t) + end +
+		        Font->metrics->KerningCount * sizeof(OLED_FontKern_t);
+	}
+	
+	if (Font->packed != NULL)
+	{
+		size += sizeof(OLED_FontPacked_t);
+		
+		if (Font->packed->Offsets != NULL)
+		{
+			size += (count + 1) * sizeof(uint16_t) + (Font->packed->Offsets[count] & 0x7FFF);
+		}
+		else
+		{
+			size += (count * Font->FontWidth * Font->FontHeight + 7) / 8;
+		}
+	}
+	
+	return size;
+}
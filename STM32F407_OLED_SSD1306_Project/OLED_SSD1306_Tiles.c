@@ -0,0 +1,396 @@
+/**
+  **********************************************************************************************************************
+   * @file   : OLED_SSD1306_Tiles.c
+   * @author : Sharath N
+   * @brief  : Character-cell text screen with changed-cell updates for the SSD1306 OLED Driver
+  **********************************************************************************************************************
+*/
+
+#include "OLED_SSD1306_Tiles.h"
+
+
+#define OLED_TILES_CELL_SIZE         64    /* Bytes of one rendered character, fonts up to 16 x 32 pixels */
+
+/* Private tile screen state */
+typedef struct {
+	OLED_FontDef_t *Font;
+	uint8_t Cols;                              /* Cells per row */
+	uint8_t Rows;                              /* Cell rows */
+	uint8_t Pages;                             /* Pages of a cell row */
+	uint32_t AllCols;                          /* One bit for each cell of a row */
+	uint32_t Dirty[OLED_TILES_MAX_ROWS];       /* Cells changed but not rendered, bit n for column n */
+	uint32_t Pending[OLED_TILES_MAX_ROWS];     /* Cells rendered but not sent */
+	char Text[OLED_TILES_MAX_ROWS][OLED_TILES_MAX_COLS];
+	uint8_t Attr[OLED_TILES_MAX_ROWS][OLED_TILES_MAX_COLS];
+	OLED_Tiles_Stats_t Stats;
+} OLED_Tiles_t;
+
+/* Private Variables */
+static OLED_Tiles_t OLED_TILES;
+static uint8_t OLED_TILES_CellPixels[OLED_TILES_CELL_SIZE];
+static uint8_t OLED_TILES_Window[OLED_WIDTH * 4];    /* Pages of a cell row, at most 4 */
+
+
+/* Stores a cell and marks it if it changed */
+static void OLED_TILES_Set(uint8_t col, uint8_t row, char ch, uint8_t attr)
+{
+	if (OLED_TILES.Text[row][col] != ch || OLED_TILES.Attr[row][col] != attr)
+	{
+		OLED_TILES.Text[row][col] = ch;
+		OLED_TILES.Attr[row][col] = attr;
+		OLED_TILES.Dirty[row] |= 1UL << col;
+	}
+}
+
+
+/* Number of cells from col that fit in a row, 0 outside the grid */
+static uint8_t OLED_TILES_Span(uint8_t col, uint8_t row, uint8_t count)
+{
+	if (OLED_TILES.Font == NULL || row >= OLED_TILES.Rows || col >= OLED_TILES.Cols)
+	{
+		return 0;
+	}
+	
+	return (count < OLED_TILES.Cols - col) ? count : OLED_TILES.Cols - col;
+}
+
+
+/**
+ * @brief  Renders a cell into OLED_Buffer
+ * @note   Fonts with page-major glyphs are copied byte by byte, the others are drawn by the driver into a
+ *         cleared cell first, whatever their format
+ */
+static void OLED_TILES_DrawCell(uint8_t col, uint8_t row)
+{
+	OLED_FontDef_t *font = OLED_TILES.Font;
+	const uint8_t *src = OLED_TILES_CellPixels;
+	uint8_t *dst = &OLED_Buffer[col * font->FontWidth + row * OLED_TILES.Pages * OLED_WIDTH];
+	uint8_t invert = (OLED_TILES.Attr[row][col] == OLED_TILE_INVERSE) ? 0xFF : 0x00;
+	uint8_t ch = (uint8_t)OLED_TILES.Text[row][col];
+	OLED_Canvas_t cell, *target;
+	OLED_ROP_t rop;
+	OLED_TEXT_MODE_t mode;
+	uint8_t scale, i, p;
+	
+	if (font->glyphs != NULL && font->metrics == NULL)
+	{
+		src = &font->glyphs[OLED_FONTS_GetGlyph(font, ch) * OLED_TILES.Pages * font->FontWidth];
+	}
+	else
+	{
+		target = OLED_SSD1306_GetTarget();
+		rop = OLED_SSD1306_GetRasterOp();
+		mode = OLED_SSD1306_GetTextMode();
+		scale = OLED_SSD1306_GetTextScale();
+		
+		OLED_SSD1306_CanvasInit(&cell, OLED_TILES_CellPixels, font->FontWidth, OLED_TILES.Pages * 8);
+		OLED_SSD1306_SetTarget(&cell);
+		OLED_SSD1306_SetRasterOp(OLED_ROP_COPY);
+		OLED_SSD1306_SetTextMode(OLED_TEXT_OPAQUE);
+		OLED_SSD1306_SetTextScale(1);
+		OLED_SSD1306_Fill(OLED_COLOR_BLACK);
+		OLED_SSD1306_GotoXY(0, 0);
+		OLED_SSD1306_Putc((char)ch, font, OLED_COLOR_WHITE);
+		OLED_SSD1306_SetTarget(target);
+		OLED_SSD1306_SetRasterOp(rop);
+		OLED_SSD1306_SetTextMode(mode);
+		OLED_SSD1306_SetTextScale(scale);
+	}
+	
+	for (p = 0; p < OLED_TILES.Pages; p++, dst += OLED_WIDTH, src += font->FontWidth)
+	{
+		for (i = 0; i < font->FontWidth; i++)
+		{
+			dst[i] = src[i] ^ invert;
+		}
+	}
+	
+	OLED_TILES.Stats.Cells++;
+}
+
+
+/* Sends cells c0..c1 of a row as one window of the row's pages */
+static void OLED_TILES_SendRun(uint8_t row, uint8_t c0, uint8_t c1)
+{
+	uint8_t x0 = c0 * OLED_TILES.Font->FontWidth, x1 = (c1 + 1) * OLED_TILES.Font->FontWidth - 1;
+	uint8_t page0 = row * OLED_TILES.Pages, p;
+	uint16_t w = x1 - x0 + 1, len = 0;
+	
+	/* The window fills page by page, the pages of OLED_Buffer are OLED_WIDTH apart */
+	for (p = 0; p < OLED_TILES.Pages; p++, len += w)
+	{
+		memcpy(&OLED_TILES_Window[len], &OLED_Buffer[x0 + (page0 + p) * OLED_WIDTH], w);
+	}
+	
+	/* SetWindow() waits for the transfer before, Send_DataAsync() copies the data */
+	OLED_SSD1306_SetWindow(x0, x1, page0, page0 + OLED_TILES.Pages - 1);
+	
+	if (OLED_SSD1306_Send_DataAsync(OLED_TILES_Window, len, NULL))
+	{
+		OLED_TILES.Stats.Flushes++;
+		OLED_TILES.Stats.Bytes += len;
+	}
+	else
+	{
+		OLED_TILES.Stats.Errors++;
+	}
+}
+
+
+/**
+ * @brief  Starts a tile screen of blank cells, all of them to be rendered and sent by the next flush
+ * @note   Cells are drawn into OLED_Buffer in panel coordinates, the rotation must be OLED_ROTATION_0 or
+ *         OLED_ROTATION_180 and the clip rectangle the whole screen. The driver's raster operation, text mode
+ *         and text scale do not apply
+ * @param  *Font: Pointer to @ref OLED_FontDef_t structure with used font, at most 16 x 32 pixels.
+ *         Every character takes FontWidth columns, proportional fonts are drawn left aligned in the cell
+ * @retval 1 on success, 0 if the font is too large or the screen is rotated by 90 or 270 degrees
+ */
+uint8_t OLED_TILES_Init(OLED_FontDef_t* Font)
+{
+	if (Font->FontWidth == 0 || Font->FontWidth > 16 || Font->FontHeight == 0 || Font->FontHeight > 32 ||
+	    OLED_SSD1306_GetWidth() != OLED_WIDTH)
+	{
+		return 0;
+	}
+	
+	memset(&OLED_TILES, 0, sizeof(OLED_TILES));
+	memset(OLED_TILES.Text, ' ', sizeof(OLED_TILES.Text));
+	
+	OLED_TILES.Font = Font;
+	OLED_TILES.Cols = (OLED_WIDTH / Font->FontWidth < OLED_TILES_MAX_COLS) ? OLED_WIDTH / Font->FontWidth : OLED_TILES_MAX_COLS;
+	OLED_TILES.Pages = (Font->FontHeight + 7) / 8;
+	OLED_TILES.Rows = (OLED_HEIGHT / 8) / OLED_TILES.Pages;
+	OLED_TILES.AllCols = (1UL << OLED_TILES.Cols) - 1;
+	
+	OLED_TILES_Invalidate();
+	
+	return 1;
+}
+
+
+/**
+ * @brief  Returns the number of cells per row
+ * @retval Columns of the grid, 0 before @ref OLED_TILES_Init()
+ */
+uint8_t OLED_TILES_GetCols(void)
+{
+	return OLED_TILES.Cols;
+}
+
+
+/**
+ * @brief  Returns the number of cell rows
+ * @retval Rows of the grid, 0 before @ref OLED_TILES_Init()
+ */
+uint8_t OLED_TILES_GetRows(void)
+{
+	return OLED_TILES.Rows;
+}
+
+
+/**
+ * @brief  Puts a character into a cell
+ * @note   Nothing is drawn yet, the cell is only marked when its character or attribute changes
+ * @param  col: Cell column
+ * @param  row: Cell row
+ * @param  ch: Character, bytes from 0x80 are taken as Latin-1 like @ref OLED_SSD1306_Putc()
+ * @param  attr: This parameter can be a value of @ref OLED_TILE_ATTR_t enumeration
+ * @retval None
+ */
+void OLED_TILES_Putc(uint8_t col, uint8_t row, char ch, OLED_TILE_ATTR_t attr)
+{
+	if (OLED_TILES_Span(col, row, 1) != 0)
+	{
+		OLED_TILES_Set(col, row, ch, (uint8_t)attr);
+	}
+}
+
+
+/**
+ * @brief  Puts a string into consecutive cells of a row
+ * @param  col: Cell column of the first character
+ * @param  row: Cell row
+ * @param  *str: String to be put, cut at the end of the row
+ * @param  attr: This parameter can be a value of @ref OLED_TILE_ATTR_t enumeration
+ * @retval Column after the last character put, for padding the rest of the row with @ref OLED_TILES_Fill()
+ */
+uint8_t OLED_TILES_Puts(uint8_t col, uint8_t row, const char* str, OLED_TILE_ATTR_t attr)
+{
+	uint8_t n = OLED_TILES_Span(col, row, 0xFF);
+	
+	for ( ; n != 0 && *str; n--, col++)
+	{
+		OLED_TILES_Set(col, row, *str++, (uint8_t)attr);
+	}
+	
+	return col;
+}
+
+
+/**
+ * @brief  Puts the same character into count cells of a row
+ * @param  col: First cell column
+ * @param  row: Cell row
+ * @param  count: Number of cells, cut at the end of the row
+ * @param  ch: Character, ' ' to clear the cells
+ * @param  attr: This parameter can be a value of @ref OLED_TILE_ATTR_t enumeration
+ * @retval None
+ */
+void OLED_TILES_Fill(uint8_t col, uint8_t row, uint8_t count, char ch, OLED_TILE_ATTR_t attr)
+{
+	uint8_t n = OLED_TILES_Span(col, row, count);
+	
+	for ( ; n != 0; n--, col++)
+	{
+		OLED_TILES_Set(col, row, ch, (uint8_t)attr);
+	}
+}
+
+
+/**
+ * @brief  Changes the attribute of count cells of a row and keeps their characters
+ * @param  col: First cell column
+ * @param  row: Cell row
+ * @param  count: Number of cells, cut at the end of the row
+ * @param  attr: This parameter can be a value of @ref OLED_TILE_ATTR_t enumeration
+ * @retval None
+ */
+void OLED_TILES_SetAttr(uint8_t col, uint8_t row, uint8_t count, OLED_TILE_ATTR_t attr)
+{
+	uint8_t n = OLED_TILES_Span(col, row, count);
+	
+	for ( ; n != 0; n--, col++)
+	{
+		OLED_TILES_Set(col, row, OLED_TILES.Text[row][col], (uint8_t)attr);
+	}
+}
+
+
+/**
+ * @brief  Returns the character of a cell
+ * @param  col: Cell column
+ * @param  row: Cell row
+ * @retval Character of the cell, 0 outside the grid
+ */
+char OLED_TILES_GetChar(uint8_t col, uint8_t row)
+{
+	return (OLED_TILES_Span(col, row, 1) != 0) ? OLED_TILES.Text[row][col] : 0;
+}
+
+
+/**
+ * @brief  Blanks every cell, only those that were not blank are sent again
+ * @retval None
+ */
+void OLED_TILES_Clear(void)
+{
+	uint8_t row;
+	
+	for (row = 0; row < OLED_TILES.Rows; row++)
+	{
+		OLED_TILES_Fill(0, row, OLED_TILES.Cols, ' ', OLED_TILE_NORMAL);
+	}
+}
+
+
+/**
+ * @brief  Marks every cell as changed
+ * @note   For when something else has drawn over the grid in OLED_Buffer or on the panel
+ * @retval None
+ */
+void OLED_TILES_Invalidate(void)
+{
+	uint8_t row;
+	
+	for (row = 0; row < OLED_TILES.Rows; row++)
+	{
+		OLED_TILES.Dirty[row] = OLED_TILES.AllCols;
+	}
+}
+
+
+/**
+ * @brief  Renders the changed cells into OLED_Buffer without sending them
+ * @note   For drawing more on top before the screen is sent some other way. What was rendered is still sent
+ *         by the next @ref OLED_TILES_Flush()
+ * @retval None
+ */
+void OLED_TILES_Render(void)
+{
+	uint8_t row, col;
+	
+	for (row = 0; row < OLED_TILES.Rows; row++)
+	{
+		for (col = 0; OLED_TILES.Dirty[row] >> col; col++)
+		{
+			if ((OLED_TILES.Dirty[row] >> col) & 1)
+			{
+				OLED_TILES_DrawCell(col, row);
+			}
+		}
+		
+		OLED_TILES.Pending[row] |= OLED_TILES.Dirty[row];
+		OLED_TILES.Dirty[row] = 0;
+	}
+}
+
+
+/**
+ * @brief  Renders the changed cells and sends every cell rendered since the last flush
+ * @note   Transfers are interrupt driven, the function returns while the last one is still running
+ * @retval None
+ */
+void OLED_TILES_Flush(void)
+{
+	uint16_t gap = OLED_TILES_MERGE_BYTES;
+	uint8_t row, c0, c1, col;
+	uint32_t pending;
+	
+	if (OLED_TILES.Font == NULL)
+	{
+		return;
+	}
+	
+	OLED_TILES_Render();
+	
+	/* Unchanged cells between two changed ones are sent too while that is cheaper than another window */
+	gap /= OLED_TILES.Font->FontWidth * OLED_TILES.Pages;
+	
+	for (row = 0; row < OLED_TILES.Rows; row++)
+	{
+		pending = OLED_TILES.Pending[row];
+		OLED_TILES.Pending[row] = 0;
+		
+		for (c0 = 0; pending >> c0; c0 = col)
+		{
+			if (((pending >> c0) & 1) == 0)
+			{
+				col = c0 + 1;
+				continue;
+			}
+			
+			for (c1 = c0, col = c0 + 1; pending >> col && col - c1 - 1 <= gap; col++)
+			{
+				if ((pending >> col) & 1)
+				{
+					c1 = col;
+				}
+			}
+			
+			OLED_TILES_SendRun(row, c0, c1);
+			col = c1 + 1;
+		}
+	}
+}
+
+
+/**
+ * @brief  Returns the figures gathered since @ref OLED_TILES_Init()
+ * @param  *stats: Filled in with the current figures
+ * @retval None
+ */
+void OLED_TILES_GetStats(OLED_Tiles_Stats_t* stats)
+{
+	*stats = OLED_TILES.Stats;
+}
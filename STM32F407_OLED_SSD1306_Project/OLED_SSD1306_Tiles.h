@@ -0,0 +1,176 @@
+/**
+  **********************************************************************************************************************
+   * @file   : OLED_SSD1306_Tiles.h
+   * @author : Sharath N
+   * @brief  : Character-cell text screen with changed-cell updates for the SSD1306 OLED Driver
+  **********************************************************************************************************************
+*/
+
+/*
+          The screen is a grid of character cells on the page grid of the panel: a cell is FontWidth columns
+          wide and (FontHeight + 7) / 8 pages high, 18 x 4 cells with the 7x10 font. Every cell keeps its
+          character and attribute, and writing the same character again changes nothing. Only cells whose
+          contents changed are rendered into OLED_Buffer, by copying the font's page-major glyph bytes when it
+          has them, and only their columns are sent: the changed cells of a cell row go out as one window of
+          the row's pages, split where a long stretch of unchanged cells would cost more than a new window.
+
+          Redrawing a whole menu every time is therefore cheap. Moving the selection marker from one item to
+          the next sends the two marker cells, 28 bytes with 7x10, instead of the 1 KB frame.
+
+          The grid covers the top left of the screen, columns to the right of the last cell and pages below the
+          last cell row are left alone and can be drawn on as usual.
+*/
+
+#ifndef OLED_SSD1306_TILES_H
+#define OLED_SSD1306_TILES_H
+
+#include <stdint.h>
+#include "STM32F407_OLED_SSD1306_Driver.h"
+
+#define OLED_TILES_MAX_COLS          21    // Cells per row at most, OLED_WIDTH / 6
+#define OLED_TILES_MAX_ROWS          8     // Cell rows at most, one page each
+#define OLED_TILES_MERGE_BYTES       16    // Unchanged bytes sent rather than starting another window
+
+
+/**
+ * @brief  How a cell is drawn
+ */
+typedef enum {
+	OLED_TILE_NORMAL  = 0x00, /*!< Lit character on a dark cell */
+	OLED_TILE_INVERSE = 0x01  /*!< Dark character on a lit cell, for the selected menu item */
+} OLED_TILE_ATTR_t;
+
+
+/**
+ * @brief  Tile screen figures, for checking how much goes over the bus
+ */
+typedef struct {
+	uint32_t Cells;       /*!< Cells rendered into OLED_Buffer */
+	uint32_t Flushes;     /*!< Windows sent to the panel */
+	uint32_t Bytes;       /*!< Display data bytes sent */
+	uint32_t Errors;      /*!< Windows that could not be sent */
+} OLED_Tiles_Stats_t;
+
+
+/**
+ * @brief  Starts a tile screen of blank cells, all of them to be rendered and sent by the next flush
+ * @note   Cells are drawn into OLED_Buffer in panel coordinates, the rotation must be OLED_ROTATION_0 or
+ *         OLED_ROTATION_180 and the clip rectangle the whole screen. The driver's raster operation, text mode
+ *         and text scale do not apply
+ * @param  *Font: Pointer to @ref OLED_FontDef_t structure with used font, at most 16 x 32 pixels.
+ *         Every character takes FontWidth columns, proportional fonts are drawn left aligned in the cell
+ * @retval 1 on success, 0 if the font is too large or the screen is rotated by 90 or 270 degrees
+ */
+uint8_t OLED_TILES_Init(OLED_FontDef_t* Font);
+
+
+/**
+ * @brief  Returns the number of cells per row
+ * @retval Columns of the grid, 0 before @ref OLED_TILES_Init()
+ */
+uint8_t OLED_TILES_GetCols(void);
+
+
+/**
+ * @brief  Returns the number of cell rows
+ * @retval Rows of the grid, 0 before @ref OLED_TILES_Init()
+ */
+uint8_t OLED_TILES_GetRows(void);
+
+
+/**
+ * @brief  Puts a character into a cell
+ * @note   Nothing is drawn yet, the cell is only marked when its character or attribute changes
+ * @param  col: Cell column
+ * @param  row: Cell row
+ * @param  ch: Character, bytes from 0x80 are taken as Latin-1 like @ref OLED_SSD1306_Putc()
+ * @param  attr: This parameter can be a value of @ref OLED_TILE_ATTR_t enumeration
+ * @retval None
+ */
+void OLED_TILES_Putc(uint8_t col, uint8_t row, char ch, OLED_TILE_ATTR_t attr);
+
+
+/**
+ * @brief  Puts a string into consecutive cells of a row
+ * @param  col: Cell column of the first character
+ * @param  row: Cell row
+ * @param  *str: String to be put, cut at the end of the row
+ * @param  attr: This parameter can be a value of @ref OLED_TILE_ATTR_t enumeration
+ * @retval Column after the last character put, for padding the rest of the row with @ref OLED_TILES_Fill()
+ */
+uint8_t OLED_TILES_Puts(uint8_t col, uint8_t row, const char* str, OLED_TILE_ATTR_t attr);
+
+
+/**
+ * @brief  Puts the same character into count cells of a row
+ * @param  col: First cell column
+ * @param  row: Cell row
+ * @param  count: Number of cells, cut at the end of the row
+ * @param  ch: Character, ' ' to clear the cells
+ * @param  attr: This parameter can be a value of @ref OLED_TILE_ATTR_t enumeration
+ * @retval None
+ */
+void OLED_TILES_Fill(uint8_t col, uint8_t row, uint8_t count, char ch, OLED_TILE_ATTR_t attr);
+
+
+/**
+ * @brief  Changes the attribute of count cells of a row and keeps their characters
+ * @param  col: First cell column
+ * @param  row: Cell row
+ * @param  count: Number of cells, cut at the end of the row
+ * @param  attr: This parameter can be a value of @ref OLED_TILE_ATTR_t enumeration
+ * @retval None
+ */
+void OLED_TILES_SetAttr(uint8_t col, uint8_t row, uint8_t count, OLED_TILE_ATTR_t attr);
+
+
+/**
+ * @brief  Returns the character of a cell
+ * @param  col: Cell column
+ * @param  row: Cell row
+ * @retval Character of the cell, 0 outside the grid
+ */
+char OLED_TILES_GetChar(uint8_t col, uint8_t row);
+
+
+/**
+ * @brief  Blanks every cell, only those that were not blank are sent again
+ * @retval None
+ */
+void OLED_TILES_Clear(void);
+
+
+/**
+ * @brief  Marks every cell as changed
+ * @note   For when something else has drawn over the grid in OLED_Buffer or on the panel
+ * @retval None
+ */
+void OLED_TILES_Invalidate(void);
+
+
+/**
+ * @brief  Renders the changed cells into OLED_Buffer without sending them
+ * @note   For drawing more on top before the screen is sent some other way. What was rendered is still sent
+ *         by the next @ref OLED_TILES_Flush()
+ * @retval None
+ */
+void OLED_TILES_Render(void);
+
+
+/**
+ * @brief  Renders the changed cells and sends every cell rendered since the last flush
+ * @note   Transfers are interrupt driven, the function returns while the last one is still running
+ * @retval None
+ */
+void OLED_TILES_Flush(void);
+
+
+/**
+ * @brief  Returns the figures gathered since @ref OLED_TILES_Init()
+ * @param  *stats: Filled in with the current figures
+ * @retval None
+ */
+void OLED_TILES_GetStats(OLED_Tiles_Stats_t* stats);
+
+
+#endif
@@ -10,16 +10,93 @@
 #include "STM32F407_OLED_SSD1306_Driver.h"
 
 
+/* SSD1306 data buffer */
+uint8_t OLED_Buffer[OLED_CANVAS_BUFFER_SIZE(OLED_WIDTH, OLED_HEIGHT)];
+
+/* Canvas describing OLED_Buffer, the default drawing target */
+static OLED_Canvas_t OLED_Screen = { OLED_WIDTH, OLED_HEIGHT, OLED_Buffer };
+
+/* Clip rectangle in drawing coordinates, inclusive. Empty when X0 > X1 or Y0 > Y1 */
+typedef struct {
+	int16_t X0;
+	int16_t Y0;
+	int16_t X1;
+	int16_t Y1;
+} OLED_ClipRect_t;
+
 /* Private SSD1306 structure */
 typedef struct {
 	uint16_t CurrentX;
 	uint16_t CurrentY;
-	uint8_t Inverted;
+	uint8_t Inverted;     /* Inverse display is done by the controller, framebuffer stays as drawn */
 	uint8_t Initialized;
+	uint8_t RasterOp;     /* OLED_ROP_t used by all drawing functions */
+	uint8_t TextMode;     /* OLED_TEXT_MODE_t */
+	uint8_t TextScale;    /* Glyphs drawn TextScale times their size, 1 to OLED_TEXT_MAX_SCALE */
+	OLED_Canvas_t *Target;
+	uint16_t Width;       /* Target width as seen by the drawing functions (after rotation) */
+	uint16_t Height;      /* Target height as seen by the drawing functions (after rotation) */
+	uint8_t Rotation;     /* OLED_ROTATION_t */
+	uint8_t Transposed;   /* Drawing into the screen at 90 or 270 degrees, x and y are swapped in software */
+	int16_t ClipX0;       /* Effective clip rectangle (inclusive): the top of the clip stack within the target */
+	int16_t ClipY0;
+	int16_t ClipX1;
+	int16_t ClipY1;
+	uint8_t ClipDepth;    /* Number of rectangles on the clip stack */
+	OLED_ClipRect_t ClipStack[OLED_CLIP_STACK_DEPTH];
+	volatile uint8_t AsyncBusy;      /* Interrupt driven data transfer in progress */
+	uint8_t AddrMode;                /* Memory addressing mode the controller is in */
+	OLED_AsyncCallback_t AsyncDone;  /* Called from the I2C interrupt when the transfer ends */
 } OLED_SSD1306_t;
 
+/* Span operation, resolved once per primitive (from color and raster op) instead of once per pixel.
+   Bit 0 clears the masked bits, bit 1 then toggles them */
+typedef enum {
+	OLED_SPAN_NONE   = 0x00,
+	OLED_SPAN_CLEAR  = 0x01,
+	OLED_SPAN_INVERT = 0x02,
+	OLED_SPAN_SET    = 0x03
+} OLED_SpanOp_t;
+
+/* Byte masks applying a span operation to the bits set in mask as dst = (dst & AND) ^ XOR */
+#define OLED_SPAN_AND(op, mask)      ((uint8_t)(((op) & OLED_SPAN_CLEAR) ? ~(mask) : 0xFF))
+#define OLED_SPAN_XOR(op, mask)      ((uint8_t)(((op) & OLED_SPAN_INVERT) ? (mask) : 0x00))
+
+/* Next character of a UTF-8 string and the glyph drawn for it, ASCII without a function call */
+#define OLED_NEXT_CHAR(p)            (((uint8_t)**(p) - 1u < 0x7Fu) ? (uint32_t)(uint8_t)*(*(p))++ : OLED_FONTS_DecodeUtf8(p))
+#define OLED_GLYPH(font, ch)         (((ch) - ' ' >= OLED_FONTS_CHARS) ? OLED_FONTS_GetGlyph(font, ch) : \
+                                      ((font)->charset == NULL || (font)->charset->Map == NULL) ? (uint16_t)((ch) - ' ') : \
+                                      (uint16_t)(font)->charset->Map[(ch) - ' '])
+
+/* Text raster op of transparent text that leaves the target untouched (black under OR, AND-NOT and XOR) */
+#define OLED_TEXT_ROP_NONE           0xFF
+
+/* Bytes of a decoded bit-packed character cell, fonts up to 16 x 32 pixels */
+#define OLED_GLYPH_CELL_SIZE         64
+
+/* Private functions used ahead of their definition */
+static OLED_SpanOp_t OLED_SpanOp(OLED_COLOR_t color);
+static void OLED_FillPageSpan(uint8_t *p, uint16_t n, uint8_t and_mask, uint8_t xor_mask);
+
 /* Private Variable */
-static OLED_SSD1306_t OLED_SSD1306;
+static OLED_SSD1306_t OLED_SSD1306 = { 0, 0, 0, 0, OLED_ROP_COPY, OLED_TEXT_OPAQUE, 1, &OLED_Screen, OLED_WIDTH, OLED_HEIGHT,
+                                        OLED_ROTATION_0, 0, 0, 0, OLED_WIDTH - 1, OLED_HEIGHT - 1, 0, { { 0 } },
+                                        0, OLED_PAGE_ADDR_MODE, NULL };
+
+/* Control byte followed by a copy of the data, sent by OLED_SSD1306_Send_DataAsync() */
+static uint8_t OLED_AsyncTx[OLED_CANVAS_BUFFER_SIZE(OLED_WIDTH, OLED_HEIGHT) + 1];
+
+/* Decoded bytes kept for LZ back references by OLED_SSD1306_DrawBitmap(), the farthest one reaches 1024 back */
+#define OLED_LZ_WINDOW               1024
+
+/* Last OLED_LZ_WINDOW decoded bytes of an LZ bitmap's data and mask */
+static uint8_t OLED_LzHistory[2][OLED_LZ_WINDOW];
+
+/* Cohen-Sutherland outcodes */
+#define OLED_CLIP_LEFT               0x01
+#define OLED_CLIP_RIGHT              0x02
+#define OLED_CLIP_TOP                0x04
+#define OLED_CLIP_BOTTOM             0x08
 
 /* I2C Handle  */
 I2C_HandleTypeDef myI2Chandle;
@@ -68,6 +145,12 @@ static void I2C_Config(void)
 	myI2Chandle.Init.OwnAddress1 = 0;
 	myI2Chandle.Init.OwnAddress2 = 0;
 	HAL_I2C_Init(&myI2Chandle);
+	
+	/* Event and error interrupts for OLED_SSD1306_Send_DataAsync(), below SysTick so HAL timeouts keep running */
+	HAL_NVIC_SetPriority(I2C1_EV_IRQn, 1, 0);
+	HAL_NVIC_SetPriority(I2C1_ER_IRQn, 1, 0);
+	HAL_NVIC_EnableIRQ(I2C1_EV_IRQn);
+	HAL_NVIC_EnableIRQ(I2C1_ER_IRQn);
 }
 
 
@@ -94,6 +177,11 @@ void OLED_SSD1306_Send_Command(uint8_t cmd)
 	command_tx[0] = control_byte;
 	command_tx[1] = cmd;
 	
+	/* Let an interrupt driven transfer finish first */
+	while (OLED_SSD1306.AsyncBusy)
+	{
+	}
+	
 	/* Transmit the command */
 	if(HAL_I2C_IsDeviceReady(& myI2Chandle, OLED_I2C_ADDRESS, 1, 10) == HAL_OK)
 		HAL_I2C_Master_Transmit(& myI2Chandle,OLED_I2C_ADDRESS, command_tx, 2, 100);
@@ -118,6 +206,11 @@ void OLED_SSD1306_Send_Data(uint8_t data)
 	data_tx[0] = control_byte;
 	data_tx[1] = data;
 	
+	/* Let an interrupt driven transfer finish first */
+	while (OLED_SSD1306.AsyncBusy)
+	{
+	}
+	
 	/* Transmit the data */
 	if(HAL_I2C_IsDeviceReady(& myI2Chandle, OLED_I2C_ADDRESS, 1, 10) == HAL_OK)
 		HAL_I2C_Master_Transmit(& myI2Chandle,OLED_I2C_ADDRESS, data_tx, 2, 100);
@@ -144,14 +237,17 @@ void OLED_SSD1306_Init(void)
 	OLED_SSD1306_Send_Command(OLED_SET_MEM_ADDR_MODE);      //Set Memory Addressing Mode
 	OLED_SSD1306_Send_Command(OLED_PAGE_ADDR_MODE);         //Select Page Addressing Mode
 	OLED_SSD1306_Send_Command(OLED_PAGE_START_ADDR);        //Set Page Start Address for Page Addressing Mode,0-7
-	OLED_SSD1306_Send_Command(OLED_COM_SCAN_DIR_REMAPPED);  //Set COM Output Scan Direction
+	OLED_SSD1306_Send_Command((OLED_SSD1306.Rotation & OLED_ROTATION_180) ?
+	                          OLED_COM_SCAN_DIR_NORMAL : OLED_COM_SCAN_DIR_REMAPPED);  //Set COM Output Scan Direction
 	OLED_SSD1306_Send_Command(OLED_LOW_COLUMN_START_ADDR);  //set low column address
 	OLED_SSD1306_Send_Command(OLED_HIGH_COLUMN_START_AADR); //set high  column address
 	OLED_SSD1306_Send_Command(OLED_DISP_START_LINE_ADDR);   //set start line address
 	OLED_SSD1306_Send_Command(OLED_SET_CONTRAST_CTRL_REG);  //set contrast control register (Next cmd 00 to FF )
 	OLED_SSD1306_Send_Command(0xAA);                        //0xFF: 256 Contrast (Max)
-	OLED_SSD1306_Send_Command(OLED_SET_SEG_REMAP_127_SEG0); //Set Segment Re-map
-  OLED_SSD1306_Send_Command(OLED_SET_NORMAL_DISPLAY);     //set normal display
+	OLED_SSD1306_Send_Command((OLED_SSD1306.Rotation & OLED_ROTATION_180) ?
+	                          OLED_SET_SEG_REMAP_0_SEG0 : OLED_SET_SEG_REMAP_127_SEG0); //Set Segment Re-map
+  OLED_SSD1306_Send_Command(OLED_SSD1306.Inverted ?
+                            OLED_SET_INVERSE_DISPLAY : OLED_SET_NORMAL_DISPLAY); //set normal/inverse display
   OLED_SSD1306_Send_Command(OLED_SET_MULTIPLEX_RATIO);    //set multiplex ratio(1 to 64)
   OLED_SSD1306_Send_Command(0x3F);                        //Multplex ratio - 64MUX 
   OLED_SSD1306_Send_Command(OLED_OUTPUT_FALLOW_RAM_CNT);  //Entire Display on, Output follows RAM content
@@ -192,8 +288,19 @@ void OLED_SSD1306_Init(void)
  */
 void OLED_SSD1306_Fill(OLED_COLOR_t color)
 {
-	/* Set the memory */
-	memset(OLED_Buffer, (color == OLED_COLOR_BLACK) ? 0x00 : 0xFF, sizeof(OLED_Buffer));
+	OLED_Canvas_t *target = OLED_SSD1306.Target;
+	OLED_SpanOp_t op = OLED_SpanOp(color);
+	
+	if (op == OLED_SPAN_INVERT)
+	{
+		/* XOR white flips the whole target */
+		OLED_FillPageSpan(target->Buffer, OLED_CANVAS_BUFFER_SIZE(target->Width, target->Height), 0xFF, 0xFF);
+	}
+	else if (op != OLED_SPAN_NONE)
+	{
+		/* Set the memory */
+		memset(target->Buffer, (op == OLED_SPAN_CLEAR) ? 0x00 : 0xFF, OLED_CANVAS_BUFFER_SIZE(target->Width, target->Height));
+	}
 }
 
 
@@ -206,6 +313,16 @@ void OLED_SSD1306_UpdateScreen(void)
 	uint8_t m;
 	uint8_t control_byte = 0x40;
 	uint8_t temp[OLED_WIDTH+1];
+	
+	/* Back to page addressing after OLED_SSD1306_SetWindow() */
+	if (OLED_SSD1306.AddrMode != OLED_PAGE_ADDR_MODE)
+	{
+		OLED_SSD1306_SetWindow(0, OLED_WIDTH - 1, 0, OLED_HEIGHT / 8 - 1);
+		OLED_SSD1306_Send_Command(OLED_SET_MEM_ADDR_MODE);
+		OLED_SSD1306_Send_Command(OLED_PAGE_ADDR_MODE);
+		OLED_SSD1306.AddrMode = OLED_PAGE_ADDR_MODE;
+	}
+	
   for (m = 0; m < 8 ; m++)
 	{
 		OLED_SSD1306_Send_Command(OLED_PAGE_START_ADDR + m);
@@ -230,372 +347,2758 @@ void OLED_SSD1306_UpdateScreen(void)
 
 
 /**
- * @brief  Draw Pixel
- * @param  x,y: pixel cordinates
- * @param  color: colour value
+ * @brief  Selects a column and page window in horizontal addressing mode
+ * @note   Following data, blocking or @ref OLED_SSD1306_Send_DataAsync(), fills the window column by column,
+ *         page after page and wraps back to its top left corner, so repeated full window transfers need no
+ *         further commands. @ref OLED_SSD1306_UpdateScreen() switches back to page addressing by itself
+ * @param  x0,x1: First and last column, 0 to OLED_WIDTH - 1
+ * @param  page0,page1: First and last page, 0 to OLED_HEIGHT / 8 - 1
  * @retval None
  */
-void OLED_SSD1306_DrawPixel(uint16_t x, uint16_t y, OLED_COLOR_t color)
+void OLED_SSD1306_SetWindow(uint8_t x0, uint8_t x1, uint8_t page0, uint8_t page1)
 {
-	if (x >= OLED_WIDTH || y >= OLED_HEIGHT)
+	if (OLED_SSD1306.AddrMode != OLED_HORIZONTAL_ADDR_MODE)
 	{
-		/*error*/
-		return;
+		OLED_SSD1306_Send_Command(OLED_SET_MEM_ADDR_MODE);
+		OLED_SSD1306_Send_Command(OLED_HORIZONTAL_ADDR_MODE);
+		OLED_SSD1306.AddrMode = OLED_HORIZONTAL_ADDR_MODE;
 	}
 	
-	/* check if pixels are inverted */
-	if(OLED_SSD1306.Inverted)
+	OLED_SSD1306_Send_Command(OLED_SET_COLUMN_ADDR);
+	OLED_SSD1306_Send_Command(x0);
+	OLED_SSD1306_Send_Command(x1);
+	OLED_SSD1306_Send_Command(OLED_SET_PAGE_ADDR);
+	OLED_SSD1306_Send_Command(page0);
+	OLED_SSD1306_Send_Command(page1);
+}
+
+
+/**
+ * @brief  Starts an interrupt driven data transfer and returns at once
+ * @note   The data is copied first, the caller may change it as soon as this returns.
+ *         Blocking commands and @ref OLED_SSD1306_UpdateScreen() wait for the transfer to end
+ * @param  *data: Display data, usually pages of a window set by @ref OLED_SSD1306_SetWindow()
+ * @param  len: Number of bytes, at most OLED_CANVAS_BUFFER_SIZE(OLED_WIDTH, OLED_HEIGHT)
+ * @param  done: Called from the I2C interrupt when the transfer ends, may be NULL
+ * @retval 1 if the transfer was started, 0 if a transfer is still running or len is too large
+ */
+uint8_t OLED_SSD1306_Send_DataAsync(const uint8_t* data, uint16_t len, OLED_AsyncCallback_t done)
+{
+	if (OLED_SSD1306.AsyncBusy || len > sizeof(OLED_AsyncTx) - 1)
 	{
-		color = (OLED_COLOR_t)!color;
+		return 0;
 	}
 	
-	/* set color */
-	if(color == OLED_COLOR_WHITE)
-	{
-		OLED_Buffer[ x + (y / 8) * OLED_WIDTH ] |= 1 << (y % 8);
-	}
-	else
+	/* control byte for data, see OLED_SSD1306_Send_Data() */
+	OLED_AsyncTx[0] = 0x40;
+	memcpy(&OLED_AsyncTx[1], data, len);
+	
+	OLED_SSD1306.AsyncDone = done;
+	OLED_SSD1306.AsyncBusy = 1;
+	
+	if (HAL_I2C_Master_Transmit_IT(&myI2Chandle, OLED_I2C_ADDRESS, OLED_AsyncTx, len + 1) != HAL_OK)
 	{
-		OLED_Buffer[ x + (y / 8) * OLED_WIDTH ] &= ~(1 << (y % 8));
+		OLED_SSD1306.AsyncBusy = 0;
+		return 0;
 	}
 	
+	return 1;
 }
-	
 
 
 /**
- * @brief  Go to the location (x,y)
- * @param  x,y: pixel cordinates
- * @retval None
+ * @brief  Tells whether an interrupt driven data transfer is running
+ * @retval 1 while @ref OLED_SSD1306_Send_DataAsync() is transferring, 0 otherwise
  */
-void OLED_SSD1306_GotoXY(uint16_t x, uint16_t y)
+uint8_t OLED_SSD1306_IsBusy(void)
 {
-	/* Set the write position */
-	OLED_SSD1306.CurrentX = x;
-	OLED_SSD1306.CurrentY = y;
+	return OLED_SSD1306.AsyncBusy;
 }
 
 
+/**
+ * @brief  Initializes an off-screen canvas over a caller supplied buffer
+ * @param  *canvas: Canvas to be initialized
+ * @param  *buffer: At least OLED_CANVAS_BUFFER_SIZE(w, h) bytes
+ * @param  w,h: Canvas size in pixels
+ * @retval None
+ */
+void OLED_SSD1306_CanvasInit(OLED_Canvas_t* canvas, uint8_t* buffer, uint16_t w, uint16_t h)
+{
+	canvas->Width = w;
+	canvas->Height = h;
+	canvas->Buffer = buffer;
+
+	/* Start with a blank canvas */
+	memset(buffer, 0x00, OLED_CANVAS_BUFFER_SIZE(w, h));
+}
+
 
 /**
- * @brief  Puts character on OLED
- * @note   @ref OLED_SSD1306_UpdateScreen() must be called after that in order to see updated LCD screen
- * @param  ch: Character to be written
- * @param  *Font: Pointer to @ref OLED_FontDef_t structure with used font
- * @param  color: Color used for drawing. This parameter can be a value of @ref OLED_COLOR_t enumeration
- * @retval Character written
+ * @brief  Recomputes the effective clip rectangle: top of the clip stack limited to the target
  */
-char OLED_SSD1306_Putc(char ch, OLED_FontDef_t* Font, OLED_COLOR_t color)
+static void OLED_UpdateClip(void)
 {
-	uint32_t i, b, j;
-	
-	/* Check available space in LCD */
-	if((OLED_WIDTH <= (OLED_SSD1306.CurrentX)) || ((OLED_HEIGHT <= OLED_SSD1306.CurrentY)))
-	{
-		return 0;
-	}
+	OLED_SSD1306.ClipX0 = 0;
+	OLED_SSD1306.ClipY0 = 0;
+	OLED_SSD1306.ClipX1 = OLED_SSD1306.Width - 1;
+	OLED_SSD1306.ClipY1 = OLED_SSD1306.Height - 1;
 	
-	/* Go through the font data and draw the corresponding pixel to display the char*/
-	for (i = 0; i < Font->FontHeight; i++)
+	if (OLED_SSD1306.ClipDepth != 0)
 	{
-		b = Font->data[(ch - 32) * Font->FontHeight + i];
-		for (j = 0; j < Font->FontWidth; j++)
-		{
-			if((b << j) & 0x8000)
-			{
-				OLED_SSD1306_DrawPixel(OLED_SSD1306.CurrentX +j, OLED_SSD1306.CurrentY + i, (OLED_COLOR_t) color);
-			}
-			else
-			{
-				OLED_SSD1306_DrawPixel(OLED_SSD1306.CurrentX +j, OLED_SSD1306.CurrentY + i, (OLED_COLOR_t) !color);
-			}
-		}
+		OLED_ClipRect_t *top = &OLED_SSD1306.ClipStack[OLED_SSD1306.ClipDepth - 1];
+		
+		OLED_SSD1306.ClipX0 = (top->X0 > OLED_SSD1306.ClipX0) ? top->X0 : OLED_SSD1306.ClipX0;
+		OLED_SSD1306.ClipY0 = (top->Y0 > OLED_SSD1306.ClipY0) ? top->Y0 : OLED_SSD1306.ClipY0;
+		OLED_SSD1306.ClipX1 = (top->X1 < OLED_SSD1306.ClipX1) ? top->X1 : OLED_SSD1306.ClipX1;
+		OLED_SSD1306.ClipY1 = (top->Y1 < OLED_SSD1306.ClipY1) ? top->Y1 : OLED_SSD1306.ClipY1;
 	}
-	
-	/* Increase the pointer along x- direction*/
-	OLED_SSD1306.CurrentX += Font->FontWidth;
-	
-	//OLED_SSD1306_UpdateScreen();
-	/* Return the character written */
-	return ch;
-	
 }
 
 
 /**
- * @brief  Puts string on OLED
- * @note   @ref OLED_SSD1306_UpdateScreen() must be called after that in order to see updated LCD screen
- * @param  *str: String to be written
- * @param  *Font: Pointer to @ref OLED_FontDef_t structure with used font
- * @param  color: Color used for drawing. This parameter can be a value of @ref OLED_COLOR_t enumeration
- * @retval Zero on success or character value when function failed
+ * @brief  Checks whether a rectangle (inclusive) lies completely inside the clip rectangle
  */
-char OLED_SSD1306_Puts(char* str, OLED_FontDef_t* Font, OLED_COLOR_t color)
+static uint8_t OLED_RectInClip(int16_t x0, int16_t y0, int16_t x1, int16_t y1)
 {
-	/* Write characters */
-	while(*str)
-	{
-		/*Write Character by character */
-		if(OLED_SSD1306_Putc(*str, Font, color) != *str)
-		{
-			/* Return Error */
-			return *str;
-		}
-    
-     /* Increase the string pointer */
-     str++;
-	}
-
- /* Everything is ok, return 0*/
- return	*str;
-	
+	return (x0 >= OLED_SSD1306.ClipX0 && x1 <= OLED_SSD1306.ClipX1 &&
+	        y0 >= OLED_SSD1306.ClipY0 && y1 <= OLED_SSD1306.ClipY1);
 }
 
 
-
 /**
- * @brief  Draws line on OLED
- * @note   @ref OLED_SSD1306_UpdateScreen() must be called after that in order to see updated LCD screen
- * @param  x0: Line X start point. Valid input is 0 to OLED_WIDTH - 1
- * @param  y0: Line Y start point. Valid input is 0 to OLED_HEIGHT - 1
- * @param  x1: Line X end point. Valid input is 0 to OLED_WIDTH - 1
- * @param  y1: Line Y end point. Valid input is 0 to OLED_HEIGHT - 1
- * @param  c: Color to be used. This parameter can be a value of @ref OLED_COLOR_t enumeration
- * @retval None
+ * @brief  Limits drawing to a rectangle until the matching @ref OLED_SSD1306_PopClip()
+ * @note   The new rectangle is intersected with the one on top of the stack, so nested widgets can never
+ *         draw outside their parent. Coordinates are drawing coordinates of the current target
+ * @param  x,y: Top left corner, may be negative
+ * @param  w,h: Size in pixels, zero gives an empty clip rectangle that rejects all drawing
+ * @retval 1 on success, 0 when the clip stack (OLED_CLIP_STACK_DEPTH) is full
  */
-void OLED_SSD1306_DrawLine(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, OLED_COLOR_t color)
+uint8_t OLED_SSD1306_PushClip(int16_t x, int16_t y, uint16_t w, uint16_t h)
 {
-	int16_t dx, dy, sx, sy, err, e2, i, tmp; 
-	
-	/* Check for overflow */
-	if (x0 >= OLED_WIDTH) 
-	{
-		x0 = OLED_WIDTH - 1;
-	}
-	
-	if (x1 >= OLED_WIDTH) 
-	{
-		x1 = OLED_WIDTH - 1;
-	}
+	OLED_ClipRect_t *rect;
 	
-	if (y0 >= OLED_HEIGHT) 
+	if (OLED_SSD1306.ClipDepth >= OLED_CLIP_STACK_DEPTH)
 	{
-		y0 = OLED_HEIGHT - 1;
+		/* Return error */
+		return 0;
 	}
 	
-	if (y1 >= OLED_HEIGHT) 
-	{
-		y1 = OLED_HEIGHT - 1;
-	}
+	rect = &OLED_SSD1306.ClipStack[OLED_SSD1306.ClipDepth];
+	rect->X0 = x;
+	rect->Y0 = y;
+	rect->X1 = x + (int16_t)w - 1;
+	rect->Y1 = y + (int16_t)h - 1;
 	
-	 dx = (x0 < x1) ? (x1 - x0) : (x0 - x1); 
-	 dy = (y0 < y1) ? (y1 - y0) : (y0 - y1); 
-	 sx = (x0 < x1) ? 1 : -1; 
-	 sy = (y0 < y1) ? 1 : -1; 
-	 err = ((dx > dy) ? dx : -dy) / 2; 
-
-	if (dx == 0)
+	if (OLED_SSD1306.ClipDepth != 0)
 	{
-		if (y1 < y0)
-		{
-			tmp = y1;
-			y1 = y0;
-			y0 = tmp;
-		}
-		
-		if (x1 < x0)
-		{
-			tmp = x1;
-			x1 = x0;
-			x0 = tmp;
-		}
-		
-		/* Vertical line */
-		for (i = y0; i <= y1; i++)
-		{
-			OLED_SSD1306_DrawPixel(x0, i, color);
-		}
+		/* Intersect with the parent */
+		OLED_ClipRect_t *parent = rect - 1;
 		
-		/* Return from function */
-		return;
+		rect->X0 = (parent->X0 > rect->X0) ? parent->X0 : rect->X0;
+		rect->Y0 = (parent->Y0 > rect->Y0) ? parent->Y0 : rect->Y0;
+		rect->X1 = (parent->X1 < rect->X1) ? parent->X1 : rect->X1;
+		rect->Y1 = (parent->Y1 < rect->Y1) ? parent->Y1 : rect->Y1;
 	}
 	
-	if (dy == 0) 
-	{
-		if (y1 < y0) 
-		{
-			tmp = y1;
-			y1 = y0;
-			y0 = tmp;
-		}
-		
-		if (x1 < x0) 
-		{
-			tmp = x1;
-			x1 = x0;
-			x0 = tmp;
-		}
-		
-		/* Horizontal line */
-		for (i = x0; i <= x1; i++) 
-		{
-			OLED_SSD1306_DrawPixel(i, y0, color);
-		}
-		
-		/* Return from function */
-		return;
-	}
+	OLED_SSD1306.ClipDepth++;
+	OLED_UpdateClip();
 	
-	while (1) 
-	{
-		OLED_SSD1306_DrawPixel(x0, y0, color); 
-			
-		 if (x0 == x1 && y0 == y1) 
-		 {
-			 break;
-		 }
-		 
-		 e2 = err; 
-				
-		 if (e2 > -dx)
-		 {
-			 err -= dy;
-			 x0 += sx;
-		 }
-			
-		 if (e2 < dy)
-		 {
-			 err += dx;
-			 y0 += sy;
-		 }
-   }		
+	return 1;
 }
 
 
 /**
- * @brief  Draws rectangle on OLED
- * @note   @ref OLED_SSD1306_UpdateScreen() must be called after that in order to see updated LCD screen
- * @param  x: Top left X start point. Valid input is 0 to OLED_WIDTH - 1
- * @param  y: Top left Y start point. Valid input is 0 to OLED_HEIGHT - 1
- * @param  w: Rectangle width in units of pixels
- * @param  h: Rectangle height in units of pixels
- * @param  c: Color to be used. This parameter can be a value of @ref OLED_COLOR_t enumeration
+ * @brief  Restores the clip rectangle active before the last @ref OLED_SSD1306_PushClip()
  * @retval None
  */
-void OLED_SSD1306_DrawRectangle(uint16_t x, uint16_t y, uint16_t w, uint16_t h, OLED_COLOR_t c)
+void OLED_SSD1306_PopClip(void)
 {
-	
-	/* Check input parameters */
-	if ( x >= OLED_WIDTH || y >= OLED_HEIGHT ) 
-	{
-		/* Return error */
-		return;
-	}
-	
-	/* Check width and height */
-	if ((x + w) >= OLED_WIDTH)
+	if (OLED_SSD1306.ClipDepth != 0)
 	{
-		w = OLED_WIDTH - x;
+		OLED_SSD1306.ClipDepth--;
 	}
-		
-	if ((y + h) >= OLED_HEIGHT)
-	{
-		h = OLED_HEIGHT - y;
-	}
-	
-	/* Draw 4 lines */
-	OLED_SSD1306_DrawLine(x, y, x + w, y, c);         /* Top line */
-	OLED_SSD1306_DrawLine(x, y + h, x + w, y + h, c); /* Bottom line */
-	OLED_SSD1306_DrawLine(x, y, x, y + h, c);         /* Left line */
-	OLED_SSD1306_DrawLine(x + w, y, x + w, y + h, c); /* Right line */
 	
+	OLED_UpdateClip();
 }
 
 
 /**
- * @brief  Draws filled rectangle on OLED
- * @note   @ref OLED_SSD1306_UpdateScreen() must be called after that in order to see updated LCD screen
- * @param  x: Top left X start point. Valid input is 0 to OLED_WIDTH - 1
- * @param  y: Top left Y start point. Valid input is 0 to OLED_HEIGHT - 1
- * @param  w: Rectangle width in units of pixels
- * @param  h: Rectangle height in units of pixels
- * @param  c: Color to be used. This parameter can be a value of @ref OLED_COLOR_t enumeration
+ * @brief  Selects the canvas all drawing functions render into
+ * @param  *canvas: Canvas to draw into, NULL selects OLED_Buffer (the screen)
  * @retval None
  */
-void OLED_SSD1306_DrawFilledRectangle(uint16_t x, uint16_t y, uint16_t w, uint16_t h, OLED_COLOR_t c)
+void OLED_SSD1306_SetTarget(OLED_Canvas_t* canvas)
 {
-	uint8_t i;
-	
-	/* Check input parameters */
-	if (x >= OLED_WIDTH || y >= OLED_HEIGHT)
-	{
-		/* Return error */
-		return;
-	}
-	
-	/* Check width and height */
-	if ((x + w) >= OLED_WIDTH) {
-		w = OLED_WIDTH - x;
-	}
-	
-	if ((y + h) >= OLED_HEIGHT) {
-		h = OLED_HEIGHT - y;
-	}
+	OLED_SSD1306.Target = (canvas != NULL) ? canvas : &OLED_Screen;
 	
-	/* Draw lines */
-	for (i = 0; i <= h; i++) {
-		/* Draw lines */
-		OLED_SSD1306_DrawLine(x, y + i, x + w, y + i, c);
-	}
+	/* Rotation only applies to the screen, canvases are always drawn as they are */
+	OLED_SSD1306.Transposed = (OLED_SSD1306.Target == &OLED_Screen) && (OLED_SSD1306.Rotation & OLED_ROTATION_90);
+	OLED_SSD1306.Width = OLED_SSD1306.Transposed ? OLED_SSD1306.Target->Height : OLED_SSD1306.Target->Width;
+	OLED_SSD1306.Height = OLED_SSD1306.Transposed ? OLED_SSD1306.Target->Width : OLED_SSD1306.Target->Height;
 	
+	/* The clip stack is kept, only the bounds it is limited to change */
+	OLED_UpdateClip();
 }
 
 
+/**
+ * @brief  Returns the canvas all drawing functions currently render into
+ * @retval Pointer to the current target canvas
+ */
+OLED_Canvas_t* OLED_SSD1306_GetTarget(void)
+{
+	return OLED_SSD1306.Target;
+}
+
 
 /**
- * @brief  Draws triangle on OLED
- * @note   @ref OLED_SSD1306_UpdateScreen() must be called after that in order to see updated LCD screen
- * @param  x1: First coordinate X location. Valid input is 0 to OLED_WIDTH - 1
- * @param  y1: First coordinate Y location. Valid input is 0 to OLED_HEIGHT - 1
- * @param  x2: Second coordinate X location. Valid input is 0 to OLED_WIDTH - 1
- * @param  y2: Second coordinate Y location. Valid input is 0 to OLED_HEIGHT - 1
- * @param  x3: Third coordinate X location. Valid input is 0 to OLED_WIDTH - 1
- * @param  y3: Third coordinate Y location. Valid input is 0 to OLED_HEIGHT - 1
- * @param  c: Color to be used. This parameter can be a value of @ref OLED_COLOR_t enumeration
+ * @brief  Sets the raster operation used by all drawing functions (pixels, lines, shapes, fills and text)
+ * @note   With OR, AND-NOT and XOR only white pixels touch the target. Drawing the same thing twice with
+ *         XOR restores what was underneath, e.g. for cursors and selection bars.
+ *         @ref OLED_SSD1306_DrawFilledTriangle() overdraws pixels and is exact only for COPY, OR and AND-NOT.
+ *         @ref OLED_SSD1306_Blit() takes its raster op as a parameter instead
+ * @param  rop: This parameter can be a value of @ref OLED_ROP_t enumeration
  * @retval None
  */
-void OLED_SSD1306_DrawTriangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t x3, uint16_t y3, OLED_COLOR_t color)
+void OLED_SSD1306_SetRasterOp(OLED_ROP_t rop)
 {
-	/* Draw lines */
-	OLED_SSD1306_DrawLine(x1, y1, x2, y2, color);
-	OLED_SSD1306_DrawLine(x2, y2, x3, y3, color);
-	OLED_SSD1306_DrawLine(x3, y3, x1, y1, color);
+	OLED_SSD1306.RasterOp = rop;
 }
-	
 
 
 /**
- * @brief  Draws filled triangle on OLED
- * @note   @ref OLED_SSD1306_UpdateScreen() must be called after that in order to see updated LCD screen
- * @param  x1: First coordinate X location. Valid input is 0 to OLED_WIDTH - 1
- * @param  y1: First coordinate Y location. Valid input is 0 to OLED_HEIGHT - 1
- * @param  x2: Second coordinate X location. Valid input is 0 to OLED_WIDTH - 1
- * @param  y2: Second coordinate Y location. Valid input is 0 to OLED_HEIGHT - 1
- * @param  x3: Third coordinate X location. Valid input is 0 to OLED_WIDTH - 1
- * @param  y3: Third coordinate Y location. Valid input is 0 to OLED_HEIGHT - 1
- * @param  c: Color to be used. This parameter can be a value of @ref OLED_COLOR_t enumeration
+ * @brief  Returns the raster operation used by all drawing functions
+ * @retval Current raster op, a value of @ref OLED_ROP_t enumeration
+ */
+OLED_ROP_t OLED_SSD1306_GetRasterOp(void)
+{
+	return (OLED_ROP_t)OLED_SSD1306.RasterOp;
+}
+
+
+/**
+ * @brief  Selects whether text paints its background
+ * @note   Opaque text draws the whole character cell, background in the opposite color, with the raster op.
+ *         Transparent text only changes its set pixels, with the operation @ref OLED_SSD1306_DrawPixel() uses for
+ *         the color: white text ORs them in and black text clears them under COPY. Both are byte writes
+ * @param  mode: This parameter can be a value of @ref OLED_TEXT_MODE_t enumeration
  * @retval None
  */
-void OLED_SSD1306_DrawFilledTriangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t x3, uint16_t y3, OLED_COLOR_t color)
+void OLED_SSD1306_SetTextMode(OLED_TEXT_MODE_t mode)
 {
-	int16_t deltax = 0, deltay = 0, x = 0, y = 0, xinc1 = 0, xinc2 = 0, 
-	yinc1 = 0, yinc2 = 0, den = 0, num = 0, numadd = 0, numpixels = 0, 
-	curpixel = 0;
-	
-	deltax = ABS(x2 - x1);
-	deltay = ABS(y2 - y1);
-	x = x1;
-	y = y1;
+	OLED_SSD1306.TextMode = mode;
+}
+
+
+/**
+ * @brief  Returns whether text paints its background
+ * @retval Current text mode, a value of @ref OLED_TEXT_MODE_t enumeration
+ */
+OLED_TEXT_MODE_t OLED_SSD1306_GetTextMode(void)
+{
+	return (OLED_TEXT_MODE_t)OLED_SSD1306.TextMode;
+}
+
+
+/**
+ * @brief  Sets the integer factor text is enlarged by, for big readouts from the existing fonts
+ * @note   Applies to Putc(), PutCodepoint(), Puts(), the number functions and DrawTextBox(). Every glyph bit becomes
+ *         a scale x scale block: each page byte is expanded to scale page bytes through a small lookup table and
+ *         the column repeated, then blitted like an unscaled cell. OLED_FONTS_GetStringSize() still measures
+ *         unscaled text, multiply its result by the scale
+ * @param  scale: 1 (default) to OLED_TEXT_MAX_SCALE, 0 is taken as 1 and larger values as OLED_TEXT_MAX_SCALE
+ * @retval None
+ */
+void OLED_SSD1306_SetTextScale(uint8_t scale)
+{
+	OLED_SSD1306.TextScale = (scale == 0) ? 1 : (scale > OLED_TEXT_MAX_SCALE) ? OLED_TEXT_MAX_SCALE : scale;
+}
+
+
+/**
+ * @brief  Returns the factor text is enlarged by
+ * @retval 1 to OLED_TEXT_MAX_SCALE
+ */
+uint8_t OLED_SSD1306_GetTextScale(void)
+{
+	return OLED_SSD1306.TextScale;
+}
+
+
+/**
+ * @brief  Sets inverse display, done by the controller (0xA7/0xA6) with a single command
+ * @note   The framebuffer and canvases are not touched, white is still drawn as a set bit.
+ *         Takes effect immediately without @ref OLED_SSD1306_UpdateScreen()
+ * @param  inverted: 1 to show set bits dark on a lit background, 0 for normal display
+ * @retval None
+ */
+void OLED_SSD1306_SetInverted(uint8_t inverted)
+{
+	OLED_SSD1306.Inverted = (inverted != 0);
+	
+	if (OLED_SSD1306.Initialized)
+	{
+		OLED_SSD1306_Send_Command(OLED_SSD1306.Inverted ? OLED_SET_INVERSE_DISPLAY : OLED_SET_NORMAL_DISPLAY);
+	}
+}
+
+
+/**
+ * @brief  Returns whether the display is inverted
+ * @retval 1 if inverse display is on, 0 otherwise
+ */
+uint8_t OLED_SSD1306_GetInverted(void)
+{
+	return OLED_SSD1306.Inverted;
+}
+
+
+/**
+ * @brief  Sets the screen rotation
+ * @note   180 degrees is done by the controller (segment re-map and COM scan direction) and costs no CPU time.
+ *         90 and 270 degrees swap x and y in software while drawing into the screen, 270 is 90 plus the
+ *         hardware 180. The segment re-map only applies to data written afterwards, so redraw and call
+ *         @ref OLED_SSD1306_UpdateScreen() after changing the rotation
+ * @param  rotation: This parameter can be a value of @ref OLED_ROTATION_t enumeration
+ * @retval None
+ */
+void OLED_SSD1306_SetRotation(OLED_ROTATION_t rotation)
+{
+	uint8_t flip = (rotation & OLED_ROTATION_180) != (OLED_SSD1306.Rotation & OLED_ROTATION_180);
+	
+	OLED_SSD1306.Rotation = rotation;
+	
+	if (flip && OLED_SSD1306.Initialized)
+	{
+		/* Hardware 180 degrees */
+		OLED_SSD1306_Send_Command((rotation & OLED_ROTATION_180) ? OLED_SET_SEG_REMAP_0_SEG0 : OLED_SET_SEG_REMAP_127_SEG0);
+		OLED_SSD1306_Send_Command((rotation & OLED_ROTATION_180) ? OLED_COM_SCAN_DIR_NORMAL : OLED_COM_SCAN_DIR_REMAPPED);
+	}
+	
+	/* Refresh the drawing size */
+	OLED_SSD1306_SetTarget(OLED_SSD1306.Target);
+}
+
+
+/**
+ * @brief  Returns the screen rotation
+ * @retval Current rotation, a value of @ref OLED_ROTATION_t enumeration
+ */
+OLED_ROTATION_t OLED_SSD1306_GetRotation(void)
+{
+	return (OLED_ROTATION_t)OLED_SSD1306.Rotation;
+}
+
+
+/**
+ * @brief  Returns the width of the current target as seen by the drawing functions
+ * @retval Width in pixels, OLED_HEIGHT for the screen at 90 or 270 degrees
+ */
+uint16_t OLED_SSD1306_GetWidth(void)
+{
+	return OLED_SSD1306.Width;
+}
+
+
+/**
+ * @brief  Returns the height of the current target as seen by the drawing functions
+ * @retval Height in pixels, OLED_WIDTH for the screen at 90 or 270 degrees
+ */
+uint16_t OLED_SSD1306_GetHeight(void)
+{
+	return OLED_SSD1306.Height;
+}
+
+
+/**
+ * @brief  Applies a span operation to one pixel of the current target, no bounds check
+ * @note   x and y are drawing coordinates, swapped here when the screen is rotated by 90 or 270 degrees
+ */
+static void OLED_PutPixel(uint16_t x, uint16_t y, OLED_SpanOp_t op)
+{
+	OLED_Canvas_t *target = OLED_SSD1306.Target;
+	uint16_t tmp;
+	uint8_t *p;
+	uint8_t bit;
+	
+	if (OLED_SSD1306.Transposed)
+	{
+		tmp = x;
+		x = target->Width - 1 - y;
+		y = tmp;
+	}
+	
+	p = &target->Buffer[x + (y / 8) * target->Width];
+	bit = 1 << (y % 8);
+	*p = (*p & OLED_SPAN_AND(op, bit)) ^ OLED_SPAN_XOR(op, bit);
+}
+
+
+/**
+ * @brief  Applies a span operation to one pixel, checking the clip rectangle only when the caller
+ *         could not prove the whole primitive is inside it
+ */
+static void OLED_PlotPixel(int16_t x, int16_t y, OLED_SpanOp_t op, uint8_t inside)
+{
+	if (inside || (x >= OLED_SSD1306.ClipX0 && x <= OLED_SSD1306.ClipX1 &&
+	               y >= OLED_SSD1306.ClipY0 && y <= OLED_SSD1306.ClipY1))
+	{
+		OLED_PutPixel(x, y, op);
+	}
+}
+
+
+/**
+ * @brief  Bits of one page (rows page * 8 .. page * 8 + 7) that lie within rows y0..y1
+ */
+static uint8_t OLED_PageRowMask(int16_t page, int16_t y0, int16_t y1)
+{
+	int16_t top = page * 8;
+	int16_t bottom = top + 7;
+	uint8_t mask = 0xFF;
+	
+	if (top > y1 || bottom < y0)
+	{
+		return 0x00;
+	}
+	
+	if (top < y0)
+	{
+		mask &= (uint8_t)(0xFF << (y0 - top));
+	}
+	
+	if (bottom > y1)
+	{
+		mask &= (uint8_t)(0xFF >> (bottom - y1));
+	}
+	
+	return mask;
+}
+
+
+/**
+ * @brief  Blit page-major pixels into the screen rotated by 90 or 270 degrees, one pixel at a time
+ */
+static void OLED_BlitTransposed(const uint8_t *src, const uint8_t *tmask, uint16_t stride, uint16_t w, uint16_t h,
+                                int16_t x, int16_t y, OLED_ROP_t rop)
+{
+	int16_t sx, sy, dx, dy;
+	uint16_t i;
+	uint8_t bit;
+	OLED_SpanOp_t op = (rop == OLED_ROP_AND_NOT) ? OLED_SPAN_CLEAR : (rop == OLED_ROP_XOR) ? OLED_SPAN_INVERT : OLED_SPAN_SET;
+	
+	for (sy = 0; sy < (int16_t)h; sy++)
+	{
+		dy = y + sy;
+		
+		if (dy < OLED_SSD1306.ClipY0 || dy > OLED_SSD1306.ClipY1)
+		{
+			continue;
+		}
+		
+		for (sx = 0; sx < (int16_t)w; sx++)
+		{
+			dx = x + sx;
+			
+			if (dx < OLED_SSD1306.ClipX0 || dx > OLED_SSD1306.ClipX1)
+			{
+				continue;
+			}
+			
+			i = sx + (sy / 8) * stride;
+			bit = 1 << (sy & 7);
+			
+			if (tmask != NULL && !(tmask[i] & bit))
+			{
+				/* Transparent */
+				continue;
+			}
+			
+			if (src[i] & bit)
+			{
+				OLED_PutPixel(dx, dy, op);
+			}
+			else if (rop == OLED_ROP_COPY)
+			{
+				OLED_PutPixel(dx, dy, OLED_SPAN_CLEAR);
+			}
+		}
+	}
+}
+
+
+/**
+ * @brief  Combines one page row of source bytes into the (up to) two destination page rows it overlaps
+ * @note   A source byte shifted up by 'shift' rows lands partly in dst_lo and partly in dst_hi.
+ *         A mask of zero makes every ROP a no-op, so an out of range row may alias the other one
+ */
+static void OLED_BlitPageRow(uint8_t *dst_lo, uint8_t *dst_hi, const uint8_t *src, uint16_t n,
+                             uint8_t shift, uint8_t mask_lo, uint8_t mask_hi, OLED_ROP_t rop)
+{
+	uint16_t i, w;
+	uint8_t lo, hi;
+
+	switch (rop)
+	{
+		case OLED_ROP_COPY:
+			for (i = 0; i < n; i++)
+			{
+				w = (uint16_t)src[i] << shift;
+				dst_lo[i] = (dst_lo[i] & ~mask_lo) | ((uint8_t)w & mask_lo);
+				dst_hi[i] = (dst_hi[i] & ~mask_hi) | ((uint8_t)(w >> 8) & mask_hi);
+			}
+			break;
+
+		case OLED_ROP_OR:
+			for (i = 0; i < n; i++)
+			{
+				w = (uint16_t)src[i] << shift;
+				dst_lo[i] |= (uint8_t)w & mask_lo;
+				dst_hi[i] |= (uint8_t)(w >> 8) & mask_hi;
+			}
+			break;
+
+		case OLED_ROP_AND_NOT:
+			for (i = 0; i < n; i++)
+			{
+				w = (uint16_t)src[i] << shift;
+				lo = (uint8_t)w & mask_lo;
+				hi = (uint8_t)(w >> 8) & mask_hi;
+				dst_lo[i] &= ~lo;
+				dst_hi[i] &= ~hi;
+			}
+			break;
+
+		case OLED_ROP_XOR:
+			for (i = 0; i < n; i++)
+			{
+				w = (uint16_t)src[i] << shift;
+				dst_lo[i] ^= (uint8_t)w & mask_lo;
+				dst_hi[i] ^= (uint8_t)(w >> 8) & mask_hi;
+			}
+			break;
+	}
+}
+
+
+/**
+ * @brief  Like @ref OLED_BlitPageRow(), only source pixels whose bit is set in tmask are combined
+ */
+static void OLED_BlitPageRowMasked(uint8_t *dst_lo, uint8_t *dst_hi, const uint8_t *src, const uint8_t *tmask, uint16_t n,
+                                   uint8_t shift, uint8_t mask_lo, uint8_t mask_hi, OLED_ROP_t rop)
+{
+	uint16_t i, w, m;
+	uint8_t lo, hi, keep_lo, keep_hi;
+
+	for (i = 0; i < n; i++)
+	{
+		/* Transparent pixels drop out of the source, COPY also leaves them out of the cleared bits */
+		w = (uint16_t)(src[i] & tmask[i]) << shift;
+		m = (uint16_t)tmask[i] << shift;
+		lo = (uint8_t)w & mask_lo;
+		hi = (uint8_t)(w >> 8) & mask_hi;
+
+		switch (rop)
+		{
+			case OLED_ROP_COPY:
+				keep_lo = ~((uint8_t)m & mask_lo);
+				keep_hi = ~((uint8_t)(m >> 8) & mask_hi);
+				dst_lo[i] = (dst_lo[i] & keep_lo) | lo;
+				dst_hi[i] = (dst_hi[i] & keep_hi) | hi;
+				break;
+
+			case OLED_ROP_OR:
+				dst_lo[i] |= lo;
+				dst_hi[i] |= hi;
+				break;
+
+			case OLED_ROP_AND_NOT:
+				dst_lo[i] &= ~lo;
+				dst_hi[i] &= ~hi;
+				break;
+
+			case OLED_ROP_XOR:
+				dst_lo[i] ^= lo;
+				dst_hi[i] ^= hi;
+				break;
+		}
+	}
+}
+
+
+/**
+ * @brief  Combines a block of page-major pixels (and an optional transparency mask) with the current target
+ * @note   src and tmask hold w columns by h rows, one page row every stride bytes. They are only read,
+ *         so they may point straight into flash
+ */
+static void OLED_BlitPages(const uint8_t *src, const uint8_t *tmask, uint16_t stride, uint16_t w, uint16_t h,
+                           int16_t x, int16_t y, OLED_ROP_t rop)
+{
+	OLED_Canvas_t *target = OLED_SSD1306.Target;
+	int16_t src_x0, dst_x0, dst_x1, n, dst_page;
+	uint16_t page, src_pages;
+	uint8_t shift, mask, mask_lo, mask_hi;
+	uint8_t *dst_lo, *dst_hi;
+
+	if (OLED_SSD1306.Transposed)
+	{
+		/* Source rows become screen columns */
+		OLED_BlitTransposed(src, tmask, stride, w, h, x, y, rop);
+		return;
+	}
+
+	/* Clip columns */
+	dst_x0 = (x > OLED_SSD1306.ClipX0) ? x : OLED_SSD1306.ClipX0;
+	dst_x1 = (x + (int16_t)w - 1 < OLED_SSD1306.ClipX1) ? (x + (int16_t)w - 1) : OLED_SSD1306.ClipX1;
+	src_x0 = dst_x0 - x;
+	n = dst_x1 - dst_x0 + 1;
+
+	if (n <= 0 || y > OLED_SSD1306.ClipY1 || y + (int16_t)h - 1 < OLED_SSD1306.ClipY0)
+	{
+		/* Nothing visible */
+		return;
+	}
+
+	/* Row offset within a page, floored so negative y still gives 0..7 */
+	shift = (uint8_t)(y & 7);
+	src_pages = (h + 7) / 8;
+
+	for (page = 0; page < src_pages; page++)
+	{
+		/* Ignore padding rows below the last source row */
+		mask = ((page + 1) * 8 > h) ? (uint8_t)((1 << (h & 7)) - 1) : 0xFF;
+
+		/* Clip rows, pages outside the clip rectangle get an empty mask */
+		dst_page = (int16_t)((y - shift) / 8) + page;
+		mask_lo = (uint8_t)(mask << shift) & OLED_PageRowMask(dst_page, OLED_SSD1306.ClipY0, OLED_SSD1306.ClipY1);
+		mask_hi = (shift != 0) ? ((uint8_t)(mask >> (8 - shift)) & OLED_PageRowMask(dst_page + 1, OLED_SSD1306.ClipY0, OLED_SSD1306.ClipY1)) : 0x00;
+
+		if (mask_lo == 0x00 && mask_hi == 0x00)
+		{
+			continue;
+		}
+
+		dst_lo = (mask_lo != 0x00) ? &target->Buffer[dst_page * target->Width + dst_x0] : NULL;
+		dst_hi = (mask_hi != 0x00) ? &target->Buffer[(dst_page + 1) * target->Width + dst_x0] : NULL;
+
+		if (tmask != NULL)
+		{
+			OLED_BlitPageRowMasked((dst_lo != NULL) ? dst_lo : dst_hi, (dst_hi != NULL) ? dst_hi : dst_lo,
+			                       &src[page * stride + src_x0], &tmask[page * stride + src_x0], n, shift, mask_lo, mask_hi, rop);
+			continue;
+		}
+
+		if (rop == OLED_ROP_COPY && mask_lo == 0xFF && mask_hi == 0x00)
+		{
+			/* Page aligned fast path */
+			memcpy(dst_lo, &src[page * stride + src_x0], n);
+			continue;
+		}
+
+		/* Point an unused row at the used one, its zero mask leaves it untouched */
+		OLED_BlitPageRow((dst_lo != NULL) ? dst_lo : dst_hi, (dst_hi != NULL) ? dst_hi : dst_lo,
+		                 &src[page * stride + src_x0], n, shift, mask_lo, mask_hi, rop);
+	}
+}
+
+
+/**
+ * @brief  Copies a whole canvas into the current target
+ * @note   Page aligned y is a straight byte copy, any other y is shifted and merged a byte at a time.
+ *         The canvas must not be the current target
+ * @param  *canvas: Source canvas
+ * @param  x,y: Top left position in the target, may be negative or partly outside the target
+ * @param  rop: How source pixels are combined with the target. This parameter can be a value of @ref OLED_ROP_t enumeration
+ * @retval None
+ */
+void OLED_SSD1306_Blit(const OLED_Canvas_t* canvas, int16_t x, int16_t y, OLED_ROP_t rop)
+{
+	OLED_BlitPages(canvas->Buffer, NULL, canvas->Width, canvas->Width, canvas->Height, x, y, rop);
+}
+
+
+/**
+ * @brief  Transposes 8 rows of 8 row-major pixels into 8 page bytes, one per column
+ * @note   in[r] is row r with the leftmost pixel in the MSB, out[c] is column c with row 0 in the LSB
+ */
+static void OLED_Transpose8x8(const uint8_t *in, uint8_t *out)
+{
+	uint32_t x, y, t;
+
+	/* Rows loaded bottom up, so the transposed bytes come out with row 0 in the LSB */
+	x = ((uint32_t)in[7] << 24) | ((uint32_t)in[6] << 16) | ((uint32_t)in[5] << 8) | in[4];
+	y = ((uint32_t)in[3] << 24) | ((uint32_t)in[2] << 16) | ((uint32_t)in[1] << 8) | in[0];
+
+	/* Swap 1x1, 2x2 and 4x4 blocks across the diagonal */
+	t = (x ^ (x >> 7)) & 0x00AA00AA;
+	x = x ^ t ^ (t << 7);
+	t = (y ^ (y >> 7)) & 0x00AA00AA;
+	y = y ^ t ^ (t << 7);
+
+	t = (x ^ (x >> 14)) & 0x0000CCCC;
+	x = x ^ t ^ (t << 14);
+	t = (y ^ (y >> 14)) & 0x0000CCCC;
+	y = y ^ t ^ (t << 14);
+
+	t = (x & 0xF0F0F0F0) | ((y >> 4) & 0x0F0F0F0F);
+	y = ((x << 4) & 0xF0F0F0F0) | (y & 0x0F0F0F0F);
+	x = t;
+
+	out[0] = (uint8_t)(x >> 24);
+	out[1] = (uint8_t)(x >> 16);
+	out[2] = (uint8_t)(x >> 8);
+	out[3] = (uint8_t)x;
+	out[4] = (uint8_t)(y >> 24);
+	out[5] = (uint8_t)(y >> 16);
+	out[6] = (uint8_t)(y >> 8);
+	out[7] = (uint8_t)y;
+}
+
+
+/**
+ * @brief  Transposes columns of one 8-row band of a row-major bitmap into page bytes
+ * @note   Columns g0 * 8 .. g0 * 8 + n_groups * 8 - 1, rows band * 8 .. band * 8 + 7 (rows past the bitmap read as 0)
+ */
+static void OLED_BitmapBand(const uint8_t *data, uint16_t row_bytes, uint16_t rows, uint8_t xbm,
+                            uint16_t band, uint16_t g0, uint16_t n_groups, uint8_t *out)
+{
+	uint8_t in[8], col[8];
+	uint16_t g, r, c;
+
+	for (g = 0; g < n_groups; g++)
+	{
+		for (r = 0; r < 8; r++)
+		{
+			in[r] = (band * 8 + r < rows) ? data[(band * 8 + r) * row_bytes + g0 + g] : 0x00;
+		}
+
+		OLED_Transpose8x8(in, col);
+
+		/* XBM keeps the leftmost pixel in the LSB, its columns come out in reverse */
+		for (c = 0; c < 8; c++)
+		{
+			out[g * 8 + c] = xbm ? col[7 - c] : col[c];
+		}
+	}
+}
+
+
+/**
+ * @brief  Decodes a bit-packed character into a page-major cell, FontWidth column bytes per page
+ * @note   Plain glyphs take each column's bytes straight from the bit stream, run-length coded ones OR in their
+ *         set runs a column segment at a time
+ */
+static void OLED_UnpackGlyph(const OLED_FontDef_t *Font, uint16_t glyph, uint8_t *cell)
+{
+	const OLED_FontPacked_t *packed = Font->packed;
+	const uint8_t *src;
+	uint32_t bit;
+	uint16_t pages = (Font->FontHeight + 7) / 8, rows;
+	uint16_t c, r, k, page, left, len, ink = 0, offset;
+	
+	if (packed->Offsets == NULL)
+	{
+		bit = (uint32_t)glyph * Font->FontWidth * Font->FontHeight;
+		src = packed->Bits;
+	}
+	else
+	{
+		offset = packed->Offsets[glyph];
+		bit = 0;
+		src = &packed->Bits[offset & 0x7FFF];
+		
+		if (offset & 0x8000)
+		{
+			memset(cell, 0x00, pages * Font->FontWidth);
+			
+			/* c, r: column and row the next run starts at */
+			for (c = 0, r = 0, k = 0; c < Font->FontWidth; k++, ink ^= 1)
+			{
+				for (left = (src[k >> 1] >> ((k & 1) * 4)) & 0x0F; left != 0; left -= len)
+				{
+					/* Up to the end of the column or of the page byte, whichever comes first */
+					len = 8 - (r & 7);
+					len = (left < len) ? left : len;
+					len = (Font->FontHeight - r < len) ? Font->FontHeight - r : len;
+					
+					if (ink)
+					{
+						cell[(r >> 3) * Font->FontWidth + c] |= (uint8_t)(((1 << len) - 1) << (r & 7));
+					}
+					
+					r += len;
+					
+					if (r == Font->FontHeight)
+					{
+						r = 0;
+						c++;
+					}
+				}
+			}
+			
+			return;
+		}
+	}
+	
+	/* Page byte of column c starts FontHeight * c + 8 * page bits into the glyph */
+	for (c = 0; c < Font->FontWidth; c++, bit += Font->FontHeight)
+	{
+		for (page = 0; page < pages; page++)
+		{
+			rows = (Font->FontHeight - page * 8 < 8) ? Font->FontHeight - page * 8 : 8;
+			k = src[(bit + page * 8) >> 3] >> ((bit + page * 8) & 7);
+			
+			if (((bit + page * 8) & 7) + rows > 8)
+			{
+				k |= src[((bit + page * 8) >> 3) + 1] << (8 - ((bit + page * 8) & 7));
+			}
+			
+			cell[page * Font->FontWidth + c] = (uint8_t)(k & ((1 << rows) - 1));
+		}
+	}
+}
+
+
+/**
+ * @brief  Returns one page of a character cell, FontWidth column bytes
+ * @note   Pre-transposed glyphs are returned in place, fonts with row data only are transposed into col
+ */
+static const uint8_t* OLED_GlyphPage(const OLED_FontDef_t *Font, uint16_t glyph, uint16_t page, uint8_t *col)
+{
+	const uint16_t *rows;
+	uint8_t in[8], out[8];
+	uint16_t g, r, c;
+
+	if (Font->glyphs != NULL)
+	{
+		return &Font->glyphs[((glyph * ((Font->FontHeight + 7) / 8)) + page) * Font->FontWidth];
+	}
+
+	rows = &Font->data[glyph * Font->FontHeight];
+
+	for (g = 0; g * 8 < Font->FontWidth; g++)
+	{
+		/* Leftmost pixel in bit 15, the high byte holds columns 0 to 7 */
+		for (r = 0; r < 8; r++)
+		{
+			in[r] = (page * 8 + r < Font->FontHeight) ? (uint8_t)(rows[page * 8 + r] >> (8 - g * 8)) : 0x00;
+		}
+		
+		OLED_Transpose8x8(in, out);
+		
+		for (c = 0; c < 8 && g * 8 + c < Font->FontWidth; c++)
+		{
+			col[g * 8 + c] = out[c];
+		}
+	}
+
+	return col;
+}
+
+
+/* Read position in a PackBits stream, so a bitmap can be unpacked a chunk at a time */
+typedef struct {
+	const uint8_t *Data;  /* Next control or data byte */
+	uint8_t Count;        /* Bytes left in the current run */
+	uint8_t Repeat;       /* Current run repeats Value, otherwise it is literal */
+	uint8_t Value;
+} OLED_RleStream_t;
+
+
+/**
+ * @brief  Unpacks the next n bytes of a PackBits stream
+ * @note   Control byte c: 0..127 is followed by c + 1 literal bytes, -1..-127 by one byte repeated 1 - c times,
+ *         -128 is skipped
+ */
+static void OLED_RleRead(OLED_RleStream_t *rle, uint8_t *out, uint16_t n)
+{
+	uint16_t k;
+	int8_t c;
+
+	while (n > 0)
+	{
+		if (rle->Count == 0)
+		{
+			c = (int8_t)*rle->Data++;
+
+			if (c >= 0)
+			{
+				rle->Count = c + 1;
+				rle->Repeat = 0;
+			}
+			else if (c != -128)
+			{
+				rle->Count = 1 - c;
+				rle->Repeat = 1;
+				rle->Value = *rle->Data++;
+			}
+
+			continue;
+		}
+
+		k = (n < rle->Count) ? n : rle->Count;
+
+		if (rle->Repeat)
+		{
+			memset(out, rle->Value, k);
+		}
+		else
+		{
+			memcpy(out, rle->Data, k);
+			rle->Data += k;
+		}
+
+		out += k;
+		n -= k;
+		rle->Count -= k;
+	}
+}
+
+
+/**
+ * @brief  Draws a PackBits compressed page-major bitmap, unpacked OLED_BITMAP_CHUNK columns at a time
+ */
+static void OLED_DrawBitmapRle(int16_t x, int16_t y, const OLED_Bitmap_t* bitmap, OLED_ROP_t rop)
+{
+	uint8_t data[OLED_BITMAP_CHUNK];
+	uint8_t mask[OLED_BITMAP_CHUNK];
+	OLED_RleStream_t data_rle = { bitmap->Data, 0, 0, 0 };
+	OLED_RleStream_t mask_rle = { bitmap->Mask, 0, 0, 0 };
+	uint16_t page, pages = (bitmap->Height + 7) / 8;
+	uint16_t col, n;
+
+	for (page = 0; page < pages; page++)
+	{
+		/* The stream can only be read in order, stop after the last visible page */
+		if (!OLED_SSD1306.Transposed && y + (int16_t)(page * 8) > OLED_SSD1306.ClipY1)
+		{
+			break;
+		}
+
+		for (col = 0; col < bitmap->Width; col += n)
+		{
+			n = (bitmap->Width - col < OLED_BITMAP_CHUNK) ? bitmap->Width - col : OLED_BITMAP_CHUNK;
+
+			OLED_RleRead(&data_rle, data, n);
+
+			if (bitmap->Mask != NULL)
+			{
+				OLED_RleRead(&mask_rle, mask, n);
+			}
+
+			OLED_BlitPages(data, (bitmap->Mask != NULL) ? mask : NULL, OLED_BITMAP_CHUNK, n,
+			               (page * 8 + 8 > bitmap->Height) ? bitmap->Height - page * 8 : 8,
+			               x + col, y + page * 8, rop);
+		}
+	}
+}
+
+
+/**
+ * @brief  Decodes an LZ stream into w x pages bytes of a page-major buffer with the given row stride
+ * @note   Control byte c: 0x00..0x7F is followed by c + 1 literal bytes, 0x80..0xBF by one byte repeated
+ *         (c & 0x3F) + 2 times, 0xC0..0xFF copies ((c >> 2) & 0x0F) + 3 bytes from ((c & 3) << 8 | next) + 1 bytes
+ *         back in bitmap order. Back references are read from the buffer itself, so no history is kept
+ */
+static void OLED_LzUnpack(const uint8_t *src, uint8_t *dst, uint16_t stride, uint16_t w, uint16_t pages)
+{
+	uint16_t left = w * pages, col = 0, len, k, at, from, from_col;
+	const uint8_t *ref;
+	uint8_t c, v = 0;
+
+	while (left > 0)
+	{
+		c = *src++;
+
+		if (c < 0x80)
+		{
+			len = c + 1;
+		}
+		else if (c < 0xC0)
+		{
+			len = (c & 0x3F) + 2;
+			v = *src++;
+		}
+		else
+		{
+			len = ((c >> 2) & 0x0F) + 3;
+			at = w * pages - left;
+			from = at - ((((c & 0x03) << 8) | *src++) + 1);
+			from_col = from % w;
+			ref = dst - (int32_t)(at / w - from / w) * stride + from_col;
+
+			/* Byte by byte, the reference may overlap the bytes being written */
+			for (k = 0; k < len && left > 0; k++, left--)
+			{
+				dst[col] = *ref++;
+
+				if (++from_col == w)
+				{
+					from_col = 0;
+					ref += stride - w;
+				}
+
+				if (++col == w)
+				{
+					col = 0;
+					dst += stride;
+				}
+			}
+
+			continue;
+		}
+
+		/* Literal and fill runs, split at the end of each page row */
+		while (len > 0 && left > 0)
+		{
+			k = (len < w - col) ? len : w - col;
+
+			if (c < 0x80)
+			{
+				memcpy(&dst[col], src, k);
+				src += k;
+			}
+			else
+			{
+				memset(&dst[col], v, k);
+			}
+
+			len -= k;
+			left -= k;
+			col += k;
+
+			if (col == w)
+			{
+				col = 0;
+				dst += stride;
+			}
+		}
+	}
+}
+
+
+/* Read position in an LZ stream, so a bitmap can be decoded a chunk at a time like PackBits */
+typedef struct {
+	const uint8_t *Data;  /* Next control or data byte */
+	uint8_t *History;     /* Last OLED_LZ_WINDOW decoded bytes, indexed by position */
+	uint16_t Pos;         /* Decoded bytes so far, only used modulo OLED_LZ_WINDOW */
+	uint16_t Back;        /* Distance of the current back reference */
+	uint8_t Count;        /* Bytes left in the current token */
+	uint8_t Control;      /* Control byte of the current token */
+	uint8_t Value;        /* Byte of the current fill */
+} OLED_LzStream_t;
+
+
+/**
+ * @brief  Decodes the next n bytes of an LZ stream, see @ref OLED_LzUnpack() for the control bytes
+ * @note   Back references are read from the stream's history instead of the target, so the bytes can be
+ *         drawn anywhere with any raster op
+ */
+static void OLED_LzRead(OLED_LzStream_t *lz, uint8_t *out, uint16_t n)
+{
+	uint8_t c, v;
+
+	while (n > 0)
+	{
+		if (lz->Count == 0)
+		{
+			c = *lz->Data++;
+			lz->Control = c;
+
+			if (c < 0x80)
+			{
+				lz->Count = c + 1;
+			}
+			else if (c < 0xC0)
+			{
+				lz->Count = (c & 0x3F) + 2;
+				lz->Value = *lz->Data++;
+			}
+			else
+			{
+				lz->Count = ((c >> 2) & 0x0F) + 3;
+				lz->Back = (((c & 0x03) << 8) | *lz->Data++) + 1;
+			}
+
+			continue;
+		}
+
+		if (lz->Control < 0x80)
+		{
+			v = *lz->Data++;
+		}
+		else if (lz->Control < 0xC0)
+		{
+			v = lz->Value;
+		}
+		else
+		{
+			v = lz->History[(uint16_t)(lz->Pos - lz->Back) & (OLED_LZ_WINDOW - 1)];
+		}
+
+		lz->History[lz->Pos & (OLED_LZ_WINDOW - 1)] = v;
+		lz->Pos++;
+		lz->Count--;
+		*out++ = v;
+		n--;
+	}
+}
+
+
+/**
+ * @brief  Draws an LZ compressed page-major bitmap, decoded OLED_BITMAP_CHUNK columns at a time
+ * @note   Page aligned copies that fit the clip rectangle are decoded in place by @ref OLED_SSD1306_UnpackBitmap(),
+ *         which writes whole pages, so only bitmaps a whole number of pages high. Everything else goes through
+ *         OLED_LzHistory and @ref OLED_BlitPages() like PackBits bitmaps
+ */
+static void OLED_DrawBitmapLz(int16_t x, int16_t y, const OLED_Bitmap_t* bitmap, OLED_ROP_t rop)
+{
+	uint8_t data[OLED_BITMAP_CHUNK];
+	uint8_t mask[OLED_BITMAP_CHUNK];
+	OLED_LzStream_t data_lz = { bitmap->Data, OLED_LzHistory[0], 0, 0, 0, 0, 0 };
+	OLED_LzStream_t mask_lz = { bitmap->Mask, OLED_LzHistory[1], 0, 0, 0, 0, 0 };
+	uint16_t page, pages = (bitmap->Height + 7) / 8;
+	uint16_t col, n;
+
+	if (rop == OLED_ROP_COPY && bitmap->Mask == NULL && !OLED_SSD1306.Transposed && (y & 7) == 0 &&
+	    (bitmap->Height & 7) == 0 && x >= OLED_SSD1306.ClipX0 && y >= OLED_SSD1306.ClipY0 &&
+	    x + (int16_t)bitmap->Width - 1 <= OLED_SSD1306.ClipX1 && y + (int16_t)bitmap->Height - 1 <= OLED_SSD1306.ClipY1 &&
+	    OLED_SSD1306_UnpackBitmap(x, y / 8, bitmap))
+	{
+		return;
+	}
+
+	for (page = 0; page < pages; page++)
+	{
+		/* The stream can only be read in order, stop after the last visible page */
+		if (!OLED_SSD1306.Transposed && y + (int16_t)(page * 8) > OLED_SSD1306.ClipY1)
+		{
+			break;
+		}
+
+		for (col = 0; col < bitmap->Width; col += n)
+		{
+			n = (bitmap->Width - col < OLED_BITMAP_CHUNK) ? bitmap->Width - col : OLED_BITMAP_CHUNK;
+
+			OLED_LzRead(&data_lz, data, n);
+
+			if (bitmap->Mask != NULL)
+			{
+				OLED_LzRead(&mask_lz, mask, n);
+			}
+
+			OLED_BlitPages(data, (bitmap->Mask != NULL) ? mask : NULL, OLED_BITMAP_CHUNK, n,
+			               (page * 8 + 8 > bitmap->Height) ? bitmap->Height - page * 8 : 8,
+			               x + col, y + page * 8, rop);
+		}
+	}
+}
+
+
+/**
+ * @brief  Draws a 1 bit per pixel bitmap into the current target
+ * @note   Page-major bitmaps go through the same byte copy / shift and merge as @ref OLED_SSD1306_Blit().
+ *         Row-major and XBM bitmaps are transposed 8x8 pixels at a time, only the visible part.
+ *         Compressed bitmaps are unpacked OLED_BITMAP_CHUNK columns at a time on the stack, LZ bitmaps
+ *         with their back references kept in 1 KB of RAM per stream.
+ *         Data and mask are read where they are, const arrays stay in flash.
+ *         @ref OLED_SSD1306_UpdateScreen() must be called after that in order to see updated LCD screen
+ * @param  x,y: Top left position in the target, may be negative or partly outside the target
+ * @param  *bitmap: Bitmap to draw, see @ref OLED_Bitmap_t
+ * @param  rop: How set pixels are combined with the target. This parameter can be a value of @ref OLED_ROP_t enumeration
+ * @retval None
+ */
+void OLED_SSD1306_DrawBitmap(int16_t x, int16_t y, const OLED_Bitmap_t* bitmap, OLED_ROP_t rop)
+{
+	uint8_t data[OLED_BITMAP_CHUNK];
+	uint8_t mask[OLED_BITMAP_CHUNK];
+	uint16_t row_bytes = (bitmap->Width + 7) / 8;
+	uint16_t band, bands, g, g_end, n_groups, w;
+	int16_t sx0, sx1, sy0, sy1;
+	uint8_t xbm = (bitmap->Format == OLED_BITMAP_XBM);
+
+	if (bitmap->Format == OLED_BITMAP_PAGE_MAJOR)
+	{
+		OLED_BlitPages(bitmap->Data, bitmap->Mask, bitmap->Width, bitmap->Width, bitmap->Height, x, y, rop);
+		return;
+	}
+
+	if (bitmap->Format == OLED_BITMAP_PAGE_MAJOR_RLE)
+	{
+		OLED_DrawBitmapRle(x, y, bitmap, rop);
+		return;
+	}
+
+	if (bitmap->Format == OLED_BITMAP_PAGE_MAJOR_LZ)
+	{
+		OLED_DrawBitmapLz(x, y, bitmap, rop);
+		return;
+	}
+
+	/* Visible source rectangle, in drawing coordinates of the target when not rotated */
+	if (OLED_SSD1306.Transposed)
+	{
+		sx0 = 0;
+		sy0 = 0;
+		sx1 = bitmap->Width - 1;
+		sy1 = bitmap->Height - 1;
+	}
+	else
+	{
+		sx0 = (OLED_SSD1306.ClipX0 > x) ? OLED_SSD1306.ClipX0 - x : 0;
+		sy0 = (OLED_SSD1306.ClipY0 > y) ? OLED_SSD1306.ClipY0 - y : 0;
+		sx1 = (OLED_SSD1306.ClipX1 - x < (int16_t)bitmap->Width - 1) ? OLED_SSD1306.ClipX1 - x : (int16_t)bitmap->Width - 1;
+		sy1 = (OLED_SSD1306.ClipY1 - y < (int16_t)bitmap->Height - 1) ? OLED_SSD1306.ClipY1 - y : (int16_t)bitmap->Height - 1;
+	}
+
+	if (sx0 > sx1 || sy0 > sy1)
+	{
+		/* Nothing visible */
+		return;
+	}
+
+	bands = sy1 / 8 + 1;
+
+	for (band = sy0 / 8; band < bands; band++)
+	{
+		for (g = sx0 / 8; g <= sx1 / 8; g = g_end)
+		{
+			/* Up to OLED_BITMAP_CHUNK columns per pass */
+			g_end = g + OLED_BITMAP_CHUNK / 8;
+			if (g_end > sx1 / 8 + 1)
+			{
+				g_end = sx1 / 8 + 1;
+			}
+			n_groups = g_end - g;
+
+			OLED_BitmapBand(bitmap->Data, row_bytes, bitmap->Height, xbm, band, g, n_groups, data);
+
+			if (bitmap->Mask != NULL)
+			{
+				OLED_BitmapBand(bitmap->Mask, row_bytes, bitmap->Height, xbm, band, g, n_groups, mask);
+			}
+
+			/* Padding columns past the bitmap width are left out */
+			w = (g_end * 8 > bitmap->Width) ? bitmap->Width - g * 8 : n_groups * 8;
+
+			OLED_BlitPages(data, (bitmap->Mask != NULL) ? mask : NULL, OLED_BITMAP_CHUNK, w,
+			               (band * 8 + 8 > bitmap->Height) ? bitmap->Height - band * 8 : 8,
+			               x + g * 8, y + band * 8, rop);
+		}
+	}
+}
+
+
+/**
+ * @brief  Decodes a page-major bitmap straight into a page aligned window of the current target
+ * @note   No intermediate buffer: PackBits runs and LZ back references are written and read in the target itself.
+ *         The bitmap replaces the window, rotation, clip rectangle, raster op and mask do not apply.
+ *         @ref OLED_SSD1306_DrawBitmap() applies all of them
+ * @param  x: Left column of the window in the target buffer
+ * @param  page: Top page of the window in the target buffer
+ * @param  *bitmap: OLED_BITMAP_PAGE_MAJOR, OLED_BITMAP_PAGE_MAJOR_RLE or OLED_BITMAP_PAGE_MAJOR_LZ bitmap
+ * @retval 1 on success, 0 if the format is not page-major or the bitmap does not fit the target at x, page
+ */
+uint8_t OLED_SSD1306_UnpackBitmap(uint16_t x, uint16_t page, const OLED_Bitmap_t* bitmap)
+{
+	OLED_Canvas_t *target = OLED_SSD1306.Target;
+	OLED_RleStream_t rle = { bitmap->Data, 0, 0, 0 };
+	uint16_t pages = (bitmap->Height + 7) / 8;
+	uint8_t *dst = &target->Buffer[x + page * target->Width];
+	uint16_t p;
+
+	if (x + bitmap->Width > target->Width || page + pages > (target->Height + 7) / 8)
+	{
+		return 0;
+	}
+
+	switch (bitmap->Format)
+	{
+		case OLED_BITMAP_PAGE_MAJOR:
+			for (p = 0; p < pages; p++)
+			{
+				memcpy(&dst[p * target->Width], &bitmap->Data[p * bitmap->Width], bitmap->Width);
+			}
+			break;
+
+		case OLED_BITMAP_PAGE_MAJOR_RLE:
+			for (p = 0; p < pages; p++)
+			{
+				OLED_RleRead(&rle, &dst[p * target->Width], bitmap->Width);
+			}
+			break;
+
+		case OLED_BITMAP_PAGE_MAJOR_LZ:
+			OLED_LzUnpack(bitmap->Data, dst, target->Width, bitmap->Width, pages);
+			break;
+
+		default:
+			return 0;
+	}
+
+	return 1;
+}
+
+
+/**
+ * @brief  Applies dst = (dst & and_mask) ^ xor_mask to n consecutive bytes of one page row
+ * @note   Unaligned head and tail bytes are done one at a time, the interior four columns per 32-bit store
+ */
+static void OLED_FillPageSpan(uint8_t *p, uint16_t n, uint8_t and_mask, uint8_t xor_mask)
+{
+	uint32_t and32, xor32;
+	uint32_t *w;
+	
+	/* Leading bytes up to a word boundary */
+	while (n != 0 && ((uintptr_t)p & 0x03) != 0)
+	{
+		*p = (*p & and_mask) ^ xor_mask;
+		p++;
+		n--;
+	}
+	
+	/* Word interior */
+	and32 = and_mask * 0x01010101UL;
+	xor32 = xor_mask * 0x01010101UL;
+	w = (uint32_t *)p;
+	
+	for (; n >= 4; n -= 4)
+	{
+		*w = (*w & and32) ^ xor32;
+		w++;
+	}
+	
+	/* Trailing bytes */
+	p = (uint8_t *)w;
+	
+	while (n != 0)
+	{
+		*p = (*p & and_mask) ^ xor_mask;
+		p++;
+		n--;
+	}
+}
+
+
+/**
+ * @brief  Resolves a drawing color and the current raster op into the span operation applied to the target
+ * @note   Black under OR, AND-NOT and XOR leaves the target untouched (OLED_SPAN_NONE)
+ */
+static OLED_SpanOp_t OLED_SpanOp(OLED_COLOR_t color)
+{
+	switch (OLED_SSD1306.RasterOp)
+	{
+		case OLED_ROP_OR:
+			return (color == OLED_COLOR_WHITE) ? OLED_SPAN_SET : OLED_SPAN_NONE;
+		
+		case OLED_ROP_AND_NOT:
+			return (color == OLED_COLOR_WHITE) ? OLED_SPAN_CLEAR : OLED_SPAN_NONE;
+		
+		case OLED_ROP_XOR:
+			return (color == OLED_COLOR_WHITE) ? OLED_SPAN_INVERT : OLED_SPAN_NONE;
+		
+		default:
+			return (color == OLED_COLOR_WHITE) ? OLED_SPAN_SET : OLED_SPAN_CLEAR;
+	}
+}
+
+
+/**
+ * @brief  Fills the rectangle x0..x1, y0..y1 (inclusive) of the current target, clipped to the target
+ * @note   Each page the rectangle touches is one masked span, so a full screen fill is 8 span calls
+ */
+static void OLED_FillRect(int16_t x0, int16_t y0, int16_t x1, int16_t y1, OLED_SpanOp_t op)
+{
+	OLED_Canvas_t *target = OLED_SSD1306.Target;
+	uint16_t page, last_page, n;
+	int16_t tmp;
+	uint8_t mask;
+	
+	if (op == OLED_SPAN_NONE)
+	{
+		/* Black under OR, AND-NOT or XOR */
+		return;
+	}
+	
+	/* Clip once, the span loop below writes whole bytes without further checks */
+	if (x0 < OLED_SSD1306.ClipX0)
+	{
+		x0 = OLED_SSD1306.ClipX0;
+	}
+	
+	if (y0 < OLED_SSD1306.ClipY0)
+	{
+		y0 = OLED_SSD1306.ClipY0;
+	}
+	
+	if (x1 > OLED_SSD1306.ClipX1)
+	{
+		x1 = OLED_SSD1306.ClipX1;
+	}
+	
+	if (y1 > OLED_SSD1306.ClipY1)
+	{
+		y1 = OLED_SSD1306.ClipY1;
+	}
+	
+	if (x0 > x1 || y0 > y1)
+	{
+		/* Nothing visible */
+		return;
+	}
+	
+	if (OLED_SSD1306.Transposed)
+	{
+		/* A rotated rectangle is still a rectangle: drawing x runs down the page rows, drawing y right to left */
+		tmp = x0;
+		x0 = target->Width - 1 - y1;
+		y1 = x1;
+		x1 = target->Width - 1 - y0;
+		y0 = tmp;
+	}
+	
+	n = x1 - x0 + 1;
+	last_page = y1 / 8;
+	
+	for (page = y0 / 8; page <= last_page; page++)
+	{
+		/* Leading (top) and trailing (bottom) rows within the page */
+		mask = OLED_PageRowMask(page, y0, y1);
+		
+		OLED_FillPageSpan(&target->Buffer[page * target->Width + x0], n, OLED_SPAN_AND(op, mask), OLED_SPAN_XOR(op, mask));
+	}
+}
+
+
+/**
+ * @brief  Region code of a point for Cohen-Sutherland line clipping
+ */
+static uint8_t OLED_ClipCode(int32_t x, int32_t y)
+{
+	uint8_t code = 0;
+	
+	if (x < OLED_SSD1306.ClipX0)
+	{
+		code |= OLED_CLIP_LEFT;
+	}
+	else if (x > OLED_SSD1306.ClipX1)
+	{
+		code |= OLED_CLIP_RIGHT;
+	}
+	
+	if (y < OLED_SSD1306.ClipY0)
+	{
+		code |= OLED_CLIP_TOP;
+	}
+	else if (y > OLED_SSD1306.ClipY1)
+	{
+		code |= OLED_CLIP_BOTTOM;
+	}
+	
+	return code;
+}
+
+
+/**
+ * @brief  a * b / c rounded to the nearest integer, keeps clipped endpoints on the original line
+ */
+static int32_t OLED_MulDivRound(int32_t a, int32_t b, int32_t c)
+{
+	/* Deltas of int16_t endpoints reach 65535, their product does not fit 32 bits */
+	int64_t n = (int64_t)a * b;
+	
+	if (c < 0)
+	{
+		n = -n;
+		c = -c;
+	}
+	
+	return (int32_t)((n >= 0) ? (n + c / 2) / c : -((-n + c / 2) / c));
+}
+
+
+/**
+ * @brief  Cohen-Sutherland line clipping against the clip rectangle
+ * @note   Endpoints are moved along the line onto the clip edges, so the slope is kept
+ * @retval 1 when some part of the line is visible, 0 otherwise
+ */
+static uint8_t OLED_ClipLine(int32_t *x0, int32_t *y0, int32_t *x1, int32_t *y1)
+{
+	uint8_t code0 = OLED_ClipCode(*x0, *y0);
+	uint8_t code1 = OLED_ClipCode(*x1, *y1);
+	uint8_t code;
+	int32_t x, y;
+	
+	while (code0 | code1)
+	{
+		if (code0 & code1)
+		{
+			/* Both ends outside on the same side */
+			return 0;
+		}
+		
+		code = (code0 != 0) ? code0 : code1;
+		
+		if (code & OLED_CLIP_TOP)
+		{
+			x = *x0 + OLED_MulDivRound(*x1 - *x0, OLED_SSD1306.ClipY0 - *y0, *y1 - *y0);
+			y = OLED_SSD1306.ClipY0;
+		}
+		else if (code & OLED_CLIP_BOTTOM)
+		{
+			x = *x0 + OLED_MulDivRound(*x1 - *x0, OLED_SSD1306.ClipY1 - *y0, *y1 - *y0);
+			y = OLED_SSD1306.ClipY1;
+		}
+		else if (code & OLED_CLIP_LEFT)
+		{
+			y = *y0 + OLED_MulDivRound(*y1 - *y0, OLED_SSD1306.ClipX0 - *x0, *x1 - *x0);
+			x = OLED_SSD1306.ClipX0;
+		}
+		else
+		{
+			y = *y0 + OLED_MulDivRound(*y1 - *y0, OLED_SSD1306.ClipX1 - *x0, *x1 - *x0);
+			x = OLED_SSD1306.ClipX1;
+		}
+		
+		if (code == code0)
+		{
+			*x0 = x;
+			*y0 = y;
+			code0 = OLED_ClipCode(x, y);
+		}
+		else
+		{
+			*x1 = x;
+			*y1 = y;
+			code1 = OLED_ClipCode(x, y);
+		}
+	}
+	
+	return 1;
+}
+
+
+/**
+ * @brief  Draw Pixel
+ * @param  x,y: pixel cordinates
+ * @param  color: colour value
+ * @retval None
+ */
+void OLED_SSD1306_DrawPixel(uint16_t x, uint16_t y, OLED_COLOR_t color)
+{
+	if ((int16_t)x < OLED_SSD1306.ClipX0 || (int16_t)x > OLED_SSD1306.ClipX1 ||
+	    (int16_t)y < OLED_SSD1306.ClipY0 || (int16_t)y > OLED_SSD1306.ClipY1)
+	{
+		/*error*/
+		return;
+	}
+	
+	/* set color */
+	OLED_PutPixel(x, y, OLED_SpanOp(color));
+	
+}
+	
+
+
+/**
+ * @brief  Go to the location (x,y)
+ * @param  x,y: pixel cordinates
+ * @retval None
+ */
+void OLED_SSD1306_GotoXY(uint16_t x, uint16_t y)
+{
+	/* Set the write position */
+	OLED_SSD1306.CurrentX = x;
+	OLED_SSD1306.CurrentY = y;
+}
+
+
+
+/**
+ * @brief  Raster op a text cell is blitted with and whether its glyph bits are inverted first
+ * @note   Opaque black text inverts the cell, so its background is the set source bits. Transparent text blits
+ *         the glyph bits alone with the span operation of its color as OR, AND-NOT or XOR
+ * @retval A value of @ref OLED_ROP_t enumeration, OLED_TEXT_ROP_NONE when nothing would change
+ */
+static uint8_t OLED_TextRop(OLED_COLOR_t color, uint8_t *invert)
+{
+	*invert = (OLED_SSD1306.TextMode == OLED_TEXT_OPAQUE && color != OLED_COLOR_WHITE);
+	
+	if (OLED_SSD1306.TextMode == OLED_TEXT_OPAQUE)
+	{
+		return OLED_SSD1306.RasterOp;
+	}
+	
+	switch (OLED_SpanOp(color))
+	{
+		case OLED_SPAN_SET:
+			return OLED_ROP_OR;
+		
+		case OLED_SPAN_CLEAR:
+			return OLED_ROP_AND_NOT;
+		
+		case OLED_SPAN_INVERT:
+			return OLED_ROP_XOR;
+		
+		default:
+			return OLED_TEXT_ROP_NONE;
+	}
+}
+
+
+/* Bits of a nibble repeated 2, 3 and 4 times, the LSB (top row) first */
+static const uint8_t OLED_TextScale2[16] = {
+	0x00, 0x03, 0x0C, 0x0F, 0x30, 0x33, 0x3C, 0x3F, 0xC0, 0xC3, 0xCC, 0xCF, 0xF0, 0xF3, 0xFC, 0xFF
+};
+
+static const uint16_t OLED_TextScale3[16] = {
+	0x000, 0x007, 0x038, 0x03F, 0x1C0, 0x1C7, 0x1F8, 0x1FF, 0xE00, 0xE07, 0xE38, 0xE3F, 0xFC0, 0xFC7, 0xFF8, 0xFFF
+};
+
+static const uint16_t OLED_TextScale4[16] = {
+	0x0000, 0x000F, 0x00F0, 0x00FF, 0x0F00, 0x0F0F, 0x0FF0, 0x0FFF,
+	0xF000, 0xF00F, 0xF0F0, 0xF0FF, 0xFF00, 0xFF0F, 0xFFF0, 0xFFFF
+};
+
+
+/**
+ * @brief  Blits one page band of a text cell enlarged by the text scale
+ * @note   A source byte (8 rows of a column) becomes scale bytes, one per destination page, and is written to scale
+ *         columns. Up to OLED_BITMAP_CHUNK destination columns are expanded into a buffer on the stack and
+ *         written with one OLED_BlitPages() each
+ * @param  *src: Page-major source, one band of w bytes
+ * @param  h: Source rows in the band, 1 to 8
+ * @param  x,y: Top left corner on the target of the enlarged band
+ */
+static void OLED_BlitScaled(const uint8_t *src, uint16_t w, uint16_t h, int16_t x, int16_t y, OLED_ROP_t rop)
+{
+	uint8_t buf[OLED_TEXT_MAX_SCALE][OLED_BITMAP_CHUNK];
+	uint8_t scale = OLED_SSD1306.TextScale, k, r;
+	uint16_t c, c0, n, out;
+	uint32_t bits;
+	
+	for (c0 = 0; c0 < w; c0 += n)
+	{
+		n = (w - c0 < OLED_BITMAP_CHUNK / scale) ? w - c0 : OLED_BITMAP_CHUNK / scale;
+		
+		for (c = 0, out = 0; c < n; c++)
+		{
+			if (scale == 2)
+			{
+				bits = OLED_TextScale2[src[c0 + c] & 0x0F] | ((uint32_t)OLED_TextScale2[src[c0 + c] >> 4] << 8);
+			}
+			else if (scale == 3)
+			{
+				bits = OLED_TextScale3[src[c0 + c] & 0x0F] | ((uint32_t)OLED_TextScale3[src[c0 + c] >> 4] << 12);
+			}
+			else
+			{
+				bits = OLED_TextScale4[src[c0 + c] & 0x0F] | ((uint32_t)OLED_TextScale4[src[c0 + c] >> 4] << 16);
+			}
+			
+			for (r = 0; r < scale; r++, out++)
+			{
+				for (k = 0; k < scale; k++)
+				{
+					buf[k][out] = (uint8_t)(bits >> (k * 8));
+				}
+			}
+		}
+		
+		OLED_BlitPages(&buf[0][0], NULL, OLED_BITMAP_CHUNK, out, h * scale, x + c0 * scale, y, rop);
+	}
+}
+
+
+/**
+ * @brief  Draws proportional characters from the current position and advances it, like Puts() does
+ * @note   The run box spans the advances (and any ink reaching past them) over the line height. Its pixels are
+ *         gathered a page band and OLED_BITMAP_CHUNK columns at a time, the ink of every glyph touching them ORed
+ *         in, and written with one blit each. Every pixel is drawn once with the same operation a fixed width
+ *         cell uses, so bearings and kerning never cut into the neighbouring characters
+ * @param  *str: UTF-8 string
+ * @param  *end: Where the run stops, NULL for the terminating zero. The last character is not kerned
+ * @retval The first character not drawn, the one starting at or past the right edge or end
+ */
+static const char* OLED_PutRun(const char *str, const char *end, const OLED_FontDef_t *Font, OLED_COLOR_t color)
+{
+	const OLED_FontGlyph_t *glyph;
+	const uint8_t *src;
+	const char *p = str, *stop = str, *q;
+	uint8_t buf[OLED_BITMAP_CHUNK];
+	int32_t pen = 0, next = 0, x0 = 0, x1 = 0, left, c0, c, c_end, col, shift;
+	uint32_t ch, following;
+	uint16_t k, page, gp, w, rows;
+	uint8_t rop, invert, scale = OLED_SSD1306.TextScale;
+	
+	rop = OLED_TextRop(color, &invert);
+	
+	/* Characters starting left of the right edge, and the box they cover */
+	for (ch = (p != end) ? OLED_NEXT_CHAR(&p) : 0; ch != 0 && OLED_SSD1306.CurrentY < OLED_SSD1306.Height &&
+	     OLED_SSD1306.CurrentX + next * scale < OLED_SSD1306.Width; ch = following)
+	{
+		glyph = &Font->metrics->Glyphs[OLED_GLYPH(Font, ch)];
+		pen = next;
+		x1 = (pen + glyph->Advance > x1) ? pen + glyph->Advance : x1;
+		
+		if (glyph->Width != 0)
+		{
+			x0 = (pen + glyph->OffsetX < x0) ? pen + glyph->OffsetX : x0;
+			x1 = (pen + glyph->OffsetX + glyph->Width > x1) ? pen + glyph->OffsetX + glyph->Width : x1;
+		}
+		
+		stop = p;
+		following = (p != end) ? OLED_NEXT_CHAR(&p) : 0;
+		next = pen + glyph->Advance + OLED_FONTS_GetKerning(Font, ch, following);
+	}
+	
+	for (page = 0; rop != OLED_TEXT_ROP_NONE && page * 8 < Font->FontHeight; page++)
+	{
+		for (c0 = x0; c0 < x1; c0 += OLED_BITMAP_CHUNK)
+		{
+			w = (x1 - c0 < OLED_BITMAP_CHUNK) ? (uint16_t)(x1 - c0) : OLED_BITMAP_CHUNK;
+			memset(buf, 0x00, w);
+			
+			for (p = str, pen = 0; p < stop; )
+			{
+				ch = OLED_NEXT_CHAR(&p);
+				glyph = &Font->metrics->Glyphs[OLED_GLYPH(Font, ch)];
+				left = pen + glyph->OffsetX;
+				c = (left > c0) ? left : c0;
+				c_end = (left + glyph->Width < c0 + w) ? left + glyph->Width : c0 + w;
+				
+				/* Glyph pages overlapping this band, shifted by the glyph's row offset */
+				for (gp = 0; c < c_end && gp * 8 < glyph->Height; gp++)
+				{
+					shift = glyph->OffsetY + gp * 8 - page * 8;
+					
+					if (shift <= -8 || shift >= 8)
+					{
+						continue;
+					}
+					
+					src = &Font->metrics->Bitmap[glyph->Start + gp * glyph->Width];
+					
+					for (col = c; col < c_end; col++)
+					{
+						buf[col - c0] |= (shift >= 0) ? (uint8_t)(src[col - left] << shift) : (uint8_t)(src[col - left] >> -shift);
+					}
+				}
+				
+				q = p;
+				pen += glyph->Advance + OLED_FONTS_GetKerning(Font, ch, (q != end) ? OLED_NEXT_CHAR(&q) : 0);
+			}
+			
+			/* Opaque black text: the background is the set source bits, as in a fixed width cell */
+			if (invert)
+			{
+				for (k = 0; k < w; k++)
+				{
+					buf[k] = (uint8_t)~buf[k];
+				}
+			}
+			
+			rows = (Font->FontHeight - page * 8 < 8) ? Font->FontHeight - page * 8 : 8;
+			
+			if (scale > 1)
+			{
+				OLED_BlitScaled(buf, w, rows, (int16_t)(OLED_SSD1306.CurrentX + c0 * scale),
+				                (int16_t)(OLED_SSD1306.CurrentY + page * 8 * scale), (OLED_ROP_t)rop);
+			}
+			else
+			{
+				OLED_BlitPages(buf, NULL, OLED_BITMAP_CHUNK, w, rows, (int16_t)(OLED_SSD1306.CurrentX + c0),
+				               (int16_t)(OLED_SSD1306.CurrentY + page * 8), (OLED_ROP_t)rop);
+			}
+		}
+	}
+	
+	OLED_SSD1306.CurrentX += next * scale;
+	
+	return stop;
+}
+
+
+/**
+ * @brief  Puts character on OLED
+ * @note   @ref OLED_SSD1306_UpdateScreen() must be called after that in order to see updated LCD screen.
+ *         Proportional fonts move the position by the glyph's advance instead of FontWidth
+ * @param  ch: Character to be written, bytes from 0x80 are taken as Latin-1 (0xB0 is the degree sign)
+ * @param  *Font: Pointer to @ref OLED_FontDef_t structure with used font
+ * @param  color: Color used for drawing. This parameter can be a value of @ref OLED_COLOR_t enumeration
+ * @retval Character written
+ */
+char OLED_SSD1306_Putc(char ch, OLED_FontDef_t* Font, OLED_COLOR_t color)
+{
+	return (OLED_SSD1306_PutCodepoint((uint8_t)ch, Font, color) != 0) ? ch : 0;
+}
+
+
+/**
+ * @brief  Puts a Unicode character on OLED
+ * @note   @ref OLED_SSD1306_UpdateScreen() must be called after that in order to see updated LCD screen.
+ *         Characters the font does not have are drawn with its fallback glyph
+ * @param  codepoint: Character to be written
+ * @param  *Font: Pointer to @ref OLED_FontDef_t structure with used font
+ * @param  color: Color used for drawing. This parameter can be a value of @ref OLED_COLOR_t enumeration
+ * @retval Codepoint written, 0 if there is no room left on the line
+ */
+uint32_t OLED_SSD1306_PutCodepoint(uint32_t codepoint, OLED_FontDef_t* Font, OLED_COLOR_t color)
+{
+	uint8_t col[16], cell[OLED_GLYPH_CELL_SIZE];
+	uint16_t glyph, page, pages, i;
+	const uint8_t *src;
+	uint8_t rop, invert, scale = OLED_SSD1306.TextScale;
+	char utf8[5];
+	
+	/* Check available space in LCD */
+	if((OLED_SSD1306.Width <= (OLED_SSD1306.CurrentX)) || ((OLED_SSD1306.Height <= OLED_SSD1306.CurrentY)))
+	{
+		return 0;
+	}
+	
+	if (Font->metrics != NULL)
+	{
+		if (OLED_FONTS_EncodeUtf8(codepoint, utf8) == 0)
+		{
+			OLED_FONTS_EncodeUtf8(OLED_FONTS_INVALID, utf8);
+		}
+		
+		OLED_PutRun(utf8, NULL, Font, color);
+		return codepoint;
+	}
+	
+	glyph = OLED_GLYPH(Font, codepoint);
+	
+	/* An opaque cell: with the source bits inverted for black text, set bits take the raster op and
+	   clear bits the background, exactly what OLED_BlitPages() does with a page-major source */
+	pages = (Font->FontHeight + 7) / 8;
+	rop = OLED_TextRop(color, &invert);
+	
+	if (rop == OLED_TEXT_ROP_NONE)
+	{
+		/* Transparent text that would not change a pixel */
+	}
+	else if (scale > 1)
+	{
+		/* Enlarged a page of the cell at a time, each into scale pages of the target */
+		if (Font->glyphs == NULL && Font->packed != NULL)
+		{
+			OLED_UnpackGlyph(Font, glyph, cell);
+		}
+		
+		for (page = 0; page < pages; page++)
+		{
+			src = (Font->glyphs == NULL && Font->packed != NULL) ? &cell[page * Font->FontWidth] :
+			                                                       OLED_GlyphPage(Font, glyph, page, col);
+			
+			if (invert)
+			{
+				for (i = 0; i < Font->FontWidth; i++)
+				{
+					col[i] = (uint8_t)~src[i];
+				}
+				
+				src = col;
+			}
+			
+			OLED_BlitScaled(src, Font->FontWidth, (Font->FontHeight - page * 8 < 8) ? Font->FontHeight - page * 8 : 8,
+			                (int16_t)OLED_SSD1306.CurrentX, (int16_t)(OLED_SSD1306.CurrentY + page * 8 * scale),
+			                (OLED_ROP_t)rop);
+		}
+	}
+	else if (Font->glyphs != NULL && !invert)
+	{
+		/* Stored as drawn: the whole cell in one blit, a few shifted byte writes per column */
+		OLED_BlitPages(&Font->glyphs[glyph * pages * Font->FontWidth], NULL, Font->FontWidth, Font->FontWidth,
+		               Font->FontHeight, (int16_t)OLED_SSD1306.CurrentX, (int16_t)OLED_SSD1306.CurrentY, (OLED_ROP_t)rop);
+	}
+	else if (Font->glyphs == NULL && Font->packed != NULL)
+	{
+		/* Decoded once into a cell on the stack, then drawn like pre-transposed glyphs */
+		OLED_UnpackGlyph(Font, glyph, cell);
+		
+		for (i = 0; invert && i < pages * Font->FontWidth; i++)
+		{
+			cell[i] = (uint8_t)~cell[i];
+		}
+		
+		OLED_BlitPages(cell, NULL, Font->FontWidth, Font->FontWidth, Font->FontHeight, (int16_t)OLED_SSD1306.CurrentX,
+		               (int16_t)OLED_SSD1306.CurrentY, (OLED_ROP_t)rop);
+	}
+	else
+	{
+		for (page = 0; page < pages; page++)
+		{
+			src = OLED_GlyphPage(Font, glyph, page, col);
+			
+			if (invert)
+			{
+				for (i = 0; i < Font->FontWidth; i++)
+				{
+					col[i] = (uint8_t)~src[i];
+				}
+				
+				src = col;
+			}
+			
+			OLED_BlitPages(src, NULL, Font->FontWidth, Font->FontWidth,
+			               (Font->FontHeight - page * 8 < 8) ? Font->FontHeight - page * 8 : 8,
+			               (int16_t)OLED_SSD1306.CurrentX, (int16_t)(OLED_SSD1306.CurrentY + page * 8), (OLED_ROP_t)rop);
+		}
+	}
+	
+	/* Increase the pointer along x- direction*/
+	OLED_SSD1306.CurrentX += Font->FontWidth * scale;
+	
+	//OLED_SSD1306_UpdateScreen();
+	/* Return the character written */
+	return codepoint;
+	
+}
+
+
+/**
+ * @brief  Puts string on OLED
+ * @note   @ref OLED_SSD1306_UpdateScreen() must be called after that in order to see updated LCD screen.
+ *         Kerning pairs of proportional fonts are applied between characters
+ * @param  *str: UTF-8 string to be written
+ * @param  *Font: Pointer to @ref OLED_FontDef_t structure with used font
+ * @param  color: Color used for drawing. This parameter can be a value of @ref OLED_COLOR_t enumeration
+ * @retval Zero on success or the first byte of the character that could not be written
+ */
+char OLED_SSD1306_Puts(char* str, OLED_FontDef_t* Font, OLED_COLOR_t color)
+{
+	const char *p = str, *next;
+	uint32_t ch;
+	
+	/* Proportional fonts: the whole string is one run, kerned glyphs may overlap their neighbours */
+	if (Font->metrics != NULL)
+	{
+		return *OLED_PutRun(str, NULL, Font, color);
+	}
+	
+	/* Write characters */
+	while(*p)
+	{
+		next = p;
+		ch = OLED_NEXT_CHAR(&next);
+		
+		/*Write Character by character */
+		if(OLED_SSD1306_PutCodepoint(ch, Font, color) != ch)
+		{
+			/* Return Error */
+			return *p;
+		}
+    
+     /* Increase the string pointer */
+     p = next;
+	}
+
+ /* Everything is ok, return 0*/
+ return	*p;
+	
+}
+
+
+/**
+ * @brief  Pixels a character moves the pen when it is followed by another one, the same figure the drawing uses
+ */
+static int32_t OLED_TextAdvance(const OLED_FontDef_t *Font, uint32_t ch, uint32_t following)
+{
+	if (Font->metrics == NULL)
+	{
+		return Font->FontWidth;
+	}
+	
+	return Font->metrics->Glyphs[OLED_GLYPH(Font, ch)].Advance + OLED_FONTS_GetKerning(Font, ch, following);
+}
+
+
+/**
+ * @brief  Draws the characters from str up to end at the current position, the last one unkerned
+ */
+static void OLED_PutSpan(const char *str, const char *end, OLED_FontDef_t *Font, OLED_COLOR_t color)
+{
+	const char *p = str;
+	
+	if (Font->metrics != NULL)
+	{
+		OLED_PutRun(str, end, Font, color);
+		return;
+	}
+	
+	while (p != end && *p && OLED_SSD1306_PutCodepoint(OLED_NEXT_CHAR(&p), Font, color) != 0)
+	{
+	}
+}
+
+
+/**
+ * @brief  Draws a string in a box, wrapped into lines and aligned within it
+ * @note   @ref OLED_SSD1306_UpdateScreen() must be called after that in order to see updated LCD screen.
+ *         Lines are laid out in one pass with the advances and kerning Puts() draws with. Word wrap is greedy:
+ *         a line breaks at the last space that keeps it within w, a word longer than a line is broken between
+ *         characters and the spaces at a break are dropped. '\n' always starts a new line.
+ *         Only lines of full height are drawn. When text is left after the last one, it ends in "...", as does
+ *         any line too wide for the box with OLED_WRAP_NONE. Drawing is clipped to the box, lines outside the
+ *         clip rectangle are measured but not drawn, and layout stops at its bottom edge
+ * @param  x,y: Top left corner of the box
+ * @param  w,h: Size of the box in pixels
+ * @param  *str: UTF-8 string to be written
+ * @param  *Font: Pointer to @ref OLED_FontDef_t structure with used font
+ * @param  color: Color used for drawing. This parameter can be a value of @ref OLED_COLOR_t enumeration
+ * @param  align: Position of every line within w. This parameter can be a value of @ref OLED_ALIGN_t enumeration
+ * @param  wrap: This parameter can be a value of @ref OLED_WRAP_t enumeration
+ * @param  spacing: Pixels between the bottom of a line and the top of the next one
+ * @retval Offset in str of the text that did not fit: the first character replaced by "..." or the first line
+ *         not drawn, the length of str when everything is shown
+ */
+uint16_t OLED_SSD1306_DrawTextBox(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const char* str, OLED_FontDef_t* Font,
+                                  OLED_COLOR_t color, OLED_ALIGN_t align, OLED_WRAP_t wrap, uint8_t spacing)
+{
+	static const char ellipsis[] = "...";
+	const char *line = str, *p, *cur, *eol, *next, *brk;
+	int32_t pen, width, brk_width, cand, dots;
+	uint32_t ch, prev;
+	uint16_t ly = y, left, lh = Font->FontHeight * OLED_SSD1306.TextScale;
+	uint8_t last, cut, scale = OLED_SSD1306.TextScale;
+	
+	if (!OLED_SSD1306_PushClip((int16_t)x, (int16_t)y, w, h))
+	{
+		return 0;
+	}
+	
+	dots = (3 * OLED_TextAdvance(Font, '.', '.') - OLED_FONTS_GetKerning(Font, '.', '.')) * scale;
+	
+	/* Lines of full height, the rest of the box is left alone */
+	while (*line && ly + lh <= y + h && ly <= OLED_SSD1306.ClipY1)
+	{
+		/* Measure up to '\n', the end or the first character that does not fit */
+		p = line;
+		brk = NULL;
+		brk_width = 0;
+		pen = 0;
+		prev = 0;
+		
+		for (;;)
+		{
+			cur = p;
+			ch = OLED_NEXT_CHAR(&p);
+			
+			if (ch == 0 || ch == '\n')
+			{
+				eol = cur;
+				next = p;
+				width = pen;
+				break;
+			}
+			
+			cand = pen + (OLED_FONTS_GetKerning(Font, prev, ch) + OLED_TextAdvance(Font, ch, 0)) * scale;
+			
+			if (wrap == OLED_WRAP_WORD && ch != ' ' && cand > w && cur != line)
+			{
+				/* Break after the last word that fits, or inside a word longer than the line */
+				eol = (brk != NULL) ? brk : cur;
+				width = (brk != NULL) ? brk_width : pen;
+				
+				for (next = eol; *next == ' '; next++)
+				{
+				}
+				
+				break;
+			}
+			
+			if (ch == ' ' && prev != ' ' && cur != line)
+			{
+				brk = cur;
+				brk_width = pen;
+			}
+			
+			pen = cand;
+			prev = ch;
+		}
+		
+		last = (ly + 2 * lh + spacing > y + h);
+		cut = (width > w) || (last && *next != 0);
+		
+		if (cut)
+		{
+			/* The longest start of the line that leaves room for the ellipsis */
+			for (p = line, pen = 0, prev = 0; p != eol; prev = ch)
+			{
+				cur = p;
+				ch = OLED_NEXT_CHAR(&p);
+				cand = pen + (OLED_FONTS_GetKerning(Font, prev, ch) + OLED_TextAdvance(Font, ch, 0)) * scale;
+				
+				if (cand + dots > w)
+				{
+					p = cur;
+					break;
+				}
+				
+				pen = cand;
+			}
+			
+			eol = p;
+			width = pen + dots;
+		}
+		
+		/* Lines above the clip rectangle only cost their measuring */
+		if (ly + lh > OLED_SSD1306.ClipY0)
+		{
+			left = x;
+			
+			if (width < w && align == OLED_ALIGN_CENTER)
+			{
+				left += (w - width) / 2;
+			}
+			else if (width < w && align == OLED_ALIGN_RIGHT)
+			{
+				left += w - width;
+			}
+			
+			OLED_SSD1306_GotoXY(left, ly);
+			OLED_PutSpan(line, eol, Font, color);
+			
+			if (cut)
+			{
+				OLED_PutSpan(ellipsis, NULL, Font, color);
+			}
+		}
+		
+		if (last && *next != 0)
+		{
+			/* What the ellipsis stands for */
+			line = eol;
+			break;
+		}
+		
+		line = next;
+		ly += lh + spacing;
+	}
+	
+	OLED_SSD1306_PopClip();
+	
+	return (uint16_t)(line - str);
+}
+
+
+/**
+ * @brief  Pads the digits ending at the terminating zero of field into width characters and draws them
+ * @param  *field: OLED_NUM_MAX_WIDTH + 1 characters, the digits are at its end
+ * @param  *digits: First digit, written backwards from the end of field
+ * @param  sign: '-', '+' or 0 for none
+ */
+static char OLED_PutField(char *field, char *digits, char sign, uint8_t width, uint8_t flags, OLED_FontDef_t *Font,
+                          OLED_COLOR_t color)
+{
+	char *end = &field[OLED_NUM_MAX_WIDTH];
+	char *p = digits;
+	uint8_t len;
+	
+	if (width > OLED_NUM_MAX_WIDTH)
+	{
+		width = OLED_NUM_MAX_WIDTH;
+	}
+	
+	if (flags & OLED_NUM_LEFT)
+	{
+		if (sign != 0)
+		{
+			*--p = sign;
+		}
+		
+		/* Digits to the front, spaces after them */
+		len = (uint8_t)(end - p);
+		memmove(field, p, len);
+		
+		if (width > len)
+		{
+			memset(&field[len], ' ', width - len);
+			len = width;
+		}
+		
+		field[len] = '\0';
+		
+		return OLED_SSD1306_Puts(field, Font, color);
+	}
+	
+	/* Zeros go between the sign and the digits, spaces in front of the sign */
+	if (flags & OLED_NUM_ZERO_PAD)
+	{
+		while (end - p < width - (sign != 0))
+		{
+			*--p = '0';
+		}
+	}
+	
+	if (sign != 0)
+	{
+		*--p = sign;
+	}
+	
+	while (end - p < width)
+	{
+		*--p = ' ';
+	}
+	
+	return OLED_SSD1306_Puts(p, Font, color);
+}
+
+
+/**
+ * @brief  Writes the decimal digits of value backwards in front of p, with a point before the last decimals digits
+ * @retval The first digit
+ */
+static char* OLED_FormatDecimal(char *p, uint32_t value, uint8_t decimals)
+{
+	uint32_t q;
+	
+	if (decimals != 0)
+	{
+		do
+		{
+			q = value / 10;
+			*--p = (char)('0' + (value - q * 10));
+			value = q;
+		} while (--decimals != 0);
+		
+		*--p = '.';
+	}
+	
+	/* At least one digit in front of the point */
+	do
+	{
+		q = value / 10;
+		*--p = (char)('0' + (value - q * 10));
+		value = q;
+	} while (value != 0);
+	
+	return p;
+}
+
+
+/**
+ * @brief  Puts a signed decimal number on OLED, like "%d" with a field width but without stdio
+ * @note   @ref OLED_SSD1306_UpdateScreen() must be called after that in order to see updated LCD screen.
+ *         The digits are produced in a small buffer on the stack and drawn with @ref OLED_SSD1306_Puts()
+ * @param  value: Number to be written
+ * @param  width: Minimum characters written, padded as flags say. 0 for just the digits
+ * @param  flags: Values of @ref OLED_NUM_FLAGS_t enumeration ORed together
+ * @param  *Font: Pointer to @ref OLED_FontDef_t structure with used font
+ * @param  color: Color used for drawing. This parameter can be a value of @ref OLED_COLOR_t enumeration
+ * @retval Zero on success or the first character that could not be written
+ */
+char OLED_SSD1306_PutInt(int32_t value, uint8_t width, uint8_t flags, OLED_FontDef_t* Font, OLED_COLOR_t color)
+{
+	return OLED_SSD1306_PutFixed(value, 0, width, flags, Font, color);
+}
+
+
+/**
+ * @brief  Puts a fixed point number on OLED, value / 10^decimals with exactly that many digits after the point
+ * @note   @ref OLED_SSD1306_UpdateScreen() must be called after that in order to see updated LCD screen.
+ *         E.g. a temperature kept in tenths of a degree: PutFixed(-235, 1, ...) writes "-23.5", PutFixed(5, 2, ...)
+ *         writes "0.05". No rounding takes place, scale the value first
+ * @param  value: Number to be written, scaled by 10^decimals
+ * @param  decimals: Digits after the point, 0 to 9. 0 writes an integer
+ * @param  width: Minimum characters written including sign and point, padded as flags say
+ * @param  flags: Values of @ref OLED_NUM_FLAGS_t enumeration ORed together
+ * @param  *Font: Pointer to @ref OLED_FontDef_t structure with used font
+ * @param  color: Color used for drawing. This parameter can be a value of @ref OLED_COLOR_t enumeration
+ * @retval Zero on success or the first character that could not be written
+ */
+char OLED_SSD1306_PutFixed(int32_t value, uint8_t decimals, uint8_t width, uint8_t flags, OLED_FontDef_t* Font,
+                           OLED_COLOR_t color)
+{
+	char field[OLED_NUM_MAX_WIDTH + 1];
+	char sign = (value < 0) ? '-' : ((flags & OLED_NUM_PLUS) ? '+' : 0);
+	/* The magnitude of INT32_MIN still fits the unsigned value */
+	uint32_t magnitude = (value < 0) ? 0u - (uint32_t)value : (uint32_t)value;
+	
+	if (decimals > 9)
+	{
+		decimals = 9;
+	}
+	
+	field[OLED_NUM_MAX_WIDTH] = '\0';
+	
+	return OLED_PutField(field, OLED_FormatDecimal(&field[OLED_NUM_MAX_WIDTH], magnitude, decimals), sign, width, flags,
+	                     Font, color);
+}
+
+
+/**
+ * @brief  Puts an unsigned hexadecimal number on OLED, like "%X" without stdio
+ * @note   @ref OLED_SSD1306_UpdateScreen() must be called after that in order to see updated LCD screen.
+ *         No "0x" prefix is written, e.g. PutHex(0x2F, 4, OLED_NUM_ZERO_PAD, ...) writes "002F"
+ * @param  value: Number to be written
+ * @param  width: Minimum characters written, padded as flags say. 0 for just the digits
+ * @param  flags: Values of @ref OLED_NUM_FLAGS_t enumeration ORed together, OLED_NUM_PLUS is ignored
+ * @param  *Font: Pointer to @ref OLED_FontDef_t structure with used font
+ * @param  color: Color used for drawing. This parameter can be a value of @ref OLED_COLOR_t enumeration
+ * @retval Zero on success or the first character that could not be written
+ */
+char OLED_SSD1306_PutHex(uint32_t value, uint8_t width, uint8_t flags, OLED_FontDef_t* Font, OLED_COLOR_t color)
+{
+	const char *hex = (flags & OLED_NUM_LOWER) ? "0123456789abcdef" : "0123456789ABCDEF";
+	char field[OLED_NUM_MAX_WIDTH + 1];
+	char *p = &field[OLED_NUM_MAX_WIDTH];
+	
+	*p = '\0';
+	
+	do
+	{
+		*--p = hex[value & 0x0F];
+		value >>= 4;
+	} while (value != 0);
+	
+	return OLED_PutField(field, p, 0, width, flags, Font, color);
+}
+
+
+/* One rendered text run of OLED_SSD1306_PutsCached() */
+typedef struct {
+	const OLED_FontDef_t *Font;     /* NULL while the slot is free */
+	uint32_t Hash;
+	uint32_t LastUse;
+	uint8_t Color;
+	char Text[OLED_TEXT_CACHE_MAX_LEN + 1];  /* Compared on a hash match, so a collision is never drawn */
+	OLED_Canvas_t Canvas;           /* The run drawn with OLED_ROP_COPY, Buffer is the slot's pixels */
+} OLED_TextRun_t;
+
+static OLED_TextRun_t OLED_TextCache[OLED_TEXT_CACHE_ENTRIES];
+static uint8_t OLED_TextCachePixels[OLED_TEXT_CACHE_ENTRIES][OLED_TEXT_CACHE_SLOT_SIZE];
+static uint32_t OLED_TextCacheTick;
+static OLED_TextCacheStats_t OLED_TextCacheStats;
+
+
+/**
+ * @brief  FNV-1a hash of a string, also returns its length
+ */
+static uint32_t OLED_TextHash(const char *str, uint16_t *len)
+{
+	uint32_t hash = 2166136261u;
+	uint16_t n = 0;
+
+	while (str[n])
+	{
+		hash = (hash ^ (uint8_t)str[n++]) * 16777619u;
+	}
+
+	*len = n;
+	return hash;
+}
+
+
+/**
+ * @brief  Checks that every glyph of a proportional string stays inside its run box
+ * @note   A cached run is blitted as a whole box, ink outside it would be lost and the box would cover
+ *         pixels Puts() leaves alone. Always true for fixed width fonts
+ */
+static uint8_t OLED_TextInBox(const char *str, const OLED_FontDef_t *Font, uint16_t length)
+{
+	const OLED_FontGlyph_t *glyph;
+	int32_t pen = 0;
+	uint32_t ch, next;
+
+	if (Font->metrics == NULL)
+	{
+		return 1;
+	}
+
+	for (ch = OLED_NEXT_CHAR(&str); ch != 0; ch = next)
+	{
+		glyph = &Font->metrics->Glyphs[OLED_GLYPH(Font, ch)];
+		next = OLED_NEXT_CHAR(&str);
+
+		if (glyph->Width != 0 && (pen + glyph->OffsetX < 0 || pen + glyph->OffsetX + glyph->Width > length ||
+		                          glyph->OffsetY < 0 || glyph->OffsetY + glyph->Height > Font->FontHeight))
+		{
+			return 0;
+		}
+
+		pen += glyph->Advance + OLED_FONTS_GetKerning(Font, ch, next);
+	}
+
+	return 1;
+}
+
+
+/**
+ * @brief  Draws a string into a canvas with OLED_ROP_COPY, whatever the clip stack and raster op are
+ */
+static void OLED_RenderText(OLED_Canvas_t *canvas, char *str, OLED_FontDef_t *Font, OLED_COLOR_t color)
+{
+	OLED_Canvas_t *target = OLED_SSD1306.Target;
+	uint16_t x = OLED_SSD1306.CurrentX, y = OLED_SSD1306.CurrentY;
+	uint8_t rop = OLED_SSD1306.RasterOp, mode = OLED_SSD1306.TextMode, depth = OLED_SSD1306.ClipDepth;
+
+	OLED_SSD1306.ClipDepth = 0;
+	OLED_SSD1306.RasterOp = OLED_ROP_COPY;
+	OLED_SSD1306.TextMode = OLED_TEXT_OPAQUE;
+	OLED_SSD1306_SetTarget(canvas);
+	OLED_SSD1306_GotoXY(0, 0);
+	OLED_SSD1306_Puts(str, Font, color);
+
+	OLED_SSD1306.ClipDepth = depth;
+	OLED_SSD1306.RasterOp = rop;
+	OLED_SSD1306.TextMode = mode;
+	OLED_SSD1306_SetTarget(target);
+	OLED_SSD1306_GotoXY(x, y);
+}
+
+
+/**
+ * @brief  Puts string on OLED like @ref OLED_SSD1306_Puts(), through a cache of rendered text runs
+ * @note   Runs are kept page-major and keyed by font, string hash and color, a repeated label is one blit
+ *         with the current raster op. The least recently used run is replaced on a miss.
+ *         Call @ref OLED_SSD1306_ClearTextCache() after changing font data that lives in RAM
+ * @param  *str: UTF-8 string to be written
+ * @param  *Font: Pointer to @ref OLED_FontDef_t structure with used font
+ * @param  color: Color used for drawing. This parameter can be a value of @ref OLED_COLOR_t enumeration
+ * @retval Zero on success or character value when function failed
+ */
+char OLED_SSD1306_PutsCached(char* str, OLED_FontDef_t* Font, OLED_COLOR_t color)
+{
+	OLED_TextRun_t *run = NULL, *slot = &OLED_TextCache[0];
+	OLED_Fonts_Size_t size;
+	OLED_COLOR_t shade;
+	uint32_t hash;
+	uint16_t len, i;
+	uint8_t rop, invert;
+
+	hash = OLED_TextHash(str, &len);
+	OLED_FONTS_GetStringSize(str, &size, Font);
+
+	/* Only whole runs on the target are cached, Puts() decides where anything else stops */
+	if (len == 0 || len > OLED_TEXT_CACHE_MAX_LEN || OLED_SSD1306.TextScale != 1 ||
+	    OLED_CANVAS_BUFFER_SIZE(size.Length, size.Height) > OLED_TEXT_CACHE_SLOT_SIZE ||
+	    OLED_SSD1306.CurrentX + size.Length > OLED_SSD1306.Width || OLED_SSD1306.CurrentY >= OLED_SSD1306.Height ||
+	    !OLED_TextInBox(str, Font, size.Length))
+	{
+		if (len != 0)
+		{
+			OLED_TextCacheStats.Bypassed++;
+		}
+
+		return OLED_SSD1306_Puts(str, Font, color);
+	}
+
+	OLED_TextCacheTick++;
+
+	/* Transparent text is kept as its glyph bits, the run drawn white */
+	rop = OLED_TextRop(color, &invert);
+	shade = (OLED_SSD1306.TextMode == OLED_TEXT_OPAQUE) ? color : OLED_COLOR_WHITE;
+
+	for (i = 0; i < OLED_TEXT_CACHE_ENTRIES; i++)
+	{
+		if (OLED_TextCache[i].Font == Font && OLED_TextCache[i].Hash == hash && OLED_TextCache[i].Color == shade &&
+		    strcmp(OLED_TextCache[i].Text, str) == 0)
+		{
+			run = &OLED_TextCache[i];
+			break;
+		}
+
+		/* Free slot first, then the least recently used one */
+		if (slot->Font != NULL && (OLED_TextCache[i].Font == NULL || OLED_TextCache[i].LastUse < slot->LastUse))
+		{
+			slot = &OLED_TextCache[i];
+		}
+	}
+
+	if (run != NULL)
+	{
+		OLED_TextCacheStats.Hits++;
+	}
+	else
+	{
+		OLED_TextCacheStats.Misses++;
+
+		if (slot->Font != NULL)
+		{
+			OLED_TextCacheStats.Evictions++;
+		}
+
+		run = slot;
+		run->Font = Font;
+		run->Hash = hash;
+		run->Color = shade;
+		memcpy(run->Text, str, len + 1);
+
+		OLED_SSD1306_CanvasInit(&run->Canvas, OLED_TextCachePixels[run - OLED_TextCache], size.Length, size.Height);
+		OLED_RenderText(&run->Canvas, str, Font, shade);
+	}
+
+	run->LastUse = OLED_TextCacheTick;
+
+	if (rop != OLED_TEXT_ROP_NONE)
+	{
+		OLED_BlitPages(run->Canvas.Buffer, NULL, run->Canvas.Width, run->Canvas.Width, run->Canvas.Height,
+		               (int16_t)OLED_SSD1306.CurrentX, (int16_t)OLED_SSD1306.CurrentY, (OLED_ROP_t)rop);
+	}
+	OLED_SSD1306.CurrentX += size.Length;
+
+	return 0;
+}
+
+
+/**
+ * @brief  Drops all cached text runs and clears the counters
+ * @retval None
+ */
+void OLED_SSD1306_ClearTextCache(void)
+{
+	memset(OLED_TextCache, 0, sizeof(OLED_TextCache));
+	memset(&OLED_TextCacheStats, 0, sizeof(OLED_TextCacheStats));
+	OLED_TextCacheTick = 0;
+}
+
+
+/**
+ * @brief  Returns the text cache counters gathered since @ref OLED_SSD1306_ClearTextCache()
+ * @param  *stats: Filled in with the current counters
+ * @retval None
+ */
+void OLED_SSD1306_GetTextCacheStats(OLED_TextCacheStats_t* stats)
+{
+	*stats = OLED_TextCacheStats;
+}
+
+
+
+/**
+ * @brief  Draws line on OLED
+ * @note   @ref OLED_SSD1306_UpdateScreen() must be called after that in order to see updated LCD screen
+ * @param  x0: Line X start point. Valid input is 0 to OLED_WIDTH - 1
+ * @param  y0: Line Y start point. Valid input is 0 to OLED_HEIGHT - 1
+ * @param  x1: Line X end point. Valid input is 0 to OLED_WIDTH - 1
+ * @param  y1: Line Y end point. Valid input is 0 to OLED_HEIGHT - 1
+ * @param  c: Color to be used. This parameter can be a value of @ref OLED_COLOR_t enumeration
+ * @retval None
+ */
+void OLED_SSD1306_DrawLine(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, OLED_COLOR_t color)
+{
+	int16_t dx, dy, sx, sy, err, e2;
+	OLED_SpanOp_t op = OLED_SpanOp(color);
+	
+	/* Points outside the target (negative ones wrap through uint16_t) are clipped, never clamped */
+	int32_t cx0 = (int16_t)x0, cy0 = (int16_t)y0, cx1 = (int16_t)x1, cy1 = (int16_t)y1;
+	
+	if (cx0 == cx1)
+	{
+		/* Vertical line */
+		OLED_FillRect(cx0, (cy0 < cy1) ? cy0 : cy1, cx0, (cy0 < cy1) ? cy1 : cy0, op);
+		
+		/* Return from function */
+		return;
+	}
+	
+	if (cy0 == cy1) 
+	{
+		/* Horizontal line */
+		OLED_FillRect((cx0 < cx1) ? cx0 : cx1, cy0, (cx0 < cx1) ? cx1 : cx0, cy0, op);
+		
+		/* Return from function */
+		return;
+	}
+	
+	/* Clip once, the loop below plots without bounds checks */
+	if (OLED_SSD1306.ClipX0 > OLED_SSD1306.ClipX1 || OLED_SSD1306.ClipY0 > OLED_SSD1306.ClipY1 ||
+	    !OLED_ClipLine(&cx0, &cy0, &cx1, &cy1))
+	{
+		return;
+	}
+	
+	 dx = (cx0 < cx1) ? (cx1 - cx0) : (cx0 - cx1); 
+	 dy = (cy0 < cy1) ? (cy1 - cy0) : (cy0 - cy1); 
+	 sx = (cx0 < cx1) ? 1 : -1; 
+	 sy = (cy0 < cy1) ? 1 : -1; 
+	 err = ((dx > dy) ? dx : -dy) / 2; 
+
+	while (1) 
+	{
+		OLED_PutPixel(cx0, cy0, op); 
+			
+		 if (cx0 == cx1 && cy0 == cy1) 
+		 {
+			 break;
+		 }
+		 
+		 e2 = err; 
+				
+		 if (e2 > -dx)
+		 {
+			 err -= dy;
+			 cx0 += sx;
+		 }
+			
+		 if (e2 < dy)
+		 {
+			 err += dx;
+			 cy0 += sy;
+		 }
+   }		
+}
+
+
+/**
+ * @brief  Draws horizontal line on OLED
+ * @note   @ref OLED_SSD1306_UpdateScreen() must be called after that in order to see updated LCD screen
+ * @param  x: Line X start point. Valid input is 0 to OLED_WIDTH - 1
+ * @param  y: Line Y location. Valid input is 0 to OLED_HEIGHT - 1
+ * @param  w: Line length in units of pixels
+ * @param  color: Color to be used. This parameter can be a value of @ref OLED_COLOR_t enumeration
+ * @retval None
+ */
+void OLED_SSD1306_DrawHLine(uint16_t x, uint16_t y, uint16_t w, OLED_COLOR_t color)
+{
+	if (w == 0)
+	{
+		/* Return error */
+		return;
+	}
+	
+	/* Single page, one bit per column */
+	OLED_FillRect((int16_t)x, (int16_t)y, (int16_t)x + (int16_t)w - 1, (int16_t)y, OLED_SpanOp(color));
+}
+
+
+/**
+ * @brief  Draws vertical line on OLED
+ * @note   @ref OLED_SSD1306_UpdateScreen() must be called after that in order to see updated LCD screen
+ * @param  x: Line X location. Valid input is 0 to OLED_WIDTH - 1
+ * @param  y: Line Y start point. Valid input is 0 to OLED_HEIGHT - 1
+ * @param  h: Line length in units of pixels
+ * @param  color: Color to be used. This parameter can be a value of @ref OLED_COLOR_t enumeration
+ * @retval None
+ */
+void OLED_SSD1306_DrawVLine(uint16_t x, uint16_t y, uint16_t h, OLED_COLOR_t color)
+{
+	if (h == 0)
+	{
+		/* Return error */
+		return;
+	}
+	
+	/* Single column, one masked byte per page */
+	OLED_FillRect((int16_t)x, (int16_t)y, (int16_t)x, (int16_t)y + (int16_t)h - 1, OLED_SpanOp(color));
+}
+
+
+/**
+ * @brief  Draws rectangle on OLED
+ * @note   @ref OLED_SSD1306_UpdateScreen() must be called after that in order to see updated LCD screen
+ * @param  x: Top left X start point. Valid input is 0 to OLED_WIDTH - 1
+ * @param  y: Top left Y start point. Valid input is 0 to OLED_HEIGHT - 1
+ * @param  w: Rectangle width in units of pixels
+ * @param  h: Rectangle height in units of pixels
+ * @param  c: Color to be used. This parameter can be a value of @ref OLED_COLOR_t enumeration
+ * @retval None
+ */
+void OLED_SSD1306_DrawRectangle(uint16_t x, uint16_t y, uint16_t w, uint16_t h, OLED_COLOR_t c)
+{
+	OLED_SpanOp_t op = OLED_SpanOp(c);
+	int16_t x0 = (int16_t)x, y0 = (int16_t)y;
+	
+	/* Draw 4 lines, each one clipped span. Corners are touched only once so XOR boxes erase cleanly */
+	OLED_FillRect(x0, y0, x0 + w, y0, op);                 /* Top line */
+	
+	if (h == 0)
+	{
+		return;
+	}
+	
+	OLED_FillRect(x0, y0 + h, x0 + w, y0 + h, op);         /* Bottom line */
+	
+	if (h == 1)
+	{
+		return;
+	}
+	
+	OLED_FillRect(x0, y0 + 1, x0, y0 + h - 1, op);         /* Left line */
+	
+	if (w != 0)
+	{
+		OLED_FillRect(x0 + w, y0 + 1, x0 + w, y0 + h - 1, op); /* Right line */
+	}
+	
+}
+
+
+/**
+ * @brief  Draws filled rectangle on OLED
+ * @note   @ref OLED_SSD1306_UpdateScreen() must be called after that in order to see updated LCD screen
+ * @param  x: Top left X start point. Valid input is 0 to OLED_WIDTH - 1
+ * @param  y: Top left Y start point. Valid input is 0 to OLED_HEIGHT - 1
+ * @param  w: Rectangle width in units of pixels
+ * @param  h: Rectangle height in units of pixels
+ * @param  c: Color to be used. This parameter can be a value of @ref OLED_COLOR_t enumeration
+ * @retval None
+ */
+void OLED_SSD1306_DrawFilledRectangle(uint16_t x, uint16_t y, uint16_t w, uint16_t h, OLED_COLOR_t c)
+{
+	/* One masked span per page, clipped once */
+	OLED_FillRect((int16_t)x, (int16_t)y, (int16_t)x + w, (int16_t)y + h, OLED_SpanOp(c));
+	
+}
+
+
+
+/**
+ * @brief  Draws triangle on OLED
+ * @note   @ref OLED_SSD1306_UpdateScreen() must be called after that in order to see updated LCD screen
+ * @param  x1: First coordinate X location. Valid input is 0 to OLED_WIDTH - 1
+ * @param  y1: First coordinate Y location. Valid input is 0 to OLED_HEIGHT - 1
+ * @param  x2: Second coordinate X location. Valid input is 0 to OLED_WIDTH - 1
+ * @param  y2: Second coordinate Y location. Valid input is 0 to OLED_HEIGHT - 1
+ * @param  x3: Third coordinate X location. Valid input is 0 to OLED_WIDTH - 1
+ * @param  y3: Third coordinate Y location. Valid input is 0 to OLED_HEIGHT - 1
+ * @param  c: Color to be used. This parameter can be a value of @ref OLED_COLOR_t enumeration
+ * @retval None
+ */
+void OLED_SSD1306_DrawTriangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t x3, uint16_t y3, OLED_COLOR_t color)
+{
+	/* Draw lines */
+	OLED_SSD1306_DrawLine(x1, y1, x2, y2, color);
+	OLED_SSD1306_DrawLine(x2, y2, x3, y3, color);
+	OLED_SSD1306_DrawLine(x3, y3, x1, y1, color);
+	
+	/* Under XOR every vertex was toggled twice by its two edges */
+	if (OLED_SpanOp(color) == OLED_SPAN_INVERT)
+	{
+		OLED_SSD1306_DrawPixel(x1, y1, color);
+		OLED_SSD1306_DrawPixel(x2, y2, color);
+		OLED_SSD1306_DrawPixel(x3, y3, color);
+	}
+}
+	
+
+
+/**
+ * @brief  Draws filled triangle on OLED
+ * @note   @ref OLED_SSD1306_UpdateScreen() must be called after that in order to see updated LCD screen
+ * @param  x1: First coordinate X location. Valid input is 0 to OLED_WIDTH - 1
+ * @param  y1: First coordinate Y location. Valid input is 0 to OLED_HEIGHT - 1
+ * @param  x2: Second coordinate X location. Valid input is 0 to OLED_WIDTH - 1
+ * @param  y2: Second coordinate Y location. Valid input is 0 to OLED_HEIGHT - 1
+ * @param  x3: Third coordinate X location. Valid input is 0 to OLED_WIDTH - 1
+ * @param  y3: Third coordinate Y location. Valid input is 0 to OLED_HEIGHT - 1
+ * @param  c: Color to be used. This parameter can be a value of @ref OLED_COLOR_t enumeration
+ * @retval None
+ */
+void OLED_SSD1306_DrawFilledTriangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t x3, uint16_t y3, OLED_COLOR_t color)
+{
+	int16_t deltax = 0, deltay = 0, x = 0, y = 0, xinc1 = 0, xinc2 = 0, 
+	yinc1 = 0, yinc2 = 0, den = 0, num = 0, numadd = 0, numpixels = 0, 
+	curpixel = 0;
+	
+	deltax = ABS(x2 - x1);
+	deltay = ABS(y2 - y1);
+	x = x1;
+	y = y1;
 
 	if (x2 >= x1) 
 	{
@@ -675,11 +3178,21 @@ void OLED_SSD1306_DrawCircle(int16_t x0, int16_t y0, int16_t r, OLED_COLOR_t c)
 	int16_t ddF_y = -2 * r;
 	int16_t x = 0;
 	int16_t y = r;
+	OLED_SpanOp_t op = OLED_SpanOp(c);
+	
+	/* Clip the bounding box once, only a partly visible circle checks its pixels */
+	uint8_t inside = OLED_RectInClip(x0 - r, y0 - r, x0 + r, y0 + r);
+
+	if (r <= 0)
+	{
+		OLED_PlotPixel(x0, y0, op, inside);
+		return;
+	}
 
-  OLED_SSD1306_DrawPixel(x0, y0 + r, c);
-  OLED_SSD1306_DrawPixel(x0, y0 - r, c);
-  OLED_SSD1306_DrawPixel(x0 + r, y0, c);
-  OLED_SSD1306_DrawPixel(x0 - r, y0, c);
+  OLED_PlotPixel(x0, y0 + r, op, inside);
+  OLED_PlotPixel(x0, y0 - r, op, inside);
+  OLED_PlotPixel(x0 + r, y0, op, inside);
+  OLED_PlotPixel(x0 - r, y0, op, inside);
 
   while (x < y) 
 	{
@@ -694,15 +3207,26 @@ void OLED_SSD1306_DrawCircle(int16_t x0, int16_t y0, int16_t r, OLED_COLOR_t c)
     ddF_x += 2;
     f += ddF_x;
 
-    OLED_SSD1306_DrawPixel(x0 + x, y0 + y, c);
-    OLED_SSD1306_DrawPixel(x0 - x, y0 + y, c);
-    OLED_SSD1306_DrawPixel(x0 + x, y0 - y, c);
-    OLED_SSD1306_DrawPixel(x0 - x, y0 - y, c);
+		/* Octants meet on the diagonal, plot each pixel only once so XOR circles erase cleanly */
+		if (x > y)
+		{
+			break;
+		}
+
+    OLED_PlotPixel(x0 + x, y0 + y, op, inside);
+    OLED_PlotPixel(x0 - x, y0 + y, op, inside);
+    OLED_PlotPixel(x0 + x, y0 - y, op, inside);
+    OLED_PlotPixel(x0 - x, y0 - y, op, inside);
 
-    OLED_SSD1306_DrawPixel(x0 + y, y0 + x, c);
-    OLED_SSD1306_DrawPixel(x0 - y, y0 + x, c);
-    OLED_SSD1306_DrawPixel(x0 + y, y0 - x, c);
-    OLED_SSD1306_DrawPixel(x0 - y, y0 - x, c);
+		if (x == y)
+		{
+			break;
+		}
+
+    OLED_PlotPixel(x0 + y, y0 + x, op, inside);
+    OLED_PlotPixel(x0 - y, y0 + x, op, inside);
+    OLED_PlotPixel(x0 + y, y0 - x, op, inside);
+    OLED_PlotPixel(x0 - y, y0 - x, op, inside);
 		
     }
 	
@@ -725,13 +3249,17 @@ void OLED_SSD1306_DrawFilledCircle(int16_t x0, int16_t y0, int16_t r, OLED_COLOR
 	int16_t ddF_y = -2 * r;
 	int16_t x = 0;
 	int16_t y = r;
+	int16_t px = 0, py = r;
+	OLED_SpanOp_t op = OLED_SpanOp(c);
+
+	if (r < 0)
+	{
+		return;
+	}
 
-  OLED_SSD1306_DrawPixel(x0, y0 + r, c);
-  OLED_SSD1306_DrawPixel(x0, y0 - r, c);
-  OLED_SSD1306_DrawPixel(x0 + r, y0, c);
-  OLED_SSD1306_DrawPixel(x0 - r, y0, c);
-  OLED_SSD1306_DrawLine(x0 - r, y0, x0 + r, y0, c);
+  OLED_FillRect(x0 - r, y0, x0 + r, y0, op);
 
+	/* Every row is filled exactly once: rows y0 +/- x as x steps, rows y0 +/- y only with their widest span */
   while (x < y) 
 	{
 		if (f >= 0) 
@@ -745,16 +3273,291 @@ void OLED_SSD1306_DrawFilledCircle(int16_t x0, int16_t y0, int16_t r, OLED_COLOR
      ddF_x += 2;
      f += ddF_x;
 
-     OLED_SSD1306_DrawLine(x0 - x, y0 + y, x0 + x, y0 + y, c);
-     OLED_SSD1306_DrawLine(x0 + x, y0 - y, x0 - x, y0 - y, c);
+     if (x <= y)
+     {
+       OLED_FillRect(x0 - y, y0 + x, x0 + y, y0 + x, op);
+       OLED_FillRect(x0 - y, y0 - x, x0 + y, y0 - x, op);
+     }
+
+     if (y != py)
+     {
+       OLED_FillRect(x0 - px, y0 + py, x0 + px, y0 + py, op);
+       OLED_FillRect(x0 - px, y0 - py, x0 + px, y0 - py, op);
+       py = y;
+     }
 
-     OLED_SSD1306_DrawLine(x0 + y, y0 + x, x0 - y, y0 + x, c);
-     OLED_SSD1306_DrawLine(x0 + y, y0 - x, x0 - y, y0 - x, c);
+     px = x;
     }
 }
 	
 
 
+/* 8x8 Bayer matrix scaled to thresholds: white when the gray value is above (index + 0.5) * 4 */
+static const uint8_t OLED_Bayer8[8][8] = {
+	{   2, 130,  34, 162,  10, 138,  42, 170 },
+	{ 194,  66, 226,  98, 202,  74, 234, 106 },
+	{  50, 178,  18, 146,  58, 186,  26, 154 },
+	{ 242, 114, 210,  82, 250, 122, 218,  90 },
+	{  14, 142,  46, 174,   6, 134,  38, 166 },
+	{ 206,  78, 238, 110, 198,  70, 230, 102 },
+	{  62, 190,  30, 158,  54, 182,  22, 150 },
+	{ 254, 126, 222,  94, 246, 118, 214,  86 }
+};
+
+/* Error rows for diffusion, 2 guard entries on each side. Row 0 is the current row */
+static int16_t OLED_DitherError[3][OLED_DITHER_MAX_WIDTH + 4];
+
+/* One page byte of dithered pixels per column of a strip */
+static uint8_t OLED_DitherBand[OLED_DITHER_MAX_WIDTH];
+
+
+/**
+ * @brief  Stores dithered pixels of one page byte: bits set in white are drawn white, the rest of mask black
+ */
+static void OLED_StoreGray8(int16_t x, int16_t page, uint8_t mask, uint8_t white, OLED_SpanOp_t op_white, OLED_SpanOp_t op_black)
+{
+	OLED_Canvas_t *target = OLED_SSD1306.Target;
+	uint8_t *p;
+	uint8_t m, b;
+	
+	if (OLED_SSD1306.Transposed)
+	{
+		/* A logical page byte is a physical row, go pixel by pixel */
+		for (b = 0; b < 8; b++)
+		{
+			if (mask & (1 << b))
+			{
+				OLED_PutPixel(x, page * 8 + b, (white & (1 << b)) ? op_white : op_black);
+			}
+		}
+		
+		return;
+	}
+	
+	p = &target->Buffer[x + page * target->Width];
+	m = white & mask;
+	*p = (*p & OLED_SPAN_AND(op_white, m)) ^ OLED_SPAN_XOR(op_white, m);
+	m = ~white & mask;
+	*p = (*p & OLED_SPAN_AND(op_black, m)) ^ OLED_SPAN_XOR(op_black, m);
+}
+
+
+/**
+ * @brief  Error diffusion of the visible part of an 8-bit image, columns x0..x1 and rows y0..y1 of the target
+ */
+static void OLED_DiffuseGray8(int16_t x, int16_t y, uint16_t w, const uint8_t *src, OLED_DITHER_t mode,
+                              int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                              OLED_SpanOp_t op_white, OLED_SpanOp_t op_black)
+{
+	int16_t *e0 = &OLED_DitherError[0][2];
+	int16_t *e1 = &OLED_DitherError[1][2];
+	int16_t *e2 = &OLED_DitherError[2][2];
+	int16_t *tmp;
+	const uint8_t *row;
+	int16_t n = x1 - x0 + 1;
+	int16_t i, yy, v, err, e7, e5, e3, e8;
+	uint8_t bit, mask;
+	
+	memset(OLED_DitherError, 0, sizeof(OLED_DitherError));
+	memset(OLED_DitherBand, 0, n);
+	
+	for (yy = y0; yy <= y1; yy++)
+	{
+		row = &src[(yy - y) * w + (x0 - x)];
+		bit = 1 << (yy & 7);
+		
+		for (i = 0; i < n; i++)
+		{
+			v = row[i] + e0[i];
+			
+			if (v > 127)
+			{
+				OLED_DitherBand[i] |= bit;
+				err = v - 255;
+			}
+			else
+			{
+				err = v;
+			}
+			
+			if (mode == OLED_DITHER_ATKINSON)
+			{
+				/* 1/8 to six neighbours, the remaining 2/8 are dropped */
+				e8 = err / 8;
+				e0[i + 1] += e8;
+				e0[i + 2] += e8;
+				e1[i - 1] += e8;
+				e1[i] += e8;
+				e1[i + 1] += e8;
+				e2[i] += e8;
+			}
+			else
+			{
+				/* Floyd-Steinberg 7/16, 3/16, 5/16 and the rest to 1/16 so no error is lost */
+				e7 = err * 7 / 16;
+				e3 = err * 3 / 16;
+				e5 = err * 5 / 16;
+				e0[i + 1] += e7;
+				e1[i - 1] += e3;
+				e1[i] += e5;
+				e1[i + 1] += err - e7 - e3 - e5;
+			}
+		}
+		
+		/* Page byte complete: store the band and start the next one */
+		if ((yy & 7) == 7 || yy == y1)
+		{
+			mask = OLED_PageRowMask(yy >> 3, y0, y1);
+			
+			for (i = 0; i < n; i++)
+			{
+				OLED_StoreGray8(x0 + i, yy >> 3, mask, OLED_DitherBand[i], op_white, op_black);
+			}
+			
+			memset(OLED_DitherBand, 0, n);
+		}
+		
+		/* Move the error rows up, the old current row becomes the cleared bottom row */
+		tmp = e0;
+		e0 = e1;
+		e1 = e2;
+		e2 = tmp;
+		memset(e2 - 2, 0, (OLED_DITHER_MAX_WIDTH + 4) * sizeof(int16_t));
+	}
+}
+
+
+/**
+ * @brief  Draws an 8-bit grayscale image, dithered to black and white
+ * @note   Writes whole page-major bytes of the target, 8 vertical pixels at a time. White pixels are drawn with
+ *         OLED_COLOR_WHITE and black ones with OLED_COLOR_BLACK under the current raster op, clipped like any
+ *         other primitive. Error diffusion starts at the first visible row and column and runs in strips of
+ *         OLED_DITHER_MAX_WIDTH columns.
+ *         @ref OLED_SSD1306_UpdateScreen() must be called after that in order to see updated LCD screen
+ * @param  x,y: Top left position, may be negative or partly outside the target
+ * @param  w,h: Image size in pixels
+ * @param  *src: w * h bytes, row by row, 0 is black and 255 is white
+ * @param  mode: Dithering method. This parameter can be a value of @ref OLED_DITHER_t enumeration
+ * @retval None
+ */
+void OLED_SSD1306_DrawGray8(int16_t x, int16_t y, uint16_t w, uint16_t h, const uint8_t* src, OLED_DITHER_t mode)
+{
+	OLED_SpanOp_t op_white = OLED_SpanOp(OLED_COLOR_WHITE);
+	OLED_SpanOp_t op_black = OLED_SpanOp(OLED_COLOR_BLACK);
+	int16_t x0 = x, y0 = y, x1 = x + (int16_t)w - 1, y1 = y + (int16_t)h - 1;
+	int16_t page, xx, sx;
+	uint8_t mask, white, b, b0, b1;
+	uint8_t threshold;
+	
+	/* Clip once, the loops below index the source without further checks */
+	if (x0 < OLED_SSD1306.ClipX0)
+	{
+		x0 = OLED_SSD1306.ClipX0;
+	}
+	if (y0 < OLED_SSD1306.ClipY0)
+	{
+		y0 = OLED_SSD1306.ClipY0;
+	}
+	if (x1 > OLED_SSD1306.ClipX1)
+	{
+		x1 = OLED_SSD1306.ClipX1;
+	}
+	if (y1 > OLED_SSD1306.ClipY1)
+	{
+		y1 = OLED_SSD1306.ClipY1;
+	}
+	
+	if (w == 0 || h == 0 || x0 > x1 || y0 > y1)
+	{
+		return;
+	}
+	
+	if (mode == OLED_DITHER_FLOYD_STEINBERG || mode == OLED_DITHER_ATKINSON)
+	{
+		for (sx = x0; sx <= x1; sx += OLED_DITHER_MAX_WIDTH)
+		{
+			OLED_DiffuseGray8(x, y, w, src, mode, sx, y0, (x1 - sx < OLED_DITHER_MAX_WIDTH) ? x1 : sx + OLED_DITHER_MAX_WIDTH - 1, y1,
+			                  op_white, op_black);
+		}
+		
+		return;
+	}
+	
+	/* Threshold and Bayer: each output byte straight from the 8 source pixels above each other */
+	for (page = y0 >> 3; page <= (y1 >> 3); page++)
+	{
+		mask = OLED_PageRowMask(page, y0, y1);
+		b0 = (y0 > page * 8) ? y0 - page * 8 : 0;
+		b1 = (y1 < page * 8 + 7) ? y1 - page * 8 : 7;
+		
+		for (xx = x0; xx <= x1; xx++)
+		{
+			const uint8_t *col = &src[(page * 8 + b0 - y) * w + (xx - x)];
+			white = 0;
+			
+			for (b = b0; b <= b1; b++, col += w)
+			{
+				threshold = (mode == OLED_DITHER_BAYER) ? OLED_Bayer8[b][xx & 7] : 127;
+				
+				if (*col > threshold)
+				{
+					white |= 1 << b;
+				}
+			}
+			
+			OLED_StoreGray8(xx, page, mask, white, op_white, op_black);
+		}
+	}
+}
+
+
+
+/* Ends an interrupt driven transfer and reports it to its owner */
+static void OLED_AsyncEnd(uint8_t error)
+{
+	OLED_AsyncCallback_t done = OLED_SSD1306.AsyncDone;
+	
+	OLED_SSD1306.AsyncBusy = 0;
+	
+	if (done != NULL)
+	{
+		done(error);
+	}
+}
+
+
+/* HAL I2C callbacks */
+void HAL_I2C_MasterTxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+	if (hi2c == &myI2Chandle)
+	{
+		OLED_AsyncEnd(0);
+	}
+}
+
+
+void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c)
+{
+	if (hi2c == &myI2Chandle && OLED_SSD1306.AsyncBusy)
+	{
+		OLED_AsyncEnd(1);
+	}
+}
+
+
+/* I2C1 Handlers */
+void I2C1_EV_IRQHandler(void)
+{
+	HAL_I2C_EV_IRQHandler(&myI2Chandle);
+}
+
+
+void I2C1_ER_IRQHandler(void)
+{
+	HAL_I2C_ER_IRQHandler(&myI2Chandle);
+}
+
+
 /*Systick Handler*/
 void SysTick_Handler(void)
 {
@@ -0,0 +1,601 @@
+/**
+  **********************************************************************************************************************
+   * @file   : oled_anim.c
+   * @author : Sharath N
+   * @brief  : Host animation encoder, turns a sequence of frames into an OLED_Anim_t stream for OLED_SSD1306_Anim
+  **********************************************************************************************************************
+*/
+
+/*
+          Build on the host:
+
+              gcc -std=c99 -O2 -Wall -pthread -o oled_anim oled_anim.c
+
+          Frames are PBM (P1/P4) or PGM (P2/P5) files of equal size, in playback order. For a video clip:
+
+              ffmpeg -i clip.mp4 -vf fps=15,scale=128:64 frames/%04d.pgm
+              oled_anim --fps 15 --dither bayer -o clip.c frames/????.pgm
+
+          writes clip.c with the frame stream and an OLED_Anim_t, and clip.h declaring it.
+
+          Every frame is encoded both as a keyframe and as the XOR delta to the frame before it, the smaller
+          one is kept. Loading and encoding run on all cores, each worker takes the next frame; the output
+          does not depend on the number of threads.
+
+          Options:
+              -n name              Symbol name, default: output file name without extension
+              -o file.c            Output file, the header gets the same name with .h
+              --fps n              Frames per second, default 10
+              --key n              Force a keyframe at least every n frames (for faster catching up), default 0: only frame 0
+              --threshold n        Gray level above which a pixel is set, default 127
+              --dither mode        none or bayer (ordered dither, stable from frame to frame), default none
+              --invert             Invert gray levels
+              -j n                 Worker threads, default: number of online CPUs
+*/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <ctype.h>
+#include <pthread.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/* Frame stream, see OLED_SSD1306_Anim.h */
+#define ANIM_KEYFRAME                0x00
+#define ANIM_DELTA                   0x01
+#define ANIM_HEADER_SIZE             3
+
+#define ANIM_MAX_SKIP                128
+#define ANIM_MAX_RUN                 64
+
+typedef struct {
+	const char *Path;
+	int Width, Height;
+	uint8_t *Pages;       /* Page-major frame, Width x pages bytes */
+	uint8_t *Code;        /* Encoded frame with its header */
+	size_t CodeSize;
+	int Key;
+} Frame_t;
+
+typedef struct {
+	Frame_t *Frames;
+	int Count;
+	int Next;
+	int Threshold;
+	int Dither;
+	int Invert;
+	int KeyEvery;
+	pthread_mutex_t Lock;
+} Job_t;
+
+
+static void Fail(const char *fmt, ...)
+{
+	va_list ap;
+
+	va_start(ap, fmt);
+	fprintf(stderr, "oled_anim: ");
+	vfprintf(stderr, fmt, ap);
+	fprintf(stderr, "\n");
+	va_end(ap);
+	exit(1);
+}
+
+
+static void *Alloc(size_t n)
+{
+	void *p = calloc(n ? n : 1, 1);
+
+	if (p == NULL)
+	{
+		Fail("out of memory");
+	}
+
+	return p;
+}
+
+
+/******************************************** Frame loading **************************************************/
+
+/* Next header number of a netpbm file, skipping white space and comments */
+static int PnmNumber(const char *path, const uint8_t *d, size_t n, size_t *pos)
+{
+	int v = 0, digits = 0;
+
+	while (*pos < n && (isspace(d[*pos]) || d[*pos] == '#'))
+	{
+		if (d[*pos] == '#')
+		{
+			while (*pos < n && d[*pos] != '\n')
+			{
+				(*pos)++;
+			}
+		}
+		else
+		{
+			(*pos)++;
+		}
+	}
+
+	while (*pos < n && isdigit(d[*pos]))
+	{
+		v = v * 10 + (d[(*pos)++] - '0');
+		digits++;
+	}
+
+	if (digits == 0)
+	{
+		Fail("%s: bad or truncated PBM/PGM file", path);
+	}
+
+	return v;
+}
+
+
+/* Loads a PBM/PGM frame as 8-bit gray, 0 black .. 255 white */
+static uint8_t *LoadGray(const char *path, int *w, int *h)
+{
+	FILE *f = fopen(path, "rb");
+	uint8_t *d, *gray;
+	size_t n, pos = 2;
+	long size;
+	int type, maxval = 1, x, y, v;
+
+	if (f == NULL)
+	{
+		Fail("cannot open %s", path);
+	}
+
+	fseek(f, 0, SEEK_END);
+	size = ftell(f);
+	fseek(f, 0, SEEK_SET);
+	d = Alloc((size_t)size + 1);
+	n = fread(d, 1, (size_t)size, f);
+	fclose(f);
+
+	if (n < 3 || d[0] != 'P' || !strchr("1245", d[1]))
+	{
+		Fail("%s: not a PBM or PGM file", path);
+	}
+
+	type = d[1] - '0';
+	*w = PnmNumber(path, d, n, &pos);
+	*h = PnmNumber(path, d, n, &pos);
+
+	if (type == 2 || type == 5)
+	{
+		maxval = PnmNumber(path, d, n, &pos);
+	}
+
+	if (*w <= 0 || *h <= 0 || *w > 128 || *h > 64 || maxval <= 0 || maxval > 255)
+	{
+		Fail("%s: %dx%d with maxval %d, frames must fit 128x64 with 8-bit gray", path, *w, *h, maxval);
+	}
+
+	gray = Alloc((size_t)*w * *h);
+
+	if (type >= 4)
+	{
+		pos++;
+	}
+
+	for (y = 0; y < *h; y++)
+	{
+		for (x = 0; x < *w; x++)
+		{
+			if (type == 1)
+			{
+				while (pos < n && isspace(d[pos]))
+				{
+					pos++;
+				}
+
+				v = (pos < n && d[pos++] == '1') ? 0 : 255;
+			}
+			else if (type == 4)
+			{
+				v = (pos + x / 8 < n && ((d[pos + x / 8] >> (7 - (x & 7))) & 1)) ? 0 : 255;
+			}
+			else if (type == 2)
+			{
+				v = PnmNumber(path, d, n, &pos) * 255 / maxval;
+			}
+			else
+			{
+				v = (pos < n) ? d[pos++] * 255 / maxval : 0;
+			}
+
+			gray[y * *w + x] = (uint8_t)v;
+		}
+
+		if (type == 4)
+		{
+			pos += (*w + 7) / 8;
+		}
+	}
+
+	free(d);
+	return gray;
+}
+
+
+/* Gray to page-major bits, Bayer thresholds as in OLED_SSD1306_DrawGray8() */
+static void Binarize(Frame_t *fr, const uint8_t *gray, const Job_t *job)
+{
+	static const uint8_t bayer[8][8] = {
+		{  0, 32,  8, 40,  2, 34, 10, 42 }, { 48, 16, 56, 24, 50, 18, 58, 26 },
+		{ 12, 44,  4, 36, 14, 46,  6, 38 }, { 60, 28, 52, 20, 62, 30, 54, 22 },
+		{  3, 35, 11, 43,  1, 33,  9, 41 }, { 51, 19, 59, 27, 49, 17, 57, 25 },
+		{ 15, 47,  7, 39, 13, 45,  5, 37 }, { 63, 31, 55, 23, 61, 29, 53, 21 }
+	};
+	int x, y, v, t;
+
+	fr->Pages = Alloc((size_t)fr->Width * ((fr->Height + 7) / 8));
+
+	for (y = 0; y < fr->Height; y++)
+	{
+		for (x = 0; x < fr->Width; x++)
+		{
+			v = gray[y * fr->Width + x];
+			v = job->Invert ? 255 - v : v;
+			t = job->Dither ? bayer[y & 7][x & 7] * 4 + 2 : job->Threshold;
+
+			if (v > t)
+			{
+				fr->Pages[x + (y / 8) * fr->Width] |= (uint8_t)(1 << (y & 7));
+			}
+		}
+	}
+}
+
+
+/********************************************** Encoding *****************************************************/
+
+/* Skip / copy / fill runs over v[0..n), trailing zeros are left out. Returns the payload size */
+static size_t EncodeRuns(const uint8_t *v, size_t n, uint8_t *out)
+{
+	size_t i = 0, o = 0, r, lit;
+
+	/* Trailing zeros are implied by the end of the payload */
+	while (n && v[n - 1] == 0)
+	{
+		n--;
+	}
+
+	while (i < n)
+	{
+		if (v[i] == 0)
+		{
+			for (r = 1; i + r < n && r < ANIM_MAX_SKIP && v[i + r] == 0; r++)
+			{
+			}
+
+			out[o++] = (uint8_t)(r - 1);
+			i += r;
+			continue;
+		}
+
+		for (r = 1; i + r < n && r < ANIM_MAX_RUN && v[i + r] == v[i]; r++)
+		{
+		}
+
+		if (r >= 3)
+		{
+			out[o++] = (uint8_t)(0xC0 | (r - 1));
+			out[o++] = v[i];
+			i += r;
+			continue;
+		}
+
+		/* Literal bytes up to the next zero or run of 3 */
+		for (lit = 1; i + lit < n && lit < ANIM_MAX_RUN && v[i + lit] != 0; lit++)
+		{
+			if (i + lit + 2 < n && v[i + lit] == v[i + lit + 1] && v[i + lit] == v[i + lit + 2])
+			{
+				break;
+			}
+		}
+
+		out[o++] = (uint8_t)(0x80 | (lit - 1));
+		memcpy(&out[o], &v[i], lit);
+		o += lit;
+		i += lit;
+	}
+
+	return o;
+}
+
+
+static void EncodeFrame(Job_t *job, int i)
+{
+	Frame_t *fr = &job->Frames[i];
+	size_t n = (size_t)fr->Width * ((fr->Height + 7) / 8), key_size, delta_size = (size_t)-1, k;
+	uint8_t *key = Alloc(2 * n + 8), *delta = Alloc(2 * n + 8), *diff;
+
+	key_size = EncodeRuns(fr->Pages, n, key);
+
+	if (i > 0 && !(job->KeyEvery > 0 && i % job->KeyEvery == 0))
+	{
+		diff = Alloc(n);
+
+		for (k = 0; k < n; k++)
+		{
+			diff[k] = fr->Pages[k] ^ job->Frames[i - 1].Pages[k];
+		}
+
+		delta_size = EncodeRuns(diff, n, delta);
+		free(diff);
+	}
+
+	/* Keyframes win ties, they let the player catch up */
+	fr->Key = (key_size <= delta_size);
+	fr->CodeSize = ANIM_HEADER_SIZE + (fr->Key ? key_size : delta_size);
+	fr->Code = Alloc(fr->CodeSize);
+	fr->Code[0] = fr->Key ? ANIM_KEYFRAME : ANIM_DELTA;
+	fr->Code[1] = (uint8_t)((fr->CodeSize - ANIM_HEADER_SIZE) & 0xFF);
+	fr->Code[2] = (uint8_t)((fr->CodeSize - ANIM_HEADER_SIZE) >> 8);
+	memcpy(&fr->Code[ANIM_HEADER_SIZE], fr->Key ? key : delta, fr->CodeSize - ANIM_HEADER_SIZE);
+
+	free(key);
+	free(delta);
+}
+
+
+/* Worker: takes frames in order until none are left */
+static int TakeFrame(Job_t *job)
+{
+	int i;
+
+	pthread_mutex_lock(&job->Lock);
+	i = (job->Next < job->Count) ? job->Next++ : -1;
+	pthread_mutex_unlock(&job->Lock);
+
+	return i;
+}
+
+
+static void *LoadWorker(void *arg)
+{
+	Job_t *job = arg;
+	uint8_t *gray;
+	int i;
+
+	while ((i = TakeFrame(job)) >= 0)
+	{
+		gray = LoadGray(job->Frames[i].Path, &job->Frames[i].Width, &job->Frames[i].Height);
+		Binarize(&job->Frames[i], gray, job);
+		free(gray);
+	}
+
+	return NULL;
+}
+
+
+static void *EncodeWorker(void *arg)
+{
+	Job_t *job = arg;
+	int i;
+
+	while ((i = TakeFrame(job)) >= 0)
+	{
+		EncodeFrame(job, i);
+	}
+
+	return NULL;
+}
+
+
+/* Runs one pass over all frames on the given number of threads */
+static void RunPass(Job_t *job, void *(*worker)(void *), int threads)
+{
+	pthread_t *t = Alloc(threads * sizeof(pthread_t));
+	int i;
+
+	job->Next = 0;
+
+	for (i = 0; i < threads; i++)
+	{
+		if (pthread_create(&t[i], NULL, worker, job) != 0)
+		{
+			Fail("cannot start a worker thread");
+		}
+	}
+
+	for (i = 0; i < threads; i++)
+	{
+		pthread_join(t[i], NULL);
+	}
+
+	free(t);
+}
+
+
+/************************************************ Main *******************************************************/
+
+static void Usage(void)
+{
+	fprintf(stderr,
+	        "usage: oled_anim [options] -o output.c frame0.pgm frame1.pgm ...\n"
+	        "  -n name  --fps n  --key n  --threshold n  --dither none|bayer  --invert  -j threads\n");
+	exit(2);
+}
+
+
+int main(int argc, char **argv)
+{
+	Job_t job;
+	const char *output = NULL, *name = NULL, *s;
+	char sym[256], path[1024], guard[256];
+	int fps = 10, threads = (int)sysconf(_SC_NPROCESSORS_ONLN), a, i, keys = 0;
+	size_t total = 0, k, n;
+	FILE *f, *h;
+
+	memset(&job, 0, sizeof(job));
+	job.Threshold = 127;
+	job.Frames = Alloc(argc * sizeof(Frame_t));
+
+	for (a = 1; a < argc; a++)
+	{
+		if (!strcmp(argv[a], "-n") && a + 1 < argc)
+		{
+			name = argv[++a];
+		}
+		else if (!strcmp(argv[a], "-o") && a + 1 < argc)
+		{
+			output = argv[++a];
+		}
+		else if (!strcmp(argv[a], "--fps") && a + 1 < argc)
+		{
+			fps = atoi(argv[++a]);
+		}
+		else if (!strcmp(argv[a], "--key") && a + 1 < argc)
+		{
+			job.KeyEvery = atoi(argv[++a]);
+		}
+		else if (!strcmp(argv[a], "--threshold") && a + 1 < argc)
+		{
+			job.Threshold = atoi(argv[++a]);
+		}
+		else if (!strcmp(argv[a], "--dither") && a + 1 < argc)
+		{
+			a++;
+
+			if (strcmp(argv[a], "none") && strcmp(argv[a], "bayer"))
+			{
+				Usage();
+			}
+
+			job.Dither = !strcmp(argv[a], "bayer");
+		}
+		else if (!strcmp(argv[a], "--invert"))
+		{
+			job.Invert = 1;
+		}
+		else if (!strcmp(argv[a], "-j") && a + 1 < argc)
+		{
+			threads = atoi(argv[++a]);
+		}
+		else if (argv[a][0] == '-')
+		{
+			Usage();
+		}
+		else
+		{
+			job.Frames[job.Count++].Path = argv[a];
+		}
+	}
+
+	n = output ? strlen(output) : 0;
+
+	if (job.Count == 0 || n < 3 || strcmp(output + n - 2, ".c") || n >= sizeof(path) || fps <= 0 || fps > 1000)
+	{
+		Usage();
+	}
+
+	if (job.Count > 65535)
+	{
+		Fail("at most 65535 frames");
+	}
+
+	if (threads < 1)
+	{
+		threads = 1;
+	}
+
+	/* Default symbol name: output file name without extension, made a C identifier */
+	if (name == NULL)
+	{
+		s = strrchr(output, '/');
+		snprintf(sym, sizeof(sym), "%s", s ? s + 1 : output);
+		sym[strlen(sym) - 2] = '\0';
+
+		for (k = 0; sym[k]; k++)
+		{
+			if (!isalnum((unsigned char)sym[k]))
+			{
+				sym[k] = '_';
+			}
+		}
+
+		name = sym;
+	}
+
+	pthread_mutex_init(&job.Lock, NULL);
+
+	/* Deltas need the previous frame's bits, so all frames are loaded before any is encoded */
+	RunPass(&job, LoadWorker, threads);
+
+	for (i = 1; i < job.Count; i++)
+	{
+		if (job.Frames[i].Width != job.Frames[0].Width || job.Frames[i].Height != job.Frames[0].Height)
+		{
+			Fail("%s is %dx%d, the first frame is %dx%d", job.Frames[i].Path, job.Frames[i].Width,
+			     job.Frames[i].Height, job.Frames[0].Width, job.Frames[0].Height);
+		}
+	}
+
+	RunPass(&job, EncodeWorker, threads);
+
+	f = fopen(output, "wb");
+	memcpy(path, output, n + 1);
+	path[n - 1] = 'h';
+	h = fopen(path, "wb");
+
+	if (f == NULL || h == NULL)
+	{
+		Fail("cannot write %s", (f == NULL) ? output : path);
+	}
+
+	fprintf(f, "/* Generated by oled_anim, do not edit */\n\n#include \"OLED_SSD1306_Anim.h\"\n\n");
+	fprintf(f, "static const uint8_t %s_Data[] = {\n", name);
+
+	for (i = 0; i < job.Count; i++)
+	{
+		Frame_t *fr = &job.Frames[i];
+
+		fprintf(f, "\t/* %d, %s, %lu bytes */\n", i, fr->Key ? "key" : "delta", (unsigned long)fr->CodeSize);
+
+		for (k = 0; k < fr->CodeSize; k++)
+		{
+			fprintf(f, "%s0x%02X,%s", (k % 16 == 0) ? "\t" : "", fr->Code[k],
+			        (k % 16 == 15 || k == fr->CodeSize - 1) ? "\n" : " ");
+		}
+
+		total += fr->CodeSize;
+		keys += fr->Key;
+	}
+
+	fprintf(f, "};\n\nconst OLED_Anim_t %s = { %d, %d, %d, %d, %s_Data };\n", name, job.Frames[0].Width,
+	        job.Frames[0].Height, job.Count, 1000 / fps, name);
+	fclose(f);
+
+	for (k = 0; name[k] && k < sizeof(guard) - 3; k++)
+	{
+		guard[k] = (char)toupper((unsigned char)name[k]);
+	}
+
+	strcpy(&guard[k], "_H");
+	fprintf(h, "/* Generated by oled_anim, do not edit */\n\n#ifndef %s\n#define %s\n\n#include \"OLED_SSD1306_Anim.h\"\n\n",
+	        guard, guard);
+	fprintf(h, "/* %d frames of %dx%d at %d fps, %lu bytes */\nextern const OLED_Anim_t %s;\n\n#endif\n", job.Count,
+	        job.Frames[0].Width, job.Frames[0].Height, fps, (unsigned long)total, name);
+	fclose(h);
+
+	n = (size_t)job.Frames[0].Width * ((job.Frames[0].Height + 7) / 8) * job.Count;
+	fprintf(stderr, "%s: %d frames (%d keyframes), %lu bytes, %.1f%% of %lu raw\n", name, job.Count, keys,
+	        (unsigned long)total, 100.0 * total / n, (unsigned long)n);
+
+	for (i = 0; i < job.Count; i++)
+	{
+		free(job.Frames[i].Pages);
+		free(job.Frames[i].Code);
+	}
+
+	free(job.Frames);
+	pthread_mutex_destroy(&job.Lock);
+	return 0;
+}
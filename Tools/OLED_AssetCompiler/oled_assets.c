@@ -0,0 +1,1974 @@
+/**
+  **********************************************************************************************************************
+   * @file   : oled_assets.c
+   * @author : Sharath N
+   * @brief  : Host asset compiler, converts images and BDF fonts into page-major C arrays for the SSD1306 OLED Driver
+  **********************************************************************************************************************
+*/
+
+/*
+          Build on the host (no dependencies besides the C library):
+
+              gcc -std=c99 -O2 -Wall -o oled_assets oled_assets.c
+
+          Images (PBM P1/P4, PGM P2/P5, PNG gray/RGB/palette with or without alpha, not interlaced):
+
+              oled_assets [options] logo.png -o logo.c
+
+          writes logo.c with a const page-major array and an OLED_Bitmap_t descriptor, and logo.h declaring it.
+          A PNG alpha channel (or tRNS) becomes the transparency mask.
+
+          BDF fonts:
+
+              oled_assets [options] font.bdf -o font.c
+
+          writes one OLED_Bitmap_t per character cell (page-major) and, with --legacy, an OLED_FontDef_t
+          for Putc(): the row-major table plus, unless compressed, the page-major cells as its glyphs.
+
+          Options:
+              -n name              Symbol name, default: input file name without extension
+              -o file.c            Output file, the header gets the same name with .h. Default: stdout, no header
+              --crop x,y,w,h       Crop the image before anything else
+              --trim               Remove border rows and columns without set (or opaque) pixels
+              --invert             Invert gray levels before dithering (dark art on a light background)
+              --threshold n        Gray level above which a pixel is set, default 127
+              --dither mode        none, bayer, fs (Floyd-Steinberg) or atkinson, default none
+              --rle                PackBits compress (OLED_BITMAP_PAGE_MAJOR_RLE), any bitmap
+              --lz                 LZ compress (OLED_BITMAP_PAGE_MAJOR_LZ), any bitmap
+              --report             Only print raw, PackBits and LZ sizes, for any number of images
+              --chars first-last   Character range of a font, default 32-126
+              --legacy             Also emit the row-major OLED_FontDef_t table, fonts up to 16 pixels wide from char 32
+              --proportional       Also emit a proportional OLED_FontDef_t: glyphs cropped to their ink, BDF advances
+
+          To choose a compression for a set of images, e.g. full screen help pages:
+
+              oled_assets --report help/page??.pbm
+
+          lists raw, PackBits and LZ sizes per image and in total. Decode times are measured on the target
+          by OLED_BENCH_RunUnpack().
+
+          The output only depends on the input bytes and the options: no dates, no paths, fixed formatting,
+          so regenerated files diff cleanly.
+*/
+
+#include <ctype.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+/********************************************** Common helpers ***********************************************/
+
+/* 8-bit gray image with alpha, the common input of all converters */
+typedef struct {
+	int Width;
+	int Height;
+	uint8_t *Gray;    /* 0 black .. 255 white */
+	uint8_t *Alpha;   /* 0 transparent .. 255 opaque */
+	int HasAlpha;
+} Image_t;
+
+/* Dithering modes, same algorithms and thresholds as OLED_SSD1306_DrawGray8() */
+enum { DITHER_NONE, DITHER_BAYER, DITHER_FS, DITHER_ATKINSON };
+
+/* Compression, with the OLED_Bitmap_t format it produces */
+enum { PACK_NONE, PACK_RLE, PACK_LZ };
+
+static const char *const PackFormat[] = { "OLED_BITMAP_PAGE_MAJOR", "OLED_BITMAP_PAGE_MAJOR_RLE", "OLED_BITMAP_PAGE_MAJOR_LZ" };
+static const char *const PackName[] = { "", " (PackBits)", " (LZ)" };
+
+typedef struct {
+	const char *Name;
+	const char *Output;
+	int CropX, CropY, CropW, CropH;
+	int Trim;
+	int Invert;
+	int Threshold;
+	int Dither;
+	int Pack;
+	int Report;
+	int FirstChar, LastChar;
+	int Legacy;
+	int Proportional;
+} Options_t;
+
+
+static void Fail(const char *fmt, ...)
+{
+	va_list ap;
+
+	va_start(ap, fmt);
+	fprintf(stderr, "oled_assets: ");
+	vfprintf(stderr, fmt, ap);
+	fprintf(stderr, "\n");
+	va_end(ap);
+	exit(1);
+}
+
+
+static void *Alloc(size_t n)
+{
+	void *p = calloc(n ? n : 1, 1);
+
+	if (p == NULL)
+	{
+		Fail("out of memory");
+	}
+
+	return p;
+}
+
+
+static uint8_t *ReadFile(const char *path, size_t *size)
+{
+	FILE *f = fopen(path, "rb");
+	uint8_t *data;
+	long n;
+
+	if (f == NULL)
+	{
+		Fail("cannot open %s", path);
+	}
+
+	fseek(f, 0, SEEK_END);
+	n = ftell(f);
+	fseek(f, 0, SEEK_SET);
+	data = Alloc((size_t)n + 1);
+
+	if (fread(data, 1, (size_t)n, f) != (size_t)n)
+	{
+		Fail("cannot read %s", path);
+	}
+
+	fclose(f);
+	*size = (size_t)n;
+	return data;
+}
+
+
+static Image_t NewImage(int w, int h)
+{
+	Image_t img;
+
+	if (w <= 0 || h <= 0 || w > 32767 || h > 32767)
+	{
+		Fail("bad image size %dx%d", w, h);
+	}
+
+	img.Width = w;
+	img.Height = h;
+	img.Gray = Alloc((size_t)w * h);
+	img.Alpha = Alloc((size_t)w * h);
+	img.HasAlpha = 0;
+	memset(img.Alpha, 255, (size_t)w * h);
+	return img;
+}
+
+
+/************************************************ PBM / PGM **************************************************/
+
+/* Next header number of a netpbm file, skipping white space and comments */
+static int PnmNumber(const uint8_t *d, size_t n, size_t *pos)
+{
+	int v = 0, digits = 0;
+
+	while (*pos < n)
+	{
+		if (d[*pos] == '#')
+		{
+			while (*pos < n && d[*pos] != '\n')
+			{
+				(*pos)++;
+			}
+		}
+		else if (isspace(d[*pos]))
+		{
+			(*pos)++;
+		}
+		else
+		{
+			break;
+		}
+	}
+
+	while (*pos < n && isdigit(d[*pos]))
+	{
+		v = v * 10 + (d[(*pos)++] - '0');
+		digits++;
+	}
+
+	if (digits == 0)
+	{
+		Fail("bad PBM/PGM header");
+	}
+
+	return v;
+}
+
+
+static Image_t LoadPnm(const uint8_t *d, size_t n)
+{
+	Image_t img;
+	size_t pos = 2;
+	int type = d[1] - '0';
+	int w, h, maxval = 1, x, y, v;
+
+	w = PnmNumber(d, n, &pos);
+	h = PnmNumber(d, n, &pos);
+
+	if (type == 2 || type == 5)
+	{
+		maxval = PnmNumber(d, n, &pos);
+
+		if (maxval <= 0 || maxval > 65535)
+		{
+			Fail("bad PGM maxval %d", maxval);
+		}
+	}
+
+	img = NewImage(w, h);
+
+	/* Binary formats: exactly one white space byte before the raster */
+	if (type >= 4)
+	{
+		pos++;
+	}
+
+	for (y = 0; y < h; y++)
+	{
+		for (x = 0; x < w; x++)
+		{
+			switch (type)
+			{
+				case 1:
+					/* 1 is black in PBM */
+					while (pos < n && (isspace(d[pos]) || d[pos] == '#'))
+					{
+						if (d[pos] == '#')
+						{
+							while (pos < n && d[pos] != '\n')
+							{
+								pos++;
+							}
+						}
+						else
+						{
+							pos++;
+						}
+					}
+
+					if (pos >= n)
+					{
+						Fail("truncated PBM");
+					}
+
+					v = (d[pos++] == '1') ? 0 : 255;
+					break;
+
+				case 4:
+					if (pos + (size_t)(x / 8) >= n)
+					{
+						Fail("truncated PBM");
+					}
+
+					v = ((d[pos + x / 8] >> (7 - (x & 7))) & 1) ? 0 : 255;
+					break;
+
+				case 2:
+					v = PnmNumber(d, n, &pos) * 255 / maxval;
+					break;
+
+				default:
+					if (maxval > 255)
+					{
+						if (pos + 1 >= n)
+						{
+							Fail("truncated PGM");
+						}
+
+						v = ((d[pos] << 8) | d[pos + 1]) * 255 / maxval;
+						pos += 2;
+					}
+					else
+					{
+						if (pos >= n)
+						{
+							Fail("truncated PGM");
+						}
+
+						v = d[pos++] * 255 / maxval;
+					}
+					break;
+			}
+
+			img.Gray[y * w + x] = (uint8_t)v;
+		}
+
+		if (type == 4)
+		{
+			pos += (w + 7) / 8;
+		}
+	}
+
+	return img;
+}
+
+
+/************************************************** Inflate **************************************************/
+
+/* Canonical Huffman table: symbol counts per length and symbols sorted by code */
+typedef struct {
+	uint16_t Count[16];
+	uint16_t Symbol[288];
+} Huffman_t;
+
+typedef struct {
+	const uint8_t *In;
+	size_t InSize, InPos;
+	uint32_t Bits;
+	int BitCount;
+	uint8_t *Out;
+	size_t OutSize, OutPos;
+} Inflate_t;
+
+
+static int InflateBits(Inflate_t *s, int n)
+{
+	uint32_t v;
+
+	while (s->BitCount < n)
+	{
+		if (s->InPos >= s->InSize)
+		{
+			Fail("truncated deflate stream");
+		}
+
+		s->Bits |= (uint32_t)s->In[s->InPos++] << s->BitCount;
+		s->BitCount += 8;
+	}
+
+	v = s->Bits & ((1u << n) - 1);
+	s->Bits >>= n;
+	s->BitCount -= n;
+	return (int)v;
+}
+
+
+static void HuffmanBuild(Huffman_t *h, const uint8_t *lengths, int n)
+{
+	uint16_t offs[16];
+	int i;
+
+	memset(h->Count, 0, sizeof(h->Count));
+
+	for (i = 0; i < n; i++)
+	{
+		h->Count[lengths[i]]++;
+	}
+
+	h->Count[0] = 0;
+	offs[1] = 0;
+
+	for (i = 1; i < 15; i++)
+	{
+		offs[i + 1] = offs[i] + h->Count[i];
+	}
+
+	for (i = 0; i < n; i++)
+	{
+		if (lengths[i])
+		{
+			h->Symbol[offs[lengths[i]]++] = (uint16_t)i;
+		}
+	}
+}
+
+
+static int HuffmanDecode(Inflate_t *s, const Huffman_t *h)
+{
+	int code = 0, first = 0, index = 0, len, count;
+
+	for (len = 1; len < 16; len++)
+	{
+		code |= InflateBits(s, 1);
+		count = h->Count[len];
+
+		if (code - count < first)
+		{
+			return h->Symbol[index + (code - first)];
+		}
+
+		index += count;
+		first += count;
+		first <<= 1;
+		code <<= 1;
+	}
+
+	Fail("bad Huffman code");
+	return 0;
+}
+
+
+static void InflatePut(Inflate_t *s, uint8_t b)
+{
+	if (s->OutPos >= s->OutSize)
+	{
+		s->OutSize = s->OutSize ? s->OutSize * 2 : 65536;
+		s->Out = realloc(s->Out, s->OutSize);
+
+		if (s->Out == NULL)
+		{
+			Fail("out of memory");
+		}
+	}
+
+	s->Out[s->OutPos++] = b;
+}
+
+
+static void InflateBlock(Inflate_t *s, const Huffman_t *lit, const Huffman_t *dist)
+{
+	static const uint16_t len_base[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+	                                       35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+	static const uint8_t len_extra[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+	                                       3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+	static const uint16_t dist_base[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+	                                        257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+	static const uint8_t dist_extra[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+	                                        7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+	int sym, len, d;
+
+	for (;;)
+	{
+		sym = HuffmanDecode(s, lit);
+
+		if (sym < 256)
+		{
+			InflatePut(s, (uint8_t)sym);
+		}
+		else if (sym == 256)
+		{
+			return;
+		}
+		else
+		{
+			sym -= 257;
+
+			if (sym >= 29)
+			{
+				Fail("bad deflate length");
+			}
+
+			len = len_base[sym] + InflateBits(s, len_extra[sym]);
+			sym = HuffmanDecode(s, dist);
+
+			if (sym >= 30)
+			{
+				Fail("bad deflate distance");
+			}
+
+			d = dist_base[sym] + InflateBits(s, dist_extra[sym]);
+
+			if ((size_t)d > s->OutPos)
+			{
+				Fail("deflate distance too far back");
+			}
+
+			while (len--)
+			{
+				InflatePut(s, s->Out[s->OutPos - d]);
+			}
+		}
+	}
+}
+
+
+/* zlib stream (2 byte header, deflate blocks, Adler-32 not checked) into a malloc'd buffer */
+static uint8_t *Inflate(const uint8_t *in, size_t n, size_t *out_size)
+{
+	static const uint8_t order[19] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+	Inflate_t s;
+	Huffman_t lit, dist;
+	uint8_t lengths[320];
+	int final, type, i, hlit, hdist, hclen, sym, prev, rep;
+	unsigned len;
+
+	if (n < 2 || (in[0] & 0x0F) != 8 || ((in[0] << 8) | in[1]) % 31 != 0)
+	{
+		Fail("bad zlib header");
+	}
+
+	memset(&s, 0, sizeof(s));
+	s.In = in;
+	s.InSize = n;
+	s.InPos = 2;
+
+	do
+	{
+		final = InflateBits(&s, 1);
+		type = InflateBits(&s, 2);
+
+		if (type == 0)
+		{
+			/* Stored block */
+			s.Bits = 0;
+			s.BitCount = 0;
+
+			if (s.InPos + 4 > n)
+			{
+				Fail("truncated deflate stream");
+			}
+
+			len = in[s.InPos] | (in[s.InPos + 1] << 8);
+			s.InPos += 4;
+
+			if (s.InPos + len > n)
+			{
+				Fail("truncated deflate stream");
+			}
+
+			while (len--)
+			{
+				InflatePut(&s, in[s.InPos++]);
+			}
+		}
+		else if (type == 1)
+		{
+			/* Fixed Huffman codes */
+			for (i = 0; i < 144; i++) lengths[i] = 8;
+			for (; i < 256; i++) lengths[i] = 9;
+			for (; i < 280; i++) lengths[i] = 7;
+			for (; i < 288; i++) lengths[i] = 8;
+			HuffmanBuild(&lit, lengths, 288);
+
+			for (i = 0; i < 30; i++) lengths[i] = 5;
+			HuffmanBuild(&dist, lengths, 30);
+
+			InflateBlock(&s, &lit, &dist);
+		}
+		else if (type == 2)
+		{
+			/* Dynamic Huffman codes */
+			hlit = InflateBits(&s, 5) + 257;
+			hdist = InflateBits(&s, 5) + 1;
+			hclen = InflateBits(&s, 4) + 4;
+
+			memset(lengths, 0, sizeof(lengths));
+
+			for (i = 0; i < hclen; i++)
+			{
+				lengths[order[i]] = (uint8_t)InflateBits(&s, 3);
+			}
+
+			HuffmanBuild(&lit, lengths, 19);
+			memset(lengths, 0, sizeof(lengths));
+
+			for (i = 0; i < hlit + hdist; )
+			{
+				sym = HuffmanDecode(&s, &lit);
+
+				if (sym < 16)
+				{
+					lengths[i++] = (uint8_t)sym;
+					continue;
+				}
+
+				prev = 0;
+
+				if (sym == 16)
+				{
+					if (i == 0)
+					{
+						Fail("bad deflate code lengths");
+					}
+
+					prev = lengths[i - 1];
+					rep = 3 + InflateBits(&s, 2);
+				}
+				else if (sym == 17)
+				{
+					rep = 3 + InflateBits(&s, 3);
+				}
+				else
+				{
+					rep = 11 + InflateBits(&s, 7);
+				}
+
+				if (i + rep > hlit + hdist)
+				{
+					Fail("bad deflate code lengths");
+				}
+
+				while (rep--)
+				{
+					lengths[i++] = (uint8_t)prev;
+				}
+			}
+
+			HuffmanBuild(&lit, lengths, hlit);
+			HuffmanBuild(&dist, lengths + hlit, hdist);
+			InflateBlock(&s, &lit, &dist);
+		}
+		else
+		{
+			Fail("bad deflate block type");
+		}
+	} while (!final);
+
+	*out_size = s.OutPos;
+	return s.Out;
+}
+
+
+/**************************************************** PNG ****************************************************/
+
+static uint32_t Be32(const uint8_t *p)
+{
+	return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+
+static int Paeth(int a, int b, int c)
+{
+	int p = a + b - c;
+	int pa = abs(p - a), pb = abs(p - b), pc = abs(p - c);
+
+	if (pa <= pb && pa <= pc)
+	{
+		return a;
+	}
+
+	return (pb <= pc) ? b : c;
+}
+
+
+static Image_t LoadPng(const uint8_t *d, size_t n)
+{
+	static const int channels_of[7] = { 1, 0, 3, 1, 2, 0, 4 };
+	uint8_t palette[256][4];
+	uint8_t *idat = NULL, *raw, *prev, *cur;
+	size_t idat_size = 0, raw_size, pos = 8, stride;
+	uint32_t len;
+	int w = 0, h = 0, depth = 0, ctype = -1, channels, bpp, x, y, c, i;
+	int trns_key = -1, trns_r = -1, trns_g = -1, trns_b = -1;
+	int r, g, b, a, maxv;
+	Image_t img;
+
+	memset(palette, 255, sizeof(palette));
+
+	while (pos + 8 <= n)
+	{
+		len = Be32(&d[pos]);
+
+		if (pos + 12 + len > n)
+		{
+			Fail("truncated PNG chunk");
+		}
+
+		if (!memcmp(&d[pos + 4], "IHDR", 4))
+		{
+			w = (int)Be32(&d[pos + 8]);
+			h = (int)Be32(&d[pos + 12]);
+			depth = d[pos + 16];
+			ctype = d[pos + 17];
+
+			if (d[pos + 20] != 0)
+			{
+				Fail("interlaced PNG is not supported, save it without interlacing");
+			}
+		}
+		else if (!memcmp(&d[pos + 4], "PLTE", 4))
+		{
+			for (i = 0; i < (int)len / 3 && i < 256; i++)
+			{
+				palette[i][0] = d[pos + 8 + i * 3];
+				palette[i][1] = d[pos + 9 + i * 3];
+				palette[i][2] = d[pos + 10 + i * 3];
+			}
+		}
+		else if (!memcmp(&d[pos + 4], "tRNS", 4))
+		{
+			if (ctype == 3)
+			{
+				for (i = 0; i < (int)len && i < 256; i++)
+				{
+					palette[i][3] = d[pos + 8 + i];
+				}
+			}
+			else if (ctype == 0 && len >= 2)
+			{
+				trns_key = (d[pos + 8] << 8) | d[pos + 9];
+			}
+			else if (ctype == 2 && len >= 6)
+			{
+				trns_r = (d[pos + 8] << 8) | d[pos + 9];
+				trns_g = (d[pos + 10] << 8) | d[pos + 11];
+				trns_b = (d[pos + 12] << 8) | d[pos + 13];
+			}
+		}
+		else if (!memcmp(&d[pos + 4], "IDAT", 4))
+		{
+			idat = realloc(idat, idat_size + len);
+
+			if (idat == NULL)
+			{
+				Fail("out of memory");
+			}
+
+			memcpy(idat + idat_size, &d[pos + 8], len);
+			idat_size += len;
+		}
+		else if (!memcmp(&d[pos + 4], "IEND", 4))
+		{
+			break;
+		}
+
+		pos += 12 + len;
+	}
+
+	if (ctype < 0 || ctype > 6 || channels_of[ctype] == 0 || idat == NULL)
+	{
+		Fail("unsupported or broken PNG");
+	}
+
+	channels = channels_of[ctype];
+	bpp = (channels * depth + 7) / 8;
+	stride = ((size_t)w * channels * depth + 7) / 8;
+	raw = Inflate(idat, idat_size, &raw_size);
+
+	if (raw_size < (stride + 1) * h)
+	{
+		Fail("PNG image data too short");
+	}
+
+	/* Undo the per row filters in place */
+	prev = NULL;
+
+	for (y = 0; y < h; y++)
+	{
+		cur = &raw[y * (stride + 1) + 1];
+
+		for (i = 0; i < (int)stride; i++)
+		{
+			a = (i >= bpp) ? cur[i - bpp] : 0;
+			b = prev ? prev[i] : 0;
+			c = (prev && i >= bpp) ? prev[i - bpp] : 0;
+
+			switch (cur[-1])
+			{
+				case 0: break;
+				case 1: cur[i] = (uint8_t)(cur[i] + a); break;
+				case 2: cur[i] = (uint8_t)(cur[i] + b); break;
+				case 3: cur[i] = (uint8_t)(cur[i] + ((a + b) >> 1)); break;
+				case 4: cur[i] = (uint8_t)(cur[i] + Paeth(a, b, c)); break;
+				default: Fail("bad PNG filter %d", cur[-1]);
+			}
+		}
+
+		prev = cur;
+	}
+
+	img = NewImage(w, h);
+	img.HasAlpha = (ctype == 4 || ctype == 6 || trns_key >= 0 || trns_r >= 0);
+	maxv = (1 << (depth > 8 ? 16 : depth)) - 1;
+
+	for (y = 0; y < h; y++)
+	{
+		cur = &raw[y * (stride + 1) + 1];
+
+		for (x = 0; x < w; x++)
+		{
+			int s[4];
+
+			/* Samples at full precision */
+			for (c = 0; c < channels; c++)
+			{
+				int bit = (x * channels + c) * depth;
+
+				if (depth == 16)
+				{
+					s[c] = (cur[bit / 8] << 8) | cur[bit / 8 + 1];
+				}
+				else if (depth == 8)
+				{
+					s[c] = cur[bit / 8];
+				}
+				else
+				{
+					s[c] = (cur[bit / 8] >> (8 - depth - (bit & 7))) & ((1 << depth) - 1);
+				}
+			}
+
+			a = 255;
+
+			if (ctype == 3)
+			{
+				r = palette[s[0]][0];
+				g = palette[s[0]][1];
+				b = palette[s[0]][2];
+				a = palette[s[0]][3];
+			}
+			else if (ctype == 0 || ctype == 4)
+			{
+				if (ctype == 0 && s[0] == trns_key)
+				{
+					a = 0;
+				}
+
+				r = g = b = s[0] * 255 / maxv;
+
+				if (ctype == 4)
+				{
+					a = s[1] * 255 / maxv;
+				}
+			}
+			else
+			{
+				if (ctype == 2 && s[0] == trns_r && s[1] == trns_g && s[2] == trns_b)
+				{
+					a = 0;
+				}
+
+				r = s[0] * 255 / maxv;
+				g = s[1] * 255 / maxv;
+				b = s[2] * 255 / maxv;
+
+				if (ctype == 6)
+				{
+					a = s[3] * 255 / maxv;
+				}
+			}
+
+			/* ITU-R BT.601 luma */
+			img.Gray[y * w + x] = (uint8_t)((r * 299 + g * 587 + b * 114 + 500) / 1000);
+			img.Alpha[y * w + x] = (uint8_t)a;
+		}
+	}
+
+	free(raw);
+	free(idat);
+	return img;
+}
+
+
+/************************************************* Processing ************************************************/
+
+static void Crop(Image_t *img, int x0, int y0, int w, int h)
+{
+	Image_t out;
+	int y;
+
+	if (x0 < 0 || y0 < 0 || w <= 0 || h <= 0 || x0 + w > img->Width || y0 + h > img->Height)
+	{
+		Fail("crop %d,%d,%d,%d is outside the %dx%d image", x0, y0, w, h, img->Width, img->Height);
+	}
+
+	out = NewImage(w, h);
+	out.HasAlpha = img->HasAlpha;
+
+	for (y = 0; y < h; y++)
+	{
+		memcpy(&out.Gray[y * w], &img->Gray[(y0 + y) * img->Width + x0], w);
+		memcpy(&out.Alpha[y * w], &img->Alpha[(y0 + y) * img->Width + x0], w);
+	}
+
+	free(img->Gray);
+	free(img->Alpha);
+	*img = out;
+}
+
+
+/* Gray to 1 bit, the same decisions as OLED_SSD1306_DrawGray8() for a bitmap drawn at 0,0 */
+static uint8_t *Binarize(const Image_t *img, const Options_t *opt)
+{
+	static const uint8_t bayer[8][8] = {
+		{  0, 32,  8, 40,  2, 34, 10, 42 }, { 48, 16, 56, 24, 50, 18, 58, 26 },
+		{ 12, 44,  4, 36, 14, 46,  6, 38 }, { 60, 28, 52, 20, 62, 30, 54, 22 },
+		{  3, 35, 11, 43,  1, 33,  9, 41 }, { 51, 19, 59, 27, 49, 17, 57, 25 },
+		{ 15, 47,  7, 39, 13, 45,  5, 37 }, { 63, 31, 55, 23, 61, 29, 53, 21 }
+	};
+	int w = img->Width, h = img->Height, x, y, v, err, e7, e5, e3, e8;
+	uint8_t *bits = Alloc((size_t)w * h);
+	int *e0 = Alloc((w + 4) * sizeof(int)) , *e1 = Alloc((w + 4) * sizeof(int)), *e2 = Alloc((w + 4) * sizeof(int)), *t;
+
+	for (y = 0; y < h; y++)
+	{
+		for (x = 0; x < w; x++)
+		{
+			v = img->Gray[y * w + x];
+
+			if (opt->Invert)
+			{
+				v = 255 - v;
+			}
+
+			switch (opt->Dither)
+			{
+				case DITHER_BAYER:
+					bits[y * w + x] = v > bayer[y & 7][x & 7] * 4 + 2;
+					break;
+
+				case DITHER_FS:
+				case DITHER_ATKINSON:
+					v += e0[x + 2];
+					bits[y * w + x] = v > 127;
+					err = (v > 127) ? v - 255 : v;
+
+					if (opt->Dither == DITHER_ATKINSON)
+					{
+						e8 = err / 8;
+						e0[x + 3] += e8;
+						e0[x + 4] += e8;
+						e1[x + 1] += e8;
+						e1[x + 2] += e8;
+						e1[x + 3] += e8;
+						e2[x + 2] += e8;
+					}
+					else
+					{
+						e7 = err * 7 / 16;
+						e3 = err * 3 / 16;
+						e5 = err * 5 / 16;
+						e0[x + 3] += e7;
+						e1[x + 1] += e3;
+						e1[x + 2] += e5;
+						e1[x + 3] += err - e7 - e3 - e5;
+					}
+					break;
+
+				default:
+					bits[y * w + x] = v > opt->Threshold;
+					break;
+			}
+		}
+
+		t = e0;
+		e0 = e1;
+		e1 = e2;
+		e2 = t;
+		memset(e2, 0, (w + 4) * sizeof(int));
+	}
+
+	free(e0);
+	free(e1);
+	free(e2);
+	return bits;
+}
+
+
+/* Removes border rows and columns that have no set or opaque pixel */
+static void Trim(Image_t *img, uint8_t **bits)
+{
+	int w = img->Width, h = img->Height, x, y, x0 = w, y0 = h, x1 = -1, y1 = -1;
+	uint8_t *out;
+
+	for (y = 0; y < h; y++)
+	{
+		for (x = 0; x < w; x++)
+		{
+			if ((*bits)[y * w + x] || (img->HasAlpha && img->Alpha[y * w + x] >= 128))
+			{
+				if (x < x0) x0 = x;
+				if (x > x1) x1 = x;
+				if (y < y0) y0 = y;
+				if (y > y1) y1 = y;
+			}
+		}
+	}
+
+	if (x1 < 0)
+	{
+		Fail("--trim: image has no set pixels");
+	}
+
+	out = Alloc((size_t)(x1 - x0 + 1) * (y1 - y0 + 1));
+
+	for (y = y0; y <= y1; y++)
+	{
+		memcpy(&out[(y - y0) * (x1 - x0 + 1)], &(*bits)[y * w + x0], x1 - x0 + 1);
+	}
+
+	free(*bits);
+	*bits = out;
+	Crop(img, x0, y0, x1 - x0 + 1, y1 - y0 + 1);
+}
+
+
+/* 0/1 pixels to the driver's page-major layout: byte x + page * w, row y & 7 in bit y & 7 */
+static uint8_t *PageMajor(const uint8_t *bits, int w, int h, size_t *size)
+{
+	int pages = (h + 7) / 8, x, y;
+	uint8_t *out = Alloc((size_t)w * pages);
+
+	for (y = 0; y < h; y++)
+	{
+		for (x = 0; x < w; x++)
+		{
+			if (bits[y * w + x])
+			{
+				out[x + (y / 8) * w] |= (uint8_t)(1 << (y & 7));
+			}
+		}
+	}
+
+	*size = (size_t)w * pages;
+	return out;
+}
+
+
+/* PackBits: runs of 2+ equal bytes become (1 - n, byte), everything else literal blocks of up to 128 */
+static uint8_t *PackBits(const uint8_t *in, size_t n, size_t *size)
+{
+	uint8_t *out = Alloc(2 * n + 2);
+	size_t i = 0, o = 0, run, lit;
+
+	while (i < n)
+	{
+		for (run = 1; i + run < n && run < 128 && in[i + run] == in[i]; run++)
+		{
+		}
+
+		if (run >= 2)
+		{
+			out[o++] = (uint8_t)(1 - (int)run);
+			out[o++] = in[i];
+			i += run;
+			continue;
+		}
+
+		/* Literal block up to the next run of 2 */
+		for (lit = 1; i + lit < n && lit < 128; lit++)
+		{
+			if (i + lit + 1 < n && in[i + lit] == in[i + lit + 1])
+			{
+				break;
+			}
+		}
+
+		out[o++] = (uint8_t)(lit - 1);
+		memcpy(&out[o], &in[i], lit);
+		o += lit;
+		i += lit;
+	}
+
+	*size = o;
+	return out;
+}
+
+
+/* Longest earlier match for in[i..], 3 to 18 bytes up to 1024 bytes back, the nearest of equal length */
+static size_t LzMatch(const uint8_t *in, size_t n, size_t i, size_t *dist)
+{
+	size_t d, len, best = 0;
+
+	for (d = 1; d <= 1024 && d <= i; d++)
+	{
+		for (len = 0; len < 18 && i + len < n && in[i + len] == in[i + len - d]; len++)
+		{
+		}
+
+		if (len > best)
+		{
+			best = len;
+			*dist = d;
+		}
+	}
+
+	return best;
+}
+
+
+/* Pending literal bytes in[i - lit .. i) as blocks of up to 128 */
+static size_t LzLiterals(const uint8_t *in, size_t i, size_t lit, uint8_t *out)
+{
+	if (lit == 0)
+	{
+		return 0;
+	}
+
+	out[0] = (uint8_t)(lit - 1);
+	memcpy(&out[1], &in[i - lit], lit);
+	return lit + 1;
+}
+
+
+/* LZ for OLED_BITMAP_PAGE_MAJOR_LZ: literal blocks, fills of 3 to 65 bytes and back references, see the driver */
+static uint8_t *PackLz(const uint8_t *in, size_t n, size_t *size)
+{
+	uint8_t *out = Alloc(2 * n + 2);
+	size_t i = 0, o = 0, lit = 0, run, len, dist = 0, next_dist;
+
+	while (i < n)
+	{
+		for (run = 1; i + run < n && run < 65 && in[i + run] == in[i]; run++)
+		{
+		}
+
+		len = LzMatch(in, n, i, &dist);
+
+		/* One byte lazy: a literal here may let the next byte start a longer match */
+		if (len >= 3 && run < len && i + 1 < n && LzMatch(in, n, i + 1, &next_dist) > len)
+		{
+			len = 0;
+			run = 1;
+		}
+
+		if (run >= 3 && run >= len)
+		{
+			o += LzLiterals(in, i, lit, &out[o]);
+			lit = 0;
+			out[o++] = (uint8_t)(0x80 | (run - 2));
+			out[o++] = in[i];
+			i += run;
+		}
+		else if (len >= 3)
+		{
+			o += LzLiterals(in, i, lit, &out[o]);
+			lit = 0;
+			out[o++] = (uint8_t)(0xC0 | ((len - 3) << 2) | ((dist - 1) >> 8));
+			out[o++] = (uint8_t)((dist - 1) & 0xFF);
+			i += len;
+		}
+		else
+		{
+			i++;
+
+			if (++lit == 128)
+			{
+				o += LzLiterals(in, i, lit, &out[o]);
+				lit = 0;
+			}
+		}
+	}
+
+	o += LzLiterals(in, i, lit, &out[o]);
+	*size = o;
+	return out;
+}
+
+
+/* Compressed copy of n page-major bytes, or a plain copy for PACK_NONE */
+static uint8_t *Compress(const uint8_t *raw, size_t n, int pack, size_t *size)
+{
+	uint8_t *out;
+
+	if (pack == PACK_RLE)
+	{
+		return PackBits(raw, n, size);
+	}
+
+	if (pack == PACK_LZ)
+	{
+		return PackLz(raw, n, size);
+	}
+
+	out = Alloc(n);
+	memcpy(out, raw, n);
+	*size = n;
+	return out;
+}
+
+
+/************************************************* Output ****************************************************/
+
+static void EmitBytes(FILE *f, const uint8_t *data, size_t n)
+{
+	size_t i;
+
+	for (i = 0; i < n; i++)
+	{
+		fprintf(f, "%s0x%02X,%s", (i % 16 == 0) ? "\t" : "", data[i], (i % 16 == 15 || i == n - 1) ? "\n" : " ");
+	}
+}
+
+
+/* Page-major data, optionally compressed, as a const array */
+static void EmitArray(FILE *f, const char *name, const uint8_t *bits, int w, int h, int pack, size_t *emitted)
+{
+	size_t raw_size, size;
+	uint8_t *raw = PageMajor(bits, w, h, &raw_size);
+	uint8_t *packed = Compress(raw, raw_size, pack, &size);
+
+	if (size > raw_size)
+	{
+		fprintf(stderr, "%s: compression made it larger (%lu > %lu bytes), consider storing it raw\n", name,
+		        (unsigned long)size, (unsigned long)raw_size);
+	}
+
+	fprintf(f, "static const uint8_t %s[%lu] = {\n", name, (unsigned long)size);
+	EmitBytes(f, packed, size);
+	fprintf(f, "};\n\n");
+
+	*emitted = size;
+	free(raw);
+	free(packed);
+}
+
+
+static FILE *OpenOutputs(const Options_t *opt, FILE **header)
+{
+	char path[1024];
+	FILE *f;
+	size_t n;
+
+	*header = NULL;
+
+	if (opt->Output == NULL)
+	{
+		return stdout;
+	}
+
+	/* Checked before anything is opened, a bad name must not truncate an existing file */
+	n = strlen(opt->Output);
+
+	if (n < 2 || n + 1 > sizeof(path) || strcmp(opt->Output + n - 2, ".c") != 0)
+	{
+		Fail("output file must end in .c");
+	}
+
+	f = fopen(opt->Output, "wb");
+
+	if (f == NULL)
+	{
+		Fail("cannot write %s", opt->Output);
+	}
+
+	memcpy(path, opt->Output, n + 1);
+	path[n - 1] = 'h';
+	*header = fopen(path, "wb");
+
+	if (*header == NULL)
+	{
+		Fail("cannot write %s", path);
+	}
+
+	return f;
+}
+
+
+static void EmitHeaderStart(FILE *h, const char *name, const char *source)
+{
+	char guard[256];
+	size_t i;
+
+	for (i = 0; name[i] && i < sizeof(guard) - 3; i++)
+	{
+		guard[i] = (char)toupper((unsigned char)name[i]);
+	}
+
+	strcpy(&guard[i], "_H");
+	fprintf(h, "/* Generated by oled_assets from %s, do not edit */\n\n", source);
+	fprintf(h, "#ifndef %s\n#define %s\n\n#include \"STM32F407_OLED_SSD1306_Driver.h\"\n\n", guard, guard);
+}
+
+
+static const char *BaseName(const char *path)
+{
+	const char *s = strrchr(path, '/');
+	const char *b = strrchr(path, '\\');
+
+	if (b != NULL && (s == NULL || b > s))
+	{
+		s = b;
+	}
+
+	return s ? s + 1 : path;
+}
+
+
+/* Loads, crops, dithers and trims an image. Returns its 0/1 pixels, *mask is NULL without transparency */
+static uint8_t *ConvertImage(const char *path, const Options_t *opt, Image_t *out, uint8_t **mask)
+{
+	size_t size;
+	uint8_t *file = ReadFile(path, &size);
+	uint8_t *bits;
+	Image_t img;
+	int i;
+
+	if (size >= 8 && !memcmp(file, "\x89PNG\r\n\x1a\n", 8))
+	{
+		img = LoadPng(file, size);
+	}
+	else if (size >= 2 && file[0] == 'P' && strchr("1245", file[1]) != NULL)
+	{
+		img = LoadPnm(file, size);
+	}
+	else
+	{
+		Fail("%s: not a PBM, PGM or PNG file", path);
+		return NULL;
+	}
+
+	if (opt->CropW > 0)
+	{
+		Crop(&img, opt->CropX, opt->CropY, opt->CropW, opt->CropH);
+	}
+
+	bits = Binarize(&img, opt);
+
+	if (opt->Trim)
+	{
+		Trim(&img, &bits);
+	}
+
+	*mask = NULL;
+
+	if (img.HasAlpha)
+	{
+		*mask = Alloc((size_t)img.Width * img.Height);
+
+		for (i = 0; i < img.Width * img.Height; i++)
+		{
+			(*mask)[i] = img.Alpha[i] >= 128;
+		}
+	}
+
+	free(file);
+	*out = img;
+	return bits;
+}
+
+
+static void CompileImage(const char *path, const Options_t *opt)
+{
+	size_t data_size, mask_size = 0;
+	uint8_t *bits, *mask;
+	char sym[300];
+	Image_t img;
+	FILE *f, *h;
+
+	bits = ConvertImage(path, opt, &img, &mask);
+
+	f = OpenOutputs(opt, &h);
+	fprintf(f, "/* Generated by oled_assets from %s, do not edit */\n\n", BaseName(path));
+	fprintf(f, "#include \"STM32F407_OLED_SSD1306_Driver.h\"\n\n");
+
+	snprintf(sym, sizeof(sym), "%s_Data", opt->Name);
+	EmitArray(f, sym, bits, img.Width, img.Height, opt->Pack, &data_size);
+
+	if (mask != NULL)
+	{
+		snprintf(sym, sizeof(sym), "%s_Mask", opt->Name);
+		EmitArray(f, sym, mask, img.Width, img.Height, opt->Pack, &mask_size);
+	}
+
+	fprintf(f, "const OLED_Bitmap_t %s = { %d, %d, %s, %s_Data, ", opt->Name, img.Width, img.Height, PackFormat[opt->Pack], opt->Name);
+	fprintf(f, (mask != NULL) ? "%s_Mask };\n" : "NULL };\n", opt->Name);
+
+	if (h != NULL)
+	{
+		EmitHeaderStart(h, opt->Name, BaseName(path));
+		fprintf(h, "/* %dx%d, %lu bytes */\nextern const OLED_Bitmap_t %s;\n\n#endif\n",
+		        img.Width, img.Height, (unsigned long)(data_size + mask_size), opt->Name);
+		fclose(h);
+	}
+
+	if (f != stdout)
+	{
+		fclose(f);
+	}
+
+	fprintf(stderr, "%s: %dx%d, %lu bytes%s\n", opt->Name, img.Width, img.Height,
+	        (unsigned long)(data_size + mask_size), PackName[opt->Pack]);
+
+	free(bits);
+	free(mask);
+	free(img.Gray);
+	free(img.Alpha);
+}
+
+
+/* One line of --report: raw, PackBits and LZ sizes of an image, added to totals[] */
+static void ReportImage(const char *path, const Options_t *opt, size_t totals[3])
+{
+	size_t raw_size, size[3];
+	uint8_t *bits, *mask, *raw, *packed;
+	Image_t img;
+	int pack;
+
+	bits = ConvertImage(path, opt, &img, &mask);
+	raw = PageMajor(bits, img.Width, img.Height, &raw_size);
+
+	for (pack = PACK_NONE; pack <= PACK_LZ; pack++)
+	{
+		packed = Compress(raw, raw_size, pack, &size[pack]);
+		totals[pack] += size[pack];
+		free(packed);
+	}
+
+	printf("%-24s %3dx%-3d %6lu %6lu %5.1f%% %6lu %5.1f%%%s\n", BaseName(path), img.Width, img.Height,
+	       (unsigned long)size[0], (unsigned long)size[1], 100.0 * size[1] / size[0], (unsigned long)size[2],
+	       100.0 * size[2] / size[0], (mask != NULL) ? "  mask not counted" : "");
+
+	free(raw);
+	free(bits);
+	free(mask);
+	free(img.Gray);
+	free(img.Alpha);
+}
+
+
+/************************************************** BDF ******************************************************/
+
+typedef struct {
+	int CellW, CellH, Ascent;
+	int OriginX;        /* Pen position relative to the left edge of the cells (FONTBOUNDINGBOX x offset) */
+	int First, Last;
+	uint8_t *Cells;     /* (Last - First + 1) cells of CellW x CellH 0/1 pixels */
+	uint8_t *Present;
+	int *Advance;       /* DWIDTH of every character, CellW when the font has none */
+} Font_t;
+
+
+static int StartsWith(const char *line, const char *key)
+{
+	size_t n = strlen(key);
+
+	return !strncmp(line, key, n) && (line[n] == ' ' || line[n] == '\n' || line[n] == '\r' || line[n] == '\0');
+}
+
+
+static Font_t LoadBdf(const char *path, const Options_t *opt)
+{
+	FILE *in = fopen(path, "rb");
+	char line[1024];
+	Font_t font;
+	int fbx = 0, fby = 0, fbw = 0, fbh = 0, enc = -1, bw = 0, bh = 0, bx = 0, by = 0, row = -1;
+	int ascent = -1, x, cx, cy, v, nibbles;
+	uint8_t *cell = NULL;
+
+	if (in == NULL)
+	{
+		Fail("cannot open %s", path);
+	}
+
+	memset(&font, 0, sizeof(font));
+	font.First = opt->FirstChar;
+	font.Last = opt->LastChar;
+
+	while (fgets(line, sizeof(line), in) != NULL)
+	{
+		if (StartsWith(line, "FONTBOUNDINGBOX"))
+		{
+			sscanf(line + 15, "%d %d %d %d", &fbw, &fbh, &fbx, &fby);
+		}
+		else if (StartsWith(line, "FONT_ASCENT"))
+		{
+			sscanf(line + 11, "%d", &ascent);
+		}
+		else if (StartsWith(line, "CHARS"))
+		{
+			if (fbw <= 0 || fbh <= 0)
+			{
+				Fail("%s: no FONTBOUNDINGBOX", path);
+			}
+
+			font.CellW = fbw;
+			font.CellH = fbh;
+			font.Ascent = (ascent >= 0) ? ascent : fbh + fby;
+			font.OriginX = fbx;
+			font.Cells = Alloc((size_t)(font.Last - font.First + 1) * fbw * fbh);
+			font.Present = Alloc((size_t)(font.Last - font.First + 1));
+			font.Advance = Alloc((size_t)(font.Last - font.First + 1) * sizeof(int));
+
+			for (x = 0; x <= font.Last - font.First; x++)
+			{
+				font.Advance[x] = fbw;
+			}
+		}
+		else if (StartsWith(line, "ENCODING"))
+		{
+			enc = atoi(line + 8);
+		}
+		else if (StartsWith(line, "DWIDTH"))
+		{
+			if (font.Advance != NULL && enc >= font.First && enc <= font.Last)
+			{
+				sscanf(line + 6, "%d", &font.Advance[enc - font.First]);
+			}
+		}
+		else if (StartsWith(line, "BBX"))
+		{
+			sscanf(line + 3, "%d %d %d %d", &bw, &bh, &bx, &by);
+		}
+		else if (StartsWith(line, "BITMAP"))
+		{
+			row = 0;
+			cell = NULL;
+
+			if (font.Cells != NULL && enc >= font.First && enc <= font.Last)
+			{
+				cell = &font.Cells[(size_t)(enc - font.First) * font.CellW * font.CellH];
+				font.Present[enc - font.First] = 1;
+			}
+		}
+		else if (StartsWith(line, "ENDCHAR"))
+		{
+			row = -1;
+			enc = -1;
+		}
+		else if (row >= 0)
+		{
+			/* One hex row of the glyph's own bounding box, leftmost pixel in the MSB */
+			if (cell != NULL && row < bh)
+			{
+				nibbles = (int)strspn(line, "0123456789abcdefABCDEF");
+
+				for (x = 0; x < bw && x / 4 < nibbles; x++)
+				{
+					v = isdigit((unsigned char)line[x / 4]) ? line[x / 4] - '0' : (toupper((unsigned char)line[x / 4]) - 'A' + 10);
+
+					if (v & (8 >> (x & 3)))
+					{
+						/* Glyph box to cell: x from the font box origin, y down from the ascent */
+						cx = bx - fbx + x;
+						cy = font.Ascent - (by + bh) + row;
+
+						if (cx >= 0 && cx < font.CellW && cy >= 0 && cy < font.CellH)
+						{
+							cell[cy * font.CellW + cx] = 1;
+						}
+					}
+				}
+			}
+
+			row++;
+		}
+	}
+
+	fclose(in);
+
+	if (font.Cells == NULL)
+	{
+		Fail("%s: not a BDF font", path);
+	}
+
+	return font;
+}
+
+
+static void EmitCharComment(FILE *f, int code)
+{
+	if (isprint(code) && code != '\\')
+	{
+		fprintf(f, "\t/* '%c' */\n", code);
+	}
+	else
+	{
+		fprintf(f, "\t/* 0x%02X */\n", code);
+	}
+}
+
+
+/* Glyphs cropped to their ink with the BDF advances, as OLED_FontMetrics_t of a proportional OLED_FontDef_t */
+static size_t EmitProportional(FILE *f, const Font_t *font, const Options_t *opt)
+{
+	int n = font->Last - font->First + 1, c, x, y, x0, y0, x1, y1, widest = 0;
+	size_t cell = (size_t)font->CellW * font->CellH, total = 0, size;
+	int *box = Alloc((size_t)n * 4 * sizeof(int));
+	size_t *start = Alloc((size_t)n * sizeof(size_t));
+	const uint8_t *src;
+	uint8_t *bits, *raw;
+
+	fprintf(f, "\nstatic const uint8_t %s_PropData[] = {\n", opt->Name);
+
+	for (c = 0; c < n; c++)
+	{
+		/* Ink bounding box within the cell, empty for blank characters */
+		src = &font->Cells[c * cell];
+		x0 = font->CellW;
+		y0 = font->CellH;
+		x1 = -1;
+		y1 = -1;
+
+		for (y = 0; y < font->CellH; y++)
+		{
+			for (x = 0; x < font->CellW; x++)
+			{
+				if (src[y * font->CellW + x])
+				{
+					x0 = (x < x0) ? x : x0;
+					x1 = (x > x1) ? x : x1;
+					y0 = (y < y0) ? y : y0;
+					y1 = (y > y1) ? y : y1;
+				}
+			}
+		}
+
+		start[c] = total;
+		box[c * 4 + 0] = (x1 < 0) ? 0 : x0;
+		box[c * 4 + 1] = (x1 < 0) ? 0 : y0;
+		box[c * 4 + 2] = (x1 < 0) ? 0 : x1 - x0 + 1;
+		box[c * 4 + 3] = (x1 < 0) ? 0 : y1 - y0 + 1;
+
+		if (font->Advance[c] < 0 || font->Advance[c] > 255)
+		{
+			Fail("%s: character %d advances %d pixels", opt->Name, font->First + c, font->Advance[c]);
+		}
+
+		widest = (font->Advance[c] > widest) ? font->Advance[c] : widest;
+
+		if (x1 < 0)
+		{
+			continue;
+		}
+
+		bits = Alloc((size_t)box[c * 4 + 2] * box[c * 4 + 3]);
+
+		for (y = y0; y <= y1; y++)
+		{
+			memcpy(&bits[(y - y0) * box[c * 4 + 2]], &src[y * font->CellW + x0], (size_t)box[c * 4 + 2]);
+		}
+
+		raw = PageMajor(bits, box[c * 4 + 2], box[c * 4 + 3], &size);
+		total += size;
+
+		EmitCharComment(f, font->First + c);
+		EmitBytes(f, raw, size);
+		free(raw);
+		free(bits);
+	}
+
+	if (total == 0 || total > 65535 || font->OriginX < -128 || font->OriginX + font->CellW > 127 || font->CellH > 255)
+	{
+		Fail("%s: %lu bytes of glyph data, cells %dx%d, cannot be described by OLED_FontGlyph_t",
+		     opt->Name, (unsigned long)total, font->CellW, font->CellH);
+	}
+
+	fprintf(f, "};\n\nstatic const OLED_FontGlyph_t %s_PropGlyphs[%d] = {\n", opt->Name, n);
+
+	for (c = 0; c < n; c++)
+	{
+		fprintf(f, "\t{ %lu, %d, %d, %d, %d, %d },\n", (unsigned long)start[c], box[c * 4 + 2], box[c * 4 + 3],
+		        font->OriginX + box[c * 4 + 0], box[c * 4 + 1], font->Advance[c]);
+	}
+
+	fprintf(f, "};\n\nstatic const OLED_FontMetrics_t %s_Metrics = { %s_PropGlyphs, %s_PropData, NULL, 0 };\n\n",
+	        opt->Name, opt->Name, opt->Name);
+	fprintf(f, "OLED_FontDef_t %s = { %d, %d, NULL, NULL, &%s_Metrics, NULL, NULL };\n", opt->Name, widest, font->CellH, opt->Name);
+
+	free(box);
+	free(start);
+	return total;
+}
+
+
+static void CompileFont(const char *path, const Options_t *opt)
+{
+	Font_t font = LoadBdf(path, opt);
+	int n = font.Last - font.First + 1, c, x, y, pages = (font.CellH + 7) / 8;
+	size_t cell = (size_t)font.CellW * font.CellH, total = 0, size, prop = 0;
+	size_t *offset = Alloc((n + 1) * sizeof(size_t));
+	uint8_t *raw, *packed;
+	FILE *f, *h;
+	uint16_t v;
+
+	f = OpenOutputs(opt, &h);
+	fprintf(f, "/* Generated by oled_assets from %s, do not edit */\n\n", BaseName(path));
+	fprintf(f, "#include \"STM32F407_OLED_SSD1306_Driver.h\"\n\n");
+
+	/* All glyphs in one array, each cell page-major and padded to whole pages */
+	fprintf(f, "static const uint8_t %s_GlyphData[] = {\n", opt->Name);
+
+	for (c = 0; c < n; c++)
+	{
+		raw = PageMajor(&font.Cells[c * cell], font.CellW, font.CellH, &size);
+		packed = Compress(raw, size, opt->Pack, &size);
+
+		offset[c] = total;
+		total += size;
+
+		EmitCharComment(f, font.First + c);
+		EmitBytes(f, packed, size);
+		free(raw);
+		free(packed);
+	}
+
+	fprintf(f, "};\n\n");
+
+	/* One bitmap per character, drawn with OLED_SSD1306_DrawBitmap() */
+	fprintf(f, "const OLED_Bitmap_t %s_Glyphs[%d] = {\n", opt->Name, n);
+
+	for (c = 0; c < n; c++)
+	{
+		fprintf(f, "\t{ %d, %d, %s, &%s_GlyphData[%lu], NULL },\n", font.CellW, font.CellH,
+		        PackFormat[opt->Pack], opt->Name, (unsigned long)offset[c]);
+	}
+
+	fprintf(f, "};\n");
+
+	if (opt->Proportional)
+	{
+		/* Putc() indexes the glyphs from the space character and blits them uncompressed */
+		if (font.First != 32 || opt->Legacy || opt->Pack != PACK_NONE)
+		{
+			Fail("--proportional needs --chars to start at 32 and goes without --legacy, --rle or --lz");
+		}
+
+		prop = EmitProportional(f, &font, opt);
+	}
+
+	if (opt->Legacy)
+	{
+		/* Row-major table for OLED_FontDef_t: one uint16_t per row, leftmost pixel in bit 15 */
+		if (font.CellW > 16)
+		{
+			Fail("--legacy needs a font at most 16 pixels wide, this one is %d", font.CellW);
+		}
+
+		/* Putc() indexes the table from the space character */
+		if (font.First != 32)
+		{
+			Fail("--legacy needs --chars to start at 32");
+		}
+
+		fprintf(f, "\nstatic const uint16_t %s_Rows[] = {\n", opt->Name);
+
+		for (c = 0; c < n; c++)
+		{
+			fprintf(f, "\t");
+
+			for (y = 0; y < font.CellH; y++)
+			{
+				v = 0;
+
+				for (x = 0; x < font.CellW; x++)
+				{
+					if (font.Cells[c * cell + y * font.CellW + x])
+					{
+						v |= (uint16_t)(0x8000 >> x);
+					}
+				}
+
+				fprintf(f, "0x%04X,%s", v, (y == font.CellH - 1) ? "" : " ");
+			}
+
+			fprintf(f, "\n");
+		}
+
+		/* Uncompressed glyph data is laid out the way Putc() blits it, compressed cells are not */
+		fprintf(f, "};\n\nOLED_FontDef_t %s = { %d, %d, %s_Rows, ", opt->Name, font.CellW, font.CellH, opt->Name);
+
+		if (opt->Pack == PACK_NONE)
+		{
+			fprintf(f, "%s_GlyphData, NULL, NULL, NULL };\n", opt->Name);
+		}
+		else
+		{
+			fprintf(f, "NULL, NULL, NULL, NULL };\n");
+		}
+	}
+
+	if (h != NULL)
+	{
+		EmitHeaderStart(h, opt->Name, BaseName(path));
+		fprintf(h, "/* %dx%d cells, characters %d to %d, %lu bytes of glyph data */\n",
+		        font.CellW, font.CellH, font.First, font.Last, (unsigned long)total);
+		fprintf(h, "#define %s_FIRST_CHAR %d\n#define %s_LAST_CHAR %d\n\n", opt->Name, font.First, opt->Name, font.Last);
+		fprintf(h, "extern const OLED_Bitmap_t %s_Glyphs[%d];\n", opt->Name, n);
+
+		if (opt->Legacy || opt->Proportional)
+		{
+			fprintf(h, "extern OLED_FontDef_t %s;\n", opt->Name);
+		}
+
+		fprintf(h, "\n#endif\n");
+		fclose(h);
+	}
+
+	if (f != stdout)
+	{
+		fclose(f);
+	}
+
+	for (c = 0; c < n; c++)
+	{
+		if (!font.Present[c])
+		{
+			fprintf(stderr, "%s: character %d is not in the font, left blank\n", opt->Name, font.First + c);
+		}
+	}
+
+	fprintf(stderr, "%s: %d characters, %dx%d cells (%d pages), %lu bytes%s\n", opt->Name, n, font.CellW, font.CellH,
+	        pages, (unsigned long)total, PackName[opt->Pack]);
+
+	if (opt->Proportional)
+	{
+		fprintf(stderr, "%s: %lu bytes cropped to the glyph bounding boxes\n", opt->Name, (unsigned long)prop);
+	}
+
+	free(offset);
+	free(font.Cells);
+	free(font.Present);
+	free(font.Advance);
+}
+
+
+/************************************************** Main *****************************************************/
+
+static void Usage(void)
+{
+	fprintf(stderr,
+	        "usage: oled_assets [options] input.{pbm,pgm,png,bdf} [-o output.c]\n"
+	        "       oled_assets [options] --report image ...\n"
+	        "  -n name  --crop x,y,w,h  --trim  --invert  --threshold n\n"
+	        "  --dither none|bayer|fs|atkinson  --rle  --lz  --chars first-last  --legacy  --proportional\n");
+	exit(2);
+}
+
+
+int main(int argc, char **argv)
+{
+	Options_t opt;
+	const char *input = NULL, *ext;
+	char name[256];
+	size_t i, totals[3] = { 0, 0, 0 };
+	int a, inputs = 0;
+
+	memset(&opt, 0, sizeof(opt));
+	opt.Threshold = 127;
+	opt.FirstChar = 32;
+	opt.LastChar = 126;
+
+	for (a = 1; a < argc; a++)
+	{
+		if (!strcmp(argv[a], "-n") && a + 1 < argc)
+		{
+			opt.Name = argv[++a];
+		}
+		else if (!strcmp(argv[a], "-o") && a + 1 < argc)
+		{
+			opt.Output = argv[++a];
+		}
+		else if (!strcmp(argv[a], "--crop") && a + 1 < argc)
+		{
+			if (sscanf(argv[++a], "%d,%d,%d,%d", &opt.CropX, &opt.CropY, &opt.CropW, &opt.CropH) != 4)
+			{
+				Usage();
+			}
+		}
+		else if (!strcmp(argv[a], "--trim"))
+		{
+			opt.Trim = 1;
+		}
+		else if (!strcmp(argv[a], "--invert"))
+		{
+			opt.Invert = 1;
+		}
+		else if (!strcmp(argv[a], "--threshold") && a + 1 < argc)
+		{
+			opt.Threshold = atoi(argv[++a]);
+		}
+		else if (!strcmp(argv[a], "--dither") && a + 1 < argc)
+		{
+			a++;
+			opt.Dither = !strcmp(argv[a], "bayer") ? DITHER_BAYER : !strcmp(argv[a], "fs") ? DITHER_FS :
+			             !strcmp(argv[a], "atkinson") ? DITHER_ATKINSON : !strcmp(argv[a], "none") ? DITHER_NONE : -1;
+
+			if (opt.Dither < 0)
+			{
+				Usage();
+			}
+		}
+		else if (!strcmp(argv[a], "--rle"))
+		{
+			opt.Pack = PACK_RLE;
+		}
+		else if (!strcmp(argv[a], "--lz"))
+		{
+			opt.Pack = PACK_LZ;
+		}
+		else if (!strcmp(argv[a], "--report"))
+		{
+			opt.Report = 1;
+		}
+		else if (!strcmp(argv[a], "--chars") && a + 1 < argc)
+		{
+			if (sscanf(argv[++a], "%d-%d", &opt.FirstChar, &opt.LastChar) != 2 || opt.FirstChar < 0 || opt.LastChar < opt.FirstChar)
+			{
+				Usage();
+			}
+		}
+		else if (!strcmp(argv[a], "--legacy"))
+		{
+			opt.Legacy = 1;
+		}
+		else if (!strcmp(argv[a], "--proportional"))
+		{
+			opt.Proportional = 1;
+		}
+		else if (argv[a][0] == '-')
+		{
+			Usage();
+		}
+		else
+		{
+			input = argv[a];
+			inputs++;
+		}
+	}
+
+	if (input == NULL || (inputs > 1 && !opt.Report))
+	{
+		Usage();
+	}
+
+	/* Sizes only: every argument that is not an option is an image */
+	if (opt.Report)
+	{
+		printf("%-24s %7s %6s %13s %13s\n", "image", "size", "raw", "PackBits", "LZ");
+
+		for (a = 1; a < argc; a++)
+		{
+			if (argv[a][0] == '-')
+			{
+				/* Options with a value */
+				a += (!strcmp(argv[a], "-n") || !strcmp(argv[a], "-o") || !strcmp(argv[a], "--crop") ||
+				      !strcmp(argv[a], "--threshold") || !strcmp(argv[a], "--dither") || !strcmp(argv[a], "--chars"));
+				continue;
+			}
+
+			ReportImage(argv[a], &opt, totals);
+		}
+
+		printf("%-24s %7s %6lu %6lu %5.1f%% %6lu %5.1f%%\n", "total", "", (unsigned long)totals[0],
+		       (unsigned long)totals[1], 100.0 * totals[1] / totals[0], (unsigned long)totals[2], 100.0 * totals[2] / totals[0]);
+		return 0;
+	}
+
+	/* Default symbol name: file name without extension, made a C identifier */
+	if (opt.Name == NULL)
+	{
+		snprintf(name, sizeof(name), "%s", BaseName(input));
+
+		if (strrchr(name, '.') != NULL)
+		{
+			*strrchr(name, '.') = '\0';
+		}
+
+		for (i = 0; name[i]; i++)
+		{
+			if (!isalnum((unsigned char)name[i]))
+			{
+				name[i] = '_';
+			}
+		}
+
+		opt.Name = name;
+	}
+
+	ext = strrchr(input, '.');
+
+	if (ext != NULL && (!strcmp(ext, ".bdf") || !strcmp(ext, ".BDF")))
+	{
+		CompileFont(input, &opt);
+	}
+	else
+	{
+		CompileImage(input, &opt);
+	}
+
+	return 0;
+}
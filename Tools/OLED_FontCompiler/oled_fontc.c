@@ -0,0 +1,1493 @@
+/**
+  **********************************************************************************************************************
+   * @file   : oled_fontc.c
+   * @author : Sharath N
+   * @brief  : Host font compiler, turns BDF and TrueType fonts into OLED_FontDef_t tables for the SSD1306 OLED Driver
+  **********************************************************************************************************************
+*/
+
+/*
+          Build on the host, for BDF fonts only:
+
+              gcc -std=c99 -O2 -Wall -pthread -o oled_fontc oled_fontc.c
+
+          and with TrueType/OpenType support through FreeType:
+
+              gcc -std=c99 -O2 -Wall -pthread -DFONTC_FREETYPE $(pkg-config --cflags freetype2) \
+                  -o oled_fontc oled_fontc.c $(pkg-config --libs freetype2)
+
+          Every input becomes one OLED_FontDef_t per size, all of them written to one file:
+
+              oled_fontc -o fonts.c --format packed --chars 32-126,0xB0 DejaVuSansMono.ttf --size 10,14 \
+                         --format prop -n OLED_Font_Title Title.bdf
+
+          writes fonts.c and fonts.h declaring OLED_Font_PackedDejaVuSansMono_10, ..._14 and OLED_Font_Title.
+          Options apply to every input after them, -n to the next one only (with _<size> added for several
+          sizes). The output files only list the fonts and their tables, the formats are the ones of
+          OLED_SSD1306_Fonts.h:
+
+              page      Page-major glyphs in fixed cells (OLED_FontDef_t glyphs), the fastest to draw. Fonts up to
+                        16 pixels wide
+              packed    Bit-packed cells (OLED_FontPacked_t), each glyph run-length coded where that is smaller,
+                        fonts up to 16 x 32 pixels
+              prop      Glyphs cropped to their ink with their own advances (OLED_FontMetrics_t), kerning pairs
+                        of TrueType fonts for characters up to 255
+
+          ' ' to '~' are always in a font. Other characters given with --chars that the font has are reached
+          through OLED_FontCharset_t ranges, the ones it lacks draw the fallback glyph like any other codepoint
+          outside the font, and so do missing characters of ' ' to '~'.
+
+          For each font the coverage (characters found out of those asked for, the missing ones listed) and
+          the flash it takes on the target, as counted by OLED_FONTS_GetFlashSize(), are printed. --report
+          prints that for all three formats and writes nothing.
+
+          Fonts are loaded and converted on all cores, each worker takes the next font. The output depends only
+          on the inputs and the options, not on the number of threads.
+
+          Options:
+              -o file.c            Output file, the header gets the same name with .h
+              -n name              Symbol name of the next input, default OLED_Font_<format><file>[_<size>]
+              --format f           page, packed or prop, default page
+              --chars list         Codepoints to add to ' ' to '~', e.g. 0xB0,0x391-0x3A9 (up to 0xFFFF)
+              --fallback code      Character drawn for the ones the font lacks, one of --chars, default '?'
+              --size list          Pixel sizes of TrueType inputs, e.g. 12,16,24. Ignored for BDF
+              --threshold n        Render TrueType glyphs anti-aliased and set pixels above coverage n (0-255),
+                                   default: FreeType's monochrome hinted rendering
+              --report             Only print coverage and size in all formats
+              -j n                 Worker threads, default: number of online CPUs
+*/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <ctype.h>
+#include <pthread.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#ifdef FONTC_FREETYPE
+#include <ft2build.h>
+#include FT_FREETYPE_H
+#endif
+
+/* Output formats */
+enum { FORMAT_PAGE, FORMAT_PACKED, FORMAT_PROP, FORMAT_COUNT };
+
+static const char *const FormatName[] = { "page", "packed", "prop" };
+static const char *const FormatPrefix[] = { "", "Packed", "Prop" };
+
+/* Sizes of the font structures on the 32-bit target, for the flash figures */
+#define TARGET_FONTDEF               24
+#define TARGET_METRICS               16
+#define TARGET_GLYPH                 8
+#define TARGET_KERN                  3
+#define TARGET_PACKED                8
+#define TARGET_CHARSET               16
+#define TARGET_RANGE                 6
+
+#define MAX_SIZES                    16
+#define ASCII_GLYPHS                 95    /* ' ' to '~', glyphs 0 to 94 of every font */
+
+/* Codepoints asked for, sorted, ' ' to '~' first */
+typedef struct {
+	uint32_t *Codes;
+	int Count;
+} Chars_t;
+
+/* One character of a loaded font */
+typedef struct {
+	int Present;
+	int Advance;
+	int X, Y;             /* Ink box: left edge relative to the pen, top relative to the top of the line */
+	int Width, Height;
+	uint8_t *Ink;         /* Width x Height pixels, 0 or 1 */
+} Glyph_t;
+
+typedef struct {
+	uint8_t Left, Right;
+	int Adjust;
+} Kern_t;
+
+/* One font to compile: an input at one size in one format */
+typedef struct {
+	const char *Path;
+	char Name[128];
+	int Format;
+	int Size;
+	int Threshold;
+	uint32_t FallbackCode;
+	const Chars_t *Chars;
+	/* Loaded */
+	int Ascent;           /* Baseline, rows below the top of the line */
+	int LineHeight;
+	Glyph_t *Glyphs;      /* One per code of Chars */
+	uint8_t *Missing;     /* Codes of Chars the font lacks */
+	int Fallback;         /* Glyph drawn for characters the font lacks, index in Chars, -1 for none */
+	int FallbackIndex;    /* The same glyph's index in the tables */
+	Kern_t *Kerning;
+	int KerningCount;
+	/* Compiled */
+	FILE *Out;            /* Tables of this font, copied into the output in command line order */
+	const char *Error;    /* Why the font cannot be given in its format, NULL if it could */
+	int Width;            /* FontWidth */
+	int Present;
+	int Clipped;
+	size_t Flash;
+} Font_t;
+
+typedef struct {
+	Font_t *Fonts;
+	int Count;
+	int Next;
+	pthread_mutex_t Lock;
+} Job_t;
+
+
+static void Fail(const char *fmt, ...)
+{
+	va_list ap;
+
+	va_start(ap, fmt);
+	fprintf(stderr, "oled_fontc: ");
+	vfprintf(stderr, fmt, ap);
+	fprintf(stderr, "\n");
+	va_end(ap);
+	exit(1);
+}
+
+
+static void *Alloc(size_t n)
+{
+	void *p = calloc(n ? n : 1, 1);
+
+	if (p == NULL)
+	{
+		Fail("out of memory");
+	}
+
+	return p;
+}
+
+
+static const char *BaseName(const char *path)
+{
+	const char *s = strrchr(path, '/');
+	const char *b = strrchr(path, '\\');
+
+	if (b != NULL && (s == NULL || b > s))
+	{
+		s = b;
+	}
+
+	return s ? s + 1 : path;
+}
+
+
+static int IsTrueType(const char *path)
+{
+	const char *ext = strrchr(path, '.');
+
+	return ext != NULL && (!strcmp(ext, ".ttf") || !strcmp(ext, ".TTF") || !strcmp(ext, ".otf") || !strcmp(ext, ".OTF"));
+}
+
+
+/* Comment naming a character, like the tables of OLED_SSD1306_Fonts.c */
+static void EmitCharComment(FILE *f, uint32_t code)
+{
+	if (code < 0x7F && code != '\\')
+	{
+		fprintf(f, "\t/* '%c' */\n", (char)code);
+	}
+	else
+	{
+		fprintf(f, "\t/* U+%04X */\n", (unsigned)code);
+	}
+}
+
+
+static void EmitBytes(FILE *f, const uint8_t *data, size_t n)
+{
+	size_t i;
+
+	for (i = 0; i < n; i++)
+	{
+		fprintf(f, "%s0x%02X,%s", (i % 16 == 0) ? "\t" : "", data[i], (i % 16 == 15 || i == n - 1) ? "\n" : " ");
+	}
+}
+
+
+static uint8_t *PageMajor(const uint8_t *bits, int w, int h, size_t *size)
+{
+	int pages = (h + 7) / 8, x, y;
+	uint8_t *out = Alloc((size_t)w * pages);
+
+	for (y = 0; y < h; y++)
+	{
+		for (x = 0; x < w; x++)
+		{
+			if (bits[y * w + x])
+			{
+				out[x + (y / 8) * w] |= (uint8_t)(1 << (y & 7));
+			}
+		}
+	}
+
+	*size = (size_t)w * pages;
+	return out;
+}
+
+
+/******************************************** Character sets *************************************************/
+
+static int CompareCodes(const void *a, const void *b)
+{
+	uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+
+	return (x > y) - (x < y);
+}
+
+
+/* Parses "0xB0,0x391-0x3A9" into a new set that also holds ' ' to '~' */
+static Chars_t *ParseChars(const char *list)
+{
+	Chars_t *set = Alloc(sizeof(Chars_t));
+	unsigned long first, last, c;
+	const char *p = list;
+	char *end;
+	int n = 0, cap = 256, i;
+
+	set->Codes = Alloc(cap * sizeof(uint32_t));
+
+	for (c = ' '; c <= '~'; c++)
+	{
+		set->Codes[n++] = (uint32_t)c;
+	}
+
+	while (p != NULL && *p)
+	{
+		first = strtoul(p, &end, 0);
+		last = first;
+
+		if (end == p)
+		{
+			Fail("--chars: cannot read '%s'", p);
+		}
+
+		if (*end == '-')
+		{
+			p = end + 1;
+			last = strtoul(p, &end, 0);
+
+			if (end == p)
+			{
+				Fail("--chars: cannot read '%s'", p);
+			}
+		}
+
+		if (first < ' ' || last < first || last > 0xFFFF)
+		{
+			Fail("--chars: %lu-%lu is not a range of codepoints from 32 to 65535", first, last);
+		}
+
+		for (c = first; c <= last; c++)
+		{
+			if (n == cap)
+			{
+				cap *= 2;
+				set->Codes = realloc(set->Codes, cap * sizeof(uint32_t));
+
+				if (set->Codes == NULL)
+				{
+					Fail("out of memory");
+				}
+			}
+
+			set->Codes[n++] = (uint32_t)c;
+		}
+
+		p = (*end == ',') ? end + 1 : end;
+
+		if (*end != ',' && *end != '\0')
+		{
+			Fail("--chars: cannot read '%s'", end);
+		}
+	}
+
+	/* Sorted without repeats, so ' ' to '~' are glyphs 0 to 94 */
+	qsort(set->Codes, n, sizeof(uint32_t), CompareCodes);
+
+	for (i = 1, set->Count = 1; i < n; i++)
+	{
+		if (set->Codes[i] != set->Codes[set->Count - 1])
+		{
+			set->Codes[set->Count++] = set->Codes[i];
+		}
+	}
+
+	return set;
+}
+
+
+static int FindCode(const Chars_t *set, uint32_t code)
+{
+	uint32_t *p = bsearch(&code, set->Codes, set->Count, sizeof(uint32_t), CompareCodes);
+
+	return p ? (int)(p - set->Codes) : -1;
+}
+
+
+/* Shrinks a glyph's box to its set pixels */
+static void CropInk(Glyph_t *g)
+{
+	int x0 = g->Width, y0 = g->Height, x1 = -1, y1 = -1, x, y, w;
+	uint8_t *ink;
+
+	for (y = 0; y < g->Height; y++)
+	{
+		for (x = 0; x < g->Width; x++)
+		{
+			if (g->Ink[y * g->Width + x])
+			{
+				x0 = (x < x0) ? x : x0;
+				x1 = (x > x1) ? x : x1;
+				y0 = (y < y0) ? y : y0;
+				y1 = (y > y1) ? y : y1;
+			}
+		}
+	}
+
+	if (x1 < 0)
+	{
+		g->X = g->Y = g->Width = g->Height = 0;
+		return;
+	}
+
+	w = x1 - x0 + 1;
+	ink = Alloc((size_t)w * (y1 - y0 + 1));
+
+	for (y = y0; y <= y1; y++)
+	{
+		memcpy(&ink[(y - y0) * w], &g->Ink[y * g->Width + x0], (size_t)w);
+	}
+
+	free(g->Ink);
+	g->Ink = ink;
+	g->X += x0;
+	g->Y += y0;
+	g->Width = w;
+	g->Height = y1 - y0 + 1;
+}
+
+
+/************************************************** BDF ******************************************************/
+
+static int StartsWith(const char *line, const char *key)
+{
+	size_t n = strlen(key);
+
+	return !strncmp(line, key, n) && (line[n] == ' ' || line[n] == '\n' || line[n] == '\r' || line[n] == '\0');
+}
+
+
+static void LoadBdf(Font_t *font)
+{
+	FILE *in = fopen(font->Path, "rb");
+	char line[1024];
+	int fbw = 0, fbh = 0, fbx = 0, fby = 0, ascent = -1, descent = -1, advance = -1, row = -1, index = -1;
+	int bw = 0, bh = 0, bx = 0, by = 0, x, v, nibbles;
+	Glyph_t *g = NULL;
+
+	if (in == NULL)
+	{
+		Fail("cannot open %s", font->Path);
+	}
+
+	while (fgets(line, sizeof(line), in) != NULL)
+	{
+		if (StartsWith(line, "FONTBOUNDINGBOX"))
+		{
+			sscanf(line + 15, "%d %d %d %d", &fbw, &fbh, &fbx, &fby);
+		}
+		else if (StartsWith(line, "FONT_ASCENT"))
+		{
+			sscanf(line + 11, "%d", &ascent);
+		}
+		else if (StartsWith(line, "FONT_DESCENT"))
+		{
+			sscanf(line + 12, "%d", &descent);
+		}
+		else if (StartsWith(line, "STARTCHAR"))
+		{
+			index = -1;
+			advance = fbw;
+			bw = bh = bx = by = 0;
+		}
+		else if (StartsWith(line, "ENCODING"))
+		{
+			index = (atoi(line + 8) >= ' ') ? FindCode(font->Chars, (uint32_t)atoi(line + 8)) : -1;
+		}
+		else if (StartsWith(line, "DWIDTH"))
+		{
+			sscanf(line + 6, "%d", &advance);
+		}
+		else if (StartsWith(line, "BBX"))
+		{
+			sscanf(line + 3, "%d %d %d %d", &bw, &bh, &bx, &by);
+		}
+		else if (StartsWith(line, "BITMAP"))
+		{
+			if (fbh <= 0)
+			{
+				Fail("%s: no FONTBOUNDINGBOX", font->Path);
+			}
+
+			font->Ascent = (ascent >= 0) ? ascent : fbh + fby;
+			font->LineHeight = (ascent >= 0 && descent >= 0) ? ascent + descent : fbh;
+			g = NULL;
+			row = 0;
+
+			if (index >= 0 && bw >= 0 && bh >= 0)
+			{
+				g = &font->Glyphs[index];
+				free(g->Ink);
+				g->Present = 1;
+				g->Advance = advance;
+				g->X = bx;
+				g->Y = font->Ascent - (by + bh);
+				g->Width = bw;
+				g->Height = bh;
+				g->Ink = Alloc((size_t)bw * bh);
+			}
+		}
+		else if (StartsWith(line, "ENDCHAR"))
+		{
+			if (g != NULL)
+			{
+				CropInk(g);
+			}
+
+			g = NULL;
+			row = -1;
+		}
+		else if (row >= 0)
+		{
+			/* One hex row of the glyph's box, leftmost pixel in the MSB */
+			if (g != NULL && row < bh)
+			{
+				nibbles = (int)strspn(line, "0123456789abcdefABCDEF");
+
+				for (x = 0; x < bw && x / 4 < nibbles; x++)
+				{
+					v = isdigit((unsigned char)line[x / 4]) ? line[x / 4] - '0' : (toupper((unsigned char)line[x / 4]) - 'A' + 10);
+					g->Ink[row * bw + x] = (v >> (3 - (x & 3))) & 1;
+				}
+			}
+
+			row++;
+		}
+	}
+
+	fclose(in);
+
+	if (font->LineHeight <= 0)
+	{
+		Fail("%s: not a BDF font", font->Path);
+	}
+}
+
+
+/*********************************************** TrueType ****************************************************/
+
+#ifdef FONTC_FREETYPE
+
+/* Each font gets its own FreeType library, so workers share nothing */
+static void LoadTrueType(Font_t *font)
+{
+	FT_Library lib;
+	FT_Face face;
+	FT_Bitmap *bm;
+	FT_Vector kern;
+	FT_UInt index, left, right;
+	Glyph_t *g;
+	int i, j, x, y, v, descent;
+
+	if (FT_Init_FreeType(&lib) != 0 || FT_New_Face(lib, font->Path, 0, &face) != 0)
+	{
+		Fail("cannot open %s", font->Path);
+	}
+
+	if (FT_Set_Pixel_Sizes(face, 0, (FT_UInt)font->Size) != 0)
+	{
+		Fail("%s: no %d pixel size", font->Path, font->Size);
+	}
+
+	font->Ascent = (int)((face->size->metrics.ascender + 63) >> 6);
+	descent = (int)((-face->size->metrics.descender + 63) >> 6);
+	font->LineHeight = font->Ascent + descent;
+
+	for (i = 0; i < font->Chars->Count; i++)
+	{
+		g = &font->Glyphs[i];
+		index = FT_Get_Char_Index(face, font->Chars->Codes[i]);
+
+		if (index == 0 || FT_Load_Glyph(face, index, (font->Threshold < 0) ? FT_LOAD_RENDER | FT_LOAD_TARGET_MONO :
+		                                                                    FT_LOAD_RENDER) != 0)
+		{
+			continue;
+		}
+
+		bm = &face->glyph->bitmap;
+		g->Present = 1;
+		g->Advance = (int)((face->glyph->advance.x + 32) >> 6);
+		g->X = face->glyph->bitmap_left;
+		g->Y = font->Ascent - face->glyph->bitmap_top;
+		g->Width = (int)bm->width;
+		g->Height = (int)bm->rows;
+		g->Ink = Alloc((size_t)g->Width * g->Height);
+
+		for (y = 0; y < g->Height; y++)
+		{
+			for (x = 0; x < g->Width; x++)
+			{
+				if (bm->pixel_mode == FT_PIXEL_MODE_MONO)
+				{
+					v = (bm->buffer[y * bm->pitch + x / 8] >> (7 - (x & 7))) & 1;
+				}
+				else
+				{
+					v = bm->buffer[y * bm->pitch + x] > font->Threshold;
+				}
+
+				g->Ink[y * g->Width + x] = (uint8_t)v;
+			}
+		}
+
+		CropInk(g);
+	}
+
+	/* Kerning pairs of the characters OLED_FontKern_t can hold */
+	if (FT_HAS_KERNING(face))
+	{
+		font->Kerning = Alloc(256 * 256 * sizeof(Kern_t));
+
+		for (i = 0; i < font->Chars->Count && font->Chars->Codes[i] < 256; i++)
+		{
+			for (j = 0; j < font->Chars->Count && font->Chars->Codes[j] < 256; j++)
+			{
+				left = FT_Get_Char_Index(face, font->Chars->Codes[i]);
+				right = FT_Get_Char_Index(face, font->Chars->Codes[j]);
+
+				if (left == 0 || right == 0 || FT_Get_Kerning(face, left, right, FT_KERNING_DEFAULT, &kern) != 0)
+				{
+					continue;
+				}
+
+				v = (int)((kern.x + ((kern.x < 0) ? -32 : 32)) / 64);
+
+				if (v != 0)
+				{
+					font->Kerning[font->KerningCount].Left = (uint8_t)font->Chars->Codes[i];
+					font->Kerning[font->KerningCount].Right = (uint8_t)font->Chars->Codes[j];
+					font->Kerning[font->KerningCount].Adjust = (v < -128) ? -128 : (v > 127) ? 127 : v;
+					font->KerningCount++;
+				}
+			}
+		}
+	}
+
+	FT_Done_Face(face);
+	FT_Done_FreeType(lib);
+}
+
+#else
+
+static void LoadTrueType(Font_t *font)
+{
+	Fail("%s: TrueType fonts need a build with -DFONTC_FREETYPE, see the top of oled_fontc.c", font->Path);
+}
+
+#endif
+
+
+/********************************************* Fixed cells ***************************************************/
+
+/* Glyph whose pixels a character is drawn with, missing characters of ' ' to '~' take the fallback */
+static const Glyph_t *Drawn(const Font_t *font, int i)
+{
+	return (font->Glyphs[i].Present || i >= ASCII_GLYPHS || font->Fallback < 0) ? &font->Glyphs[i] : &font->Glyphs[font->Fallback];
+}
+
+
+/**
+ * @brief  Places every glyph in a cell of the same size, the pen at the left edge unless glyphs reach left of it
+ * @retval Cells, FontWidth x LineHeight pixels for each glyph in Index order
+ */
+static uint8_t *LayoutCells(Font_t *font, const int *glyphs, int n)
+{
+	int i, x, y, cx, cy, left = 0, right = 1;
+	const Glyph_t *g;
+	size_t cell;
+	uint8_t *cells;
+
+	for (i = 0; i < n; i++)
+	{
+		g = Drawn(font, glyphs[i]);
+
+		if (g->Present)
+		{
+			left = (g->Width != 0 && g->X < left) ? g->X : left;
+			right = (g->Advance > right) ? g->Advance : right;
+			right = (g->Width != 0 && g->X + g->Width > right) ? g->X + g->Width : right;
+		}
+	}
+
+	font->Width = right - left;
+	cell = (size_t)font->Width * font->LineHeight;
+	cells = Alloc(cell * n);
+
+	for (i = 0; i < n; i++)
+	{
+		g = Drawn(font, glyphs[i]);
+
+		for (y = 0; g->Present && y < g->Height; y++)
+		{
+			for (x = 0; x < g->Width; x++)
+			{
+				cx = g->X - left + x;
+				cy = g->Y + y;
+
+				if (cx < 0 || cx >= font->Width || cy < 0 || cy >= font->LineHeight)
+				{
+					font->Clipped += g->Ink[y * g->Width + x];
+				}
+				else
+				{
+					cells[i * cell + cy * font->Width + cx] = g->Ink[y * g->Width + x];
+				}
+			}
+		}
+	}
+
+	return cells;
+}
+
+
+/* Adds a 4 bit count to a run-length coded glyph */
+static void PutNibble(uint8_t *out, size_t *k, int v)
+{
+	out[*k >> 1] |= (uint8_t)(v << ((*k & 1) * 4));
+	(*k)++;
+}
+
+
+/* Run-length codes a cell column by column, top row first: counts of alternating clear and set pixels */
+static size_t EncodeRle(const uint8_t *cell, int w, int h, uint8_t *out)
+{
+	size_t k = 0;
+	int i, ink = 0, run = 0, px;
+
+	for (i = 0; i <= w * h; i++)
+	{
+		px = (i < w * h) ? cell[(i % h) * w + i / h] : !ink;
+
+		if (px == ink)
+		{
+			run++;
+			continue;
+		}
+
+		/* 15 and an empty run of the other kind continue a long run */
+		for ( ; run > 15; run -= 15)
+		{
+			PutNibble(out, &k, 15);
+			PutNibble(out, &k, 0);
+		}
+
+		PutNibble(out, &k, run);
+		ink ^= 1;
+		run = 1;
+	}
+
+	return (k + 1) / 2;
+}
+
+
+/* Decodes a run-length coded glyph the way the driver does, for checking the encoder */
+static int CheckRle(const uint8_t *src, const uint8_t *cell, int w, int h)
+{
+	int c = 0, r = 0, left, ink = 0;
+	size_t k;
+
+	for (k = 0; c < w; k++, ink ^= 1)
+	{
+		for (left = (src[k >> 1] >> ((k & 1) * 4)) & 0x0F; left != 0; left--)
+		{
+			if (c >= w || cell[r * w + c] != ink)
+			{
+				return 0;
+			}
+
+			if (++r == h)
+			{
+				r = 0;
+				c++;
+			}
+		}
+	}
+
+	return 1;
+}
+
+
+/*********************************************** Output ******************************************************/
+
+/* Glyphs in table order: ' ' to '~', then the other characters the font has */
+static int *TableOrder(Font_t *font, int *n)
+{
+	int *glyphs = Alloc(font->Chars->Count * sizeof(int)), i;
+
+	for (i = 0, *n = 0; i < font->Chars->Count; i++)
+	{
+		if (i < ASCII_GLYPHS || font->Glyphs[i].Present)
+		{
+			glyphs[(*n)++] = i;
+		}
+
+		font->Present += font->Glyphs[i].Present;
+	}
+
+	return glyphs;
+}
+
+
+/* Ranges of the characters beyond '~', NULL charset when there are none */
+static void EmitCharset(Font_t *font, FILE *f, const int *glyphs, int n)
+{
+	int i, j, ranges = 1;
+
+	if (n == ASCII_GLYPHS)
+	{
+		return;
+	}
+
+	fprintf(f, "static const OLED_FontRange_t %s_Ranges[] = {\n\t{ 0x0020, 0x007E,   0 },\n", font->Name);
+
+	for (i = ASCII_GLYPHS; i < n; i = j, ranges++)
+	{
+		for (j = i + 1; j < n && font->Chars->Codes[glyphs[j]] == font->Chars->Codes[glyphs[j - 1]] + 1; j++)
+		{
+		}
+
+		fprintf(f, "\t{ 0x%04X, 0x%04X, %3d },\n", (unsigned)font->Chars->Codes[glyphs[i]],
+		        (unsigned)font->Chars->Codes[glyphs[j - 1]], i);
+	}
+
+	fprintf(f, "};\n\nstatic const OLED_FontCharset_t %s_Charset = { %s_Ranges, %d, %d, %d, NULL };\n\n", font->Name,
+	        font->Name, ranges, n, font->FallbackIndex);
+	font->Flash += ranges * TARGET_RANGE + TARGET_CHARSET;
+}
+
+
+static void EmitFontDef(Font_t *font, FILE *f, int n, const char *tables)
+{
+	fprintf(f, "OLED_FontDef_t %s = { %d, %d, %s, ", font->Name, font->Width, font->LineHeight, tables);
+	fprintf(f, (n > ASCII_GLYPHS) ? "&%s_Charset };\n" : "NULL };\n", font->Name);
+	font->Flash += TARGET_FONTDEF;
+}
+
+
+/* Fixed cells, page-major as drawn */
+static void EmitPage(Font_t *font, FILE *f, const int *glyphs, int n)
+{
+	uint8_t *cells = LayoutCells(font, glyphs, n), *raw;
+	size_t cell = (size_t)font->Width * font->LineHeight, size;
+	char tables[256];
+	int i;
+
+	if (font->Width > 16 || font->LineHeight > 64)
+	{
+		font->Error = "page needs cells up to 16 x 64 pixels, use prop";
+		free(cells);
+		return;
+	}
+
+	fprintf(f, "static const uint8_t %s_Pages[] = {\n", font->Name);
+
+	for (i = 0; i < n; i++)
+	{
+		raw = PageMajor(&cells[i * cell], font->Width, font->LineHeight, &size);
+		EmitCharComment(f, font->Chars->Codes[glyphs[i]]);
+		EmitBytes(f, raw, size);
+		font->Flash += size;
+		free(raw);
+	}
+
+	fprintf(f, "};\n\n");
+	EmitCharset(font, f, glyphs, n);
+	snprintf(tables, sizeof(tables), "NULL, %s_Pages, NULL, NULL", font->Name);
+	EmitFontDef(font, f, n, tables);
+	free(cells);
+}
+
+
+/* Fixed cells bit-packed, run-length coded glyph by glyph where that saves flash */
+static void EmitPacked(Font_t *font, FILE *f, const int *glyphs, int n)
+{
+	uint8_t *cells = LayoutCells(font, glyphs, n), *bits, *rle;
+	size_t cell = (size_t)font->Width * font->LineHeight, raw = (cell + 7) / 8, size, plain, coded = 0, pos, k;
+	size_t *rle_size = Alloc(n * sizeof(size_t));
+	uint16_t *offsets = Alloc((n + 1) * sizeof(uint16_t));
+	char tables[256];
+	int i, x, y;
+
+	if (font->Width > 16 || font->LineHeight > 32)
+	{
+		font->Error = "packed needs cells up to 16 x 32 pixels, use prop";
+		free(cells);
+		free(rle_size);
+		free(offsets);
+		return;
+	}
+
+	rle = Alloc(cell + 4);
+
+	for (i = 0; i < n; i++)
+	{
+		memset(rle, 0, cell + 4);
+		rle_size[i] = EncodeRle(&cells[i * cell], font->Width, font->LineHeight, rle);
+		coded += (rle_size[i] < raw) ? rle_size[i] : raw;
+
+		if (!CheckRle(rle, &cells[i * cell], font->Width, font->LineHeight))
+		{
+			Fail("%s: run-length coding of U+%04X does not decode", font->Name, (unsigned)font->Chars->Codes[glyphs[i]]);
+		}
+	}
+
+	/* Back to back without offsets, or each glyph in its shorter form from a byte boundary */
+	plain = (cell * n + 7) / 8;
+	coded += (n + 1) * sizeof(uint16_t);
+
+	if (coded < plain && coded - (n + 1) * sizeof(uint16_t) > 0x7FFF)
+	{
+		coded = plain;
+	}
+
+	bits = Alloc((coded < plain) ? coded : plain);
+	fprintf(f, "static const uint8_t %s_Bits[] = {\n", font->Name);
+
+	for (i = 0, pos = 0; i < n; i++)
+	{
+		EmitCharComment(f, font->Chars->Codes[glyphs[i]]);
+
+		if (coded >= plain)
+		{
+			/* Bit b of the glyph at bit i * cell + b, columns of LineHeight bits, top row first */
+			for (x = 0; x < font->Width; x++)
+			{
+				for (y = 0; y < font->LineHeight; y++)
+				{
+					k = i * cell + (size_t)x * font->LineHeight + y;
+					bits[k / 8] |= (uint8_t)(cells[i * cell + y * font->Width + x] << (k & 7));
+				}
+			}
+
+			/* Printed once complete: the bytes from the first one the glyph starts in, shared ones with the glyph before */
+			size = (i == n - 1) ? plain : ((i + 1) * cell) / 8;
+			EmitBytes(f, &bits[pos], size - pos);
+			pos = size;
+			continue;
+		}
+
+		if (rle_size[i] < raw)
+		{
+			memset(rle, 0, cell + 4);
+			EncodeRle(&cells[i * cell], font->Width, font->LineHeight, rle);
+			memcpy(&bits[pos], rle, rle_size[i]);
+			offsets[i] = (uint16_t)(pos | 0x8000);
+			size = rle_size[i];
+		}
+		else
+		{
+			for (x = 0; x < font->Width; x++)
+			{
+				for (y = 0; y < font->LineHeight; y++)
+				{
+					k = (size_t)x * font->LineHeight + y;
+					bits[pos + k / 8] |= (uint8_t)(cells[i * cell + y * font->Width + x] << (k & 7));
+				}
+			}
+
+			offsets[i] = (uint16_t)pos;
+			size = raw;
+		}
+
+		EmitBytes(f, &bits[pos], size);
+		pos += size;
+	}
+
+	offsets[n] = (uint16_t)pos;
+	fprintf(f, "};\n\n");
+
+	if (coded < plain)
+	{
+		fprintf(f, "static const uint16_t %s_Offsets[] = {\n", font->Name);
+
+		for (i = 0; i <= n; i++)
+		{
+			fprintf(f, "%s0x%04X,%s", (i % 12 == 0) ? "\t" : "", offsets[i], (i % 12 == 11 || i == n) ? "\n" : " ");
+		}
+
+		fprintf(f, "};\n\n");
+	}
+
+	fprintf(f, "static const OLED_FontPacked_t %s_Packed = { %s%s, %s_Bits };\n\n", font->Name,
+	        (coded < plain) ? font->Name : "NULL", (coded < plain) ? "_Offsets" : "", font->Name);
+	font->Flash += ((coded < plain) ? coded : plain) + TARGET_PACKED;
+
+	EmitCharset(font, f, glyphs, n);
+	snprintf(tables, sizeof(tables), "NULL, NULL, NULL, &%s_Packed", font->Name);
+	EmitFontDef(font, f, n, tables);
+
+	free(cells);
+	free(bits);
+	free(rle);
+	free(rle_size);
+	free(offsets);
+}
+
+
+static int CompareKern(const void *a, const void *b)
+{
+	const Kern_t *x = a, *y = b;
+
+	return (x->Left != y->Left) ? x->Left - y->Left : x->Right - y->Right;
+}
+
+
+/* Glyphs cropped to their ink with their own advances */
+static void EmitProp(Font_t *font, FILE *f, const int *glyphs, int n)
+{
+	size_t *start = Alloc(n * sizeof(size_t)), total = 0, size;
+	const Glyph_t *g;
+	char tables[256];
+	uint8_t *raw;
+	int i, k;
+
+	font->Width = 1;
+
+	for (i = 0; i < n; i++)
+	{
+		g = Drawn(font, glyphs[i]);
+
+		if (g->Advance < 0 || g->Advance > 255 || g->Width > 255 || g->Height > 255 || g->X < -128 || g->X > 127 ||
+		    g->Y < -128 || g->Y > 127 || font->LineHeight > 255)
+		{
+			font->Error = "glyphs too large for OLED_FontGlyph_t";
+			free(start);
+			return;
+		}
+
+		font->Width = (g->Advance > font->Width) ? g->Advance : font->Width;
+	}
+
+	fprintf(f, "static const uint8_t %s_Bitmap[] = {\n", font->Name);
+
+	for (i = 0; i < n; i++)
+	{
+		g = Drawn(font, glyphs[i]);
+		start[i] = total;
+
+		/* Missing characters share the fallback's bitmap, blank ones have none */
+		if (g != &font->Glyphs[glyphs[i]] || g->Width == 0)
+		{
+			continue;
+		}
+
+		raw = PageMajor(g->Ink, g->Width, g->Height, &size);
+		EmitCharComment(f, font->Chars->Codes[glyphs[i]]);
+		EmitBytes(f, raw, size);
+		total += size;
+		free(raw);
+	}
+
+	for (i = 0; i < n; i++)
+	{
+		start[i] = (Drawn(font, glyphs[i]) != &font->Glyphs[glyphs[i]]) ? start[font->FallbackIndex] : start[i];
+	}
+
+	if (total == 0 || total > 65535)
+	{
+		font->Error = "glyph data does not fit OLED_FontGlyph_t";
+		free(start);
+		return;
+	}
+
+	fprintf(f, "};\n\nstatic const OLED_FontGlyph_t %s_Glyphs[] = {\n", font->Name);
+
+	for (i = 0; i < n; i++)
+	{
+		g = Drawn(font, glyphs[i]);
+		fprintf(f, "\t{ %5lu, %2d, %2d, %3d, %3d, %3d },", (unsigned long)start[i], g->Width, g->Height, g->X, g->Y, g->Advance);
+		EmitCharComment(f, font->Chars->Codes[glyphs[i]]);
+	}
+
+	fprintf(f, "};\n\n");
+	font->Flash += total + n * TARGET_GLYPH + TARGET_METRICS;
+
+	if (font->KerningCount != 0)
+	{
+		qsort(font->Kerning, font->KerningCount, sizeof(Kern_t), CompareKern);
+		fprintf(f, "static const OLED_FontKern_t %s_Kerning[] = {\n", font->Name);
+
+		for (k = 0; k < font->KerningCount; k++)
+		{
+			fprintf(f, "%s{ 0x%02X, 0x%02X, %2d },%s", (k % 6 == 0) ? "\t" : "", font->Kerning[k].Left,
+			        font->Kerning[k].Right, font->Kerning[k].Adjust, (k % 6 == 5 || k == font->KerningCount - 1) ? "\n" : " ");
+		}
+
+		fprintf(f, "};\n\n");
+		font->Flash += font->KerningCount * TARGET_KERN;
+		fprintf(f, "static const OLED_FontMetrics_t %s_Metrics = { %s_Glyphs, %s_Bitmap, %s_Kerning, %d };\n\n",
+		        font->Name, font->Name, font->Name, font->Name, font->KerningCount);
+	}
+	else
+	{
+		fprintf(f, "static const OLED_FontMetrics_t %s_Metrics = { %s_Glyphs, %s_Bitmap, NULL, 0 };\n\n",
+		        font->Name, font->Name, font->Name);
+	}
+
+	EmitCharset(font, f, glyphs, n);
+	snprintf(tables, sizeof(tables), "NULL, NULL, &%s_Metrics, NULL", font->Name);
+	EmitFontDef(font, f, n, tables);
+	free(start);
+}
+
+
+/* Loads a font and writes its tables into its own temporary file */
+static void CompileFont(Font_t *font)
+{
+	int *glyphs, n, i;
+
+	font->Glyphs = Alloc(font->Chars->Count * sizeof(Glyph_t));
+
+	if (IsTrueType(font->Path))
+	{
+		LoadTrueType(font);
+	}
+	else
+	{
+		LoadBdf(font);
+	}
+
+	font->Out = tmpfile();
+
+	if (font->Out == NULL)
+	{
+		Fail("cannot create a temporary file");
+	}
+
+	glyphs = TableOrder(font, &n);
+
+	/* --fallback if the font has it, else '?' */
+	font->Fallback = FindCode(font->Chars, font->FallbackCode);
+
+	if (font->Fallback < 0 || !font->Glyphs[font->Fallback].Present)
+	{
+		font->Fallback = font->Glyphs['?' - ' '].Present ? '?' - ' ' : -1;
+	}
+
+	for (i = 0, font->FallbackIndex = 0; font->Fallback >= 0 && glyphs[i] != font->Fallback; i++)
+	{
+		font->FallbackIndex = i + 1;
+	}
+
+	if (font->Format == FORMAT_PAGE)
+	{
+		EmitPage(font, font->Out, glyphs, n);
+	}
+	else if (font->Format == FORMAT_PACKED)
+	{
+		EmitPacked(font, font->Out, glyphs, n);
+	}
+	else
+	{
+		EmitProp(font, font->Out, glyphs, n);
+	}
+
+	font->Missing = Alloc(font->Chars->Count);
+
+	for (i = 0; i < font->Chars->Count; i++)
+	{
+		font->Missing[i] = !font->Glyphs[i].Present;
+		free(font->Glyphs[i].Ink);
+	}
+
+	free(font->Glyphs);
+	free(font->Kerning);
+	free(glyphs);
+}
+
+
+/* Worker: takes fonts in order until none are left */
+static void *CompileWorker(void *arg)
+{
+	Job_t *job = arg;
+	int i;
+
+	for (;;)
+	{
+		pthread_mutex_lock(&job->Lock);
+		i = (job->Next < job->Count) ? job->Next++ : -1;
+		pthread_mutex_unlock(&job->Lock);
+
+		if (i < 0)
+		{
+			return NULL;
+		}
+
+		CompileFont(&job->Fonts[i]);
+	}
+}
+
+
+/* Lists the characters a font lacks as ranges */
+static void PrintMissing(FILE *f, const Font_t *font)
+{
+	const Chars_t *chars = font->Chars;
+	int i, j;
+
+	for (i = 0; i < chars->Count; i = j)
+	{
+		for (j = i + 1; j < chars->Count && font->Missing[i] && font->Missing[j] && chars->Codes[j] == chars->Codes[j - 1] + 1; j++)
+		{
+		}
+
+		if (!font->Missing[i])
+		{
+			continue;
+		}
+
+		if (j - 1 > i)
+		{
+			fprintf(f, " U+%04X-U+%04X", (unsigned)chars->Codes[i], (unsigned)chars->Codes[j - 1]);
+		}
+		else
+		{
+			fprintf(f, " U+%04X", (unsigned)chars->Codes[i]);
+		}
+	}
+
+	fprintf(f, "\n");
+}
+
+
+static void FreeFonts(Job_t *job, Chars_t **sets, int set_count)
+{
+	int i;
+
+	for (i = 0; i < job->Count; i++)
+	{
+		free(job->Fonts[i].Missing);
+	}
+
+	for (i = 0; i < set_count; i++)
+	{
+		free(sets[i]->Codes);
+		free(sets[i]);
+	}
+
+	free(sets);
+	free(job->Fonts);
+}
+
+
+/************************************************ Main *******************************************************/
+
+static void Usage(void)
+{
+	fprintf(stderr,
+	        "usage: oled_fontc [options] -o fonts.c font.bdf|font.ttf ...\n"
+	        "  -n name  --format page|packed|prop  --chars list  --fallback code  --size list  --threshold n\n"
+	        "  --report  -j threads\n");
+	exit(2);
+}
+
+
+int main(int argc, char **argv)
+{
+	Job_t job;
+	Font_t *font;
+	Chars_t **sets = Alloc((size_t)argc * sizeof(Chars_t *));
+	const Chars_t *chars;
+	const char *output = NULL, *name = NULL, *s;
+	char path[1024], guard[256], buf[4096], base[96];
+	uint32_t fallback = '?';
+	int format = FORMAT_PAGE, threshold = -1, report = 0, threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+	int sizes[MAX_SIZES] = { 12 }, size_count = 1, set_count = 0, a, i, k, f;
+	size_t n, total = 0;
+	FILE *c, *h;
+
+	memset(&job, 0, sizeof(job));
+	job.Fonts = Alloc((size_t)argc * MAX_SIZES * FORMAT_COUNT * sizeof(Font_t));
+	chars = sets[set_count++] = ParseChars(NULL);
+
+	for (a = 1; a < argc; a++)
+	{
+		if (!strcmp(argv[a], "-n") && a + 1 < argc)
+		{
+			name = argv[++a];
+		}
+		else if (!strcmp(argv[a], "-o") && a + 1 < argc)
+		{
+			output = argv[++a];
+		}
+		else if (!strcmp(argv[a], "--format") && a + 1 < argc)
+		{
+			for (a++, format = 0; format < FORMAT_COUNT && strcmp(argv[a], FormatName[format]); format++)
+			{
+			}
+
+			if (format == FORMAT_COUNT)
+			{
+				Usage();
+			}
+		}
+		else if (!strcmp(argv[a], "--chars") && a + 1 < argc)
+		{
+			chars = sets[set_count++] = ParseChars(argv[++a]);
+		}
+		else if (!strcmp(argv[a], "--size") && a + 1 < argc)
+		{
+			for (s = argv[++a], size_count = 0; *s && size_count < MAX_SIZES; s += (*s == ','))
+			{
+				sizes[size_count] = (int)strtol(s, (char **)&s, 10);
+
+				if (sizes[size_count++] <= 0 || (*s != ',' && *s != '\0'))
+				{
+					Usage();
+				}
+			}
+		}
+		else if (!strcmp(argv[a], "--fallback") && a + 1 < argc)
+		{
+			fallback = (uint32_t)strtoul(argv[++a], NULL, 0);
+		}
+		else if (!strcmp(argv[a], "--threshold") && a + 1 < argc)
+		{
+			threshold = atoi(argv[++a]);
+		}
+		else if (!strcmp(argv[a], "--report"))
+		{
+			report = 1;
+		}
+		else if (!strcmp(argv[a], "-j") && a + 1 < argc)
+		{
+			threads = atoi(argv[++a]);
+		}
+		else if (argv[a][0] == '-')
+		{
+			Usage();
+		}
+		else
+		{
+			/* One font per size (TrueType) and, for --report, per format */
+			snprintf(base, sizeof(base), "%s", BaseName(argv[a]));
+
+			if (strrchr(base, '.') != NULL)
+			{
+				*strrchr(base, '.') = '\0';
+			}
+
+			for (k = 0; base[k]; k++)
+			{
+				base[k] = isalnum((unsigned char)base[k]) ? base[k] : '_';
+			}
+
+			for (i = 0; i < (IsTrueType(argv[a]) ? size_count : 1); i++)
+			{
+				for (f = report ? 0 : format; f < (report ? FORMAT_COUNT : format + 1); f++)
+				{
+					font = &job.Fonts[job.Count++];
+					font->Path = argv[a];
+					font->Format = f;
+					font->Size = IsTrueType(argv[a]) ? sizes[i] : 0;
+					font->Threshold = threshold;
+					font->FallbackCode = fallback;
+					font->Chars = chars;
+
+					if (name != NULL)
+					{
+						snprintf(font->Name, sizeof(font->Name), (size_count > 1 && IsTrueType(argv[a])) ? "%s_%d" : "%s",
+						         name, font->Size);
+					}
+					else
+					{
+						snprintf(font->Name, sizeof(font->Name), font->Size ? "OLED_Font_%s%s_%d" : "OLED_Font_%s%s",
+						         FormatPrefix[f], base, font->Size);
+					}
+				}
+			}
+
+			name = NULL;
+		}
+	}
+
+	n = output ? strlen(output) : 0;
+
+	if (job.Count == 0 || (!report && (n < 3 || strcmp(output + n - 2, ".c") || n >= sizeof(path))))
+	{
+		Usage();
+	}
+
+	for (i = 0; !report && i < job.Count; i++)
+	{
+		for (k = 0; k < i; k++)
+		{
+			if (!strcmp(job.Fonts[i].Name, job.Fonts[k].Name))
+			{
+				Fail("two fonts named %s, give one of them another with -n", job.Fonts[i].Name);
+			}
+		}
+	}
+
+	threads = (threads < 1) ? 1 : (threads > job.Count) ? job.Count : threads;
+
+	/* Fonts are independent, each worker takes the next one */
+	{
+		pthread_t *t = Alloc(threads * sizeof(pthread_t));
+
+		pthread_mutex_init(&job.Lock, NULL);
+
+		for (i = 0; i < threads; i++)
+		{
+			if (pthread_create(&t[i], NULL, CompileWorker, &job) != 0)
+			{
+				Fail("cannot start a worker thread");
+			}
+		}
+
+		for (i = 0; i < threads; i++)
+		{
+			pthread_join(t[i], NULL);
+		}
+
+		pthread_mutex_destroy(&job.Lock);
+		free(t);
+	}
+
+	if (report)
+	{
+		printf("%-32s %-8s %5s %11s %8s %8s %8s\n", "font", "size", "cells", "characters", "page", "packed", "prop");
+	}
+
+	for (i = 0; i < job.Count; i += report ? FORMAT_COUNT : 1)
+	{
+		font = &job.Fonts[i];
+
+		if (report)
+		{
+			if (font->Size != 0)
+			{
+				printf("%-32s %-8d", BaseName(font->Path), font->Size);
+			}
+			else
+			{
+				printf("%-32s %-8s", BaseName(font->Path), "-");
+			}
+
+			printf(" %2dx%-2d %5d/%-5d", job.Fonts[i + FORMAT_PACKED].Width,
+			       job.Fonts[i + FORMAT_PACKED].LineHeight, font->Present, font->Chars->Count);
+
+			for (f = 0; f < FORMAT_COUNT; f++)
+			{
+				if (job.Fonts[i + f].Error != NULL)
+				{
+					printf(" %8s", "-");
+				}
+				else
+				{
+					printf(" %8lu", (unsigned long)job.Fonts[i + f].Flash);
+				}
+			}
+
+			printf("\n");
+		}
+		else if (font->Error != NULL)
+		{
+			Fail("%s: %s", font->Name, font->Error);
+		}
+		else
+		{
+			fprintf(stderr, "%-32s %s, %d x %d, %d of %d characters, %lu bytes%s\n", font->Name, FormatName[font->Format],
+			        font->Width, font->LineHeight, font->Present, font->Chars->Count, (unsigned long)font->Flash,
+			        font->Clipped ? ", pixels outside the cell clipped" : "");
+			total += font->Flash;
+		}
+
+		if (font->Present != font->Chars->Count)
+		{
+			fprintf(report ? stdout : stderr, "%-32s missing", "");
+			PrintMissing(report ? stdout : stderr, font);
+		}
+	}
+
+	if (report)
+	{
+		FreeFonts(&job, sets, set_count);
+		return 0;
+	}
+
+	c = fopen(output, "wb");
+	memcpy(path, output, n + 1);
+	path[n - 1] = 'h';
+	h = fopen(path, "wb");
+
+	if (c == NULL || h == NULL)
+	{
+		Fail("cannot write %s", (c == NULL) ? output : path);
+	}
+
+	for (k = 0, s = BaseName(path); s[k] && k < (int)sizeof(guard) - 1; k++)
+	{
+		guard[k] = isalnum((unsigned char)s[k]) ? (char)toupper((unsigned char)s[k]) : '_';
+	}
+
+	guard[k] = '\0';
+	fprintf(h, "/* Generated by oled_fontc, do not edit */\n\n#ifndef %s\n#define %s\n\n#include \"OLED_SSD1306_Fonts.h\"\n\n",
+	        guard, guard);
+	fprintf(c, "/* Generated by oled_fontc, do not edit */\n\n#include \"%s\"\n", BaseName(path));
+
+	for (i = 0; i < job.Count; i++)
+	{
+		font = &job.Fonts[i];
+		fprintf(c, "\n/* %s", BaseName(font->Path));
+		fprintf(c, font->Size ? ", %d px" : "", font->Size);
+		fprintf(c, ": %s, %d x %d, %d of %d characters, %lu bytes */\n\n", FormatName[font->Format], font->Width,
+		        font->LineHeight, font->Present, font->Chars->Count, (unsigned long)font->Flash);
+
+		rewind(font->Out);
+
+		while ((n = fread(buf, 1, sizeof(buf), font->Out)) != 0)
+		{
+			fwrite(buf, 1, n, c);
+		}
+
+		fclose(font->Out);
+
+		fprintf(h, "/* %s", BaseName(font->Path));
+		fprintf(h, font->Size ? ", %d px" : "", font->Size);
+		fprintf(h, ", %s, %d x %d, %lu bytes */\nextern OLED_FontDef_t %s;\n\n", FormatName[font->Format], font->Width,
+		        font->LineHeight, (unsigned long)font->Flash, font->Name);
+	}
+
+	fprintf(h, "#endif\n");
+	fclose(c);
+	fclose(h);
+
+	fprintf(stderr, "%d fonts, %lu bytes\n", job.Count, (unsigned long)total);
+	FreeFonts(&job, sets, set_count);
+	return 0;
+}
@@ -0,0 +1,953 @@
+/**
+  **********************************************************************************************************************
+   * @file   : oled_subset.c
+   * @author : Sharath N
+   * @brief  : Host font subsetter, keeps only the glyphs a firmware draws from the fonts in OLED_SSD1306_Fonts.c
+  **********************************************************************************************************************
+*/
+
+/*
+          Build on the host, together with the firmware's font tables it reads:
+
+              gcc -std=c99 -O2 -Wall -I../../OLED_SSD1306_Fonts -o oled_subset oled_subset.c \
+                  ../../OLED_SSD1306_Fonts/OLED_SSD1306_Fonts.c
+
+          The manifest names every font the firmware uses and the characters it draws with it, as C string
+          literals (UTF-8, escapes allowed). '*' stands for every character of the string and character
+          literals in the --scan files, whose font the tool cannot know:
+
+              # font               characters
+              OLED_Font_16x26      "0123456789.-"
+              OLED_Font_7x10       * "\xC2\xB0"
+              OLED_Font_Prop11x18  "Settings" "Back"
+
+              oled_subset --manifest fonts.txt -o OLED_SSD1306_FontSubset.c --scan ../Src/main.c ../Src/menu.c
+
+          writes the listed fonts, under their usual names, with just those glyphs, space and the font's
+          fallback glyph. Characters the driver makes up itself are not in any literal and have to be listed:
+          the digits, signs and '.' of OLED_SSD1306_PutInt(), PutFixed() and PutHex(), and the "..." of text
+          boxes that run out of lines. Characters ' ' to '~' reach their glyph through a 95 byte map, so
+          drawing stays one table lookup; other codepoints keep the font's ranges. Kerning pairs of dropped
+          glyphs are dropped too. Fonts missing from the manifest are not written at all, a firmware still
+          using one fails to link instead of drawing nothing.
+
+          Build step: run the command before every build (Keil: Options for Target, User, Before Build/Rebuild),
+          add the output file to the project and define OLED_FONTS_SUBSET for all files (C/C++, Preprocessor
+          Symbols), which removes the full tables from OLED_SSD1306_Fonts.c. The output depends only on the
+          manifest and the scanned files, so the file only changes when the text does.
+
+          Every glyph written is compared with the original through OLED_FONTS_GetGlyph(), and the flash taken
+          before and after, from OLED_FONTS_GetFlashSize(), is printed for each font.
+
+          Options:
+              --manifest file      Fonts and characters to keep
+              -o file.c            Output file
+              --scan file ...      C sources to take the characters of '*' from, up to the next option
+*/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <ctype.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "OLED_SSD1306_Fonts.h"
+
+/* Codepoints a font table can hold, ranges are 16 bit */
+#define SUBSET_CODEPOINTS            0x10000
+
+/* A set of codepoints, one bit each */
+typedef struct {
+	uint8_t Bits[SUBSET_CODEPOINTS / 8];
+} Charset_t;
+
+/* A font of the firmware and what the manifest asks of it */
+typedef struct {
+	const char *Name;
+	OLED_FontDef_t *Font;
+	int Listed;
+	int Scanned;          /* '*' in the manifest */
+	Charset_t Chars;
+} Entry_t;
+
+/* The subset of one font, built in memory, measured and checked before it is written */
+typedef struct {
+	OLED_FontDef_t Font;
+	OLED_FontCharset_t Charset;
+	OLED_FontMetrics_t Metrics;
+	OLED_FontPacked_t Packed;
+	uint16_t *Old;        /* Original glyph of each kept glyph */
+	uint16_t Count;
+	uint16_t *Rows;
+	uint8_t *Pages;
+	OLED_FontGlyph_t *Glyphs;
+	uint8_t *Bitmap;
+	uint32_t BitmapSize;
+	OLED_FontKern_t *Kerning;
+	uint8_t *Bits;
+	uint32_t BitsSize;
+	uint16_t *Offsets;
+	OLED_FontRange_t *Ranges;
+	uint8_t Map[OLED_FONTS_CHARS];
+} Subset_t;
+
+static Entry_t Entries[] = {
+	{ "OLED_Font_7x10",        &OLED_Font_7x10,        0, 0, { { 0 } } },
+	{ "OLED_Font_11x18",       &OLED_Font_11x18,       0, 0, { { 0 } } },
+	{ "OLED_Font_16x26",       &OLED_Font_16x26,       0, 0, { { 0 } } },
+	{ "OLED_Font_Packed7x10",  &OLED_Font_Packed7x10,  0, 0, { { 0 } } },
+	{ "OLED_Font_Packed11x18", &OLED_Font_Packed11x18, 0, 0, { { 0 } } },
+	{ "OLED_Font_Packed16x26", &OLED_Font_Packed16x26, 0, 0, { { 0 } } },
+	{ "OLED_Font_Prop7x10",    &OLED_Font_Prop7x10,    0, 0, { { 0 } } },
+	{ "OLED_Font_Prop11x18",   &OLED_Font_Prop11x18,   0, 0, { { 0 } } },
+};
+
+#define ENTRY_COUNT                  ((int)(sizeof(Entries) / sizeof(Entries[0])))
+
+static Charset_t ScanChars;
+
+
+static void Fail(const char *fmt, ...)
+{
+	va_list ap;
+
+	va_start(ap, fmt);
+	fprintf(stderr, "oled_subset: ");
+	vfprintf(stderr, fmt, ap);
+	fprintf(stderr, "\n");
+	va_end(ap);
+	exit(1);
+}
+
+
+static void *Alloc(size_t n)
+{
+	void *p = calloc(n ? n : 1, 1);
+
+	if (p == NULL)
+	{
+		Fail("out of memory");
+	}
+
+	return p;
+}
+
+
+static char *LoadText(const char *path)
+{
+	FILE *f = fopen(path, "rb");
+	char *text;
+	long n;
+
+	if (f == NULL || fseek(f, 0, SEEK_END) != 0 || (n = ftell(f)) < 0 || fseek(f, 0, SEEK_SET) != 0)
+	{
+		Fail("cannot read %s", path);
+	}
+
+	text = Alloc((size_t)n + 1);
+
+	if (fread(text, 1, (size_t)n, f) != (size_t)n)
+	{
+		Fail("cannot read %s", path);
+	}
+
+	fclose(f);
+	return text;
+}
+
+
+static void Add(Charset_t *set, uint32_t cp)
+{
+	if (cp >= ' ' && cp < SUBSET_CODEPOINTS)
+	{
+		set->Bits[cp / 8] |= (uint8_t)(1 << (cp & 7));
+	}
+}
+
+
+static int Has(const Charset_t *set, uint32_t cp)
+{
+	return cp < SUBSET_CODEPOINTS && (set->Bits[cp / 8] >> (cp & 7)) & 1;
+}
+
+
+/******************************************** Literal scanning ***********************************************/
+
+/**
+ * @brief  Adds the characters of a string or character literal to set
+ * @param  *p: First character after the opening quote
+ * @retval The character after the closing quote
+ */
+static const char *ScanLiteral(const char *p, char quote, Charset_t *set)
+{
+	char bytes[4096];
+	const char *s;
+	size_t n = 0;
+	uint32_t cp;
+	int digits;
+
+	while (*p && *p != quote && *p != '\n')
+	{
+		cp = (uint8_t)*p++;
+
+		if (cp == '\\' && *p)
+		{
+			cp = (uint8_t)*p++;
+
+			if (cp == 'x')
+			{
+				for (cp = 0; isxdigit((unsigned char)*p); p++)
+				{
+					cp = cp * 16 + (isdigit((unsigned char)*p) ? *p - '0' : (tolower((unsigned char)*p) - 'a' + 10));
+				}
+			}
+			else if (cp >= '0' && cp <= '7')
+			{
+				for (cp -= '0', digits = 1; digits < 3 && *p >= '0' && *p <= '7'; digits++)
+				{
+					cp = cp * 8 + (uint32_t)(*p++ - '0');
+				}
+			}
+			else
+			{
+				/* Control characters are not drawn, only the quotes and the backslash count */
+				cp = strchr("\"'\\?", (int)cp) ? cp : '\n';
+			}
+		}
+
+		if (n < sizeof(bytes) - 1)
+		{
+			bytes[n++] = (char)cp;
+		}
+	}
+
+	bytes[n] = '\0';
+
+	/* The same decoding as the firmware, so a malformed sequence keeps the fallback glyph */
+	for (s = bytes; (cp = OLED_FONTS_DecodeUtf8(&s)) != 0; )
+	{
+		Add(set, cp);
+	}
+
+	return (*p == quote) ? p + 1 : p;
+}
+
+
+/* Adds the characters of all string and character literals of a C source file, comments and #include skipped */
+static void ScanFile(const char *path)
+{
+	char *text = LoadText(path);
+	const char *p = text, *q;
+
+	while (*p)
+	{
+		if (p[0] == '/' && p[1] == '/')
+		{
+			p += strcspn(p, "\n");
+		}
+		else if (p[0] == '/' && p[1] == '*')
+		{
+			q = strstr(p + 2, "*/");
+			p = q ? q + 2 : p + strlen(p);
+		}
+		else if (*p == '#')
+		{
+			for (q = p + 1; *q == ' ' || *q == '\t'; q++)
+			{
+			}
+
+			p = strncmp(q, "include", 7) ? p + 1 : p + strcspn(p, "\n");
+		}
+		else if (*p == '"' || *p == '\'')
+		{
+			p = ScanLiteral(p + 1, *p, &ScanChars);
+		}
+		else
+		{
+			p++;
+		}
+	}
+
+	free(text);
+}
+
+
+/* Reads the manifest: a font name per line, then literals and '*' */
+static void ReadManifest(const char *path)
+{
+	char *text = LoadText(path), *p = text, name[64];
+	Entry_t *e;
+	int line = 1, i, n;
+
+	while (*p)
+	{
+		while (*p == ' ' || *p == '\t' || *p == '\r')
+		{
+			p++;
+		}
+
+		if (*p == '\n' || *p == '#' || *p == '\0')
+		{
+			p += strcspn(p, "\n");
+			line += (*p == '\n');
+			p += (*p == '\n');
+			continue;
+		}
+
+		for (n = 0; (isalnum((unsigned char)*p) || *p == '_') && n < (int)sizeof(name) - 1; n++)
+		{
+			name[n] = *p++;
+		}
+
+		name[n] = '\0';
+
+		for (i = 0, e = NULL; i < ENTRY_COUNT; i++)
+		{
+			if (strcmp(Entries[i].Name, name) == 0)
+			{
+				e = &Entries[i];
+			}
+		}
+
+		if (e == NULL)
+		{
+			Fail("%s:%d: unknown font '%s'", path, line, name);
+		}
+
+		e->Listed = 1;
+
+		while (*p && *p != '\n')
+		{
+			if (*p == '"' || *p == '\'')
+			{
+				p = (char *)ScanLiteral(p + 1, *p, &e->Chars);
+			}
+			else if (*p == '*')
+			{
+				e->Scanned = 1;
+				p++;
+			}
+			else if (*p == '#')
+			{
+				p += strcspn(p, "\n");
+			}
+			else if (*p == ' ' || *p == '\t' || *p == '\r')
+			{
+				p++;
+			}
+			else
+			{
+				Fail("%s:%d: expected a string literal or '*'", path, line);
+			}
+		}
+	}
+
+	free(text);
+}
+
+
+/******************************************** Subsetting *****************************************************/
+
+/* Glyph of a font drawn for codepoints it does not have */
+static uint16_t FallbackGlyph(const OLED_FontDef_t *font)
+{
+	return (font->charset != NULL) ? font->charset->Fallback : (uint16_t)('?' - ' ');
+}
+
+
+static uint16_t GlyphCount(const OLED_FontDef_t *font)
+{
+	return (font->charset != NULL) ? font->charset->GlyphCount : OLED_FONTS_CHARS;
+}
+
+
+/* Index of an original glyph among the kept ones, appended when it is new */
+static uint16_t Keep(Subset_t *sub, uint16_t old)
+{
+	uint16_t i;
+
+	for (i = 0; i < sub->Count; i++)
+	{
+		if (sub->Old[i] == old)
+		{
+			return i;
+		}
+	}
+
+	sub->Old[sub->Count] = old;
+	return sub->Count++;
+}
+
+
+/* Bits start .. start + n of src to dst at bit pos, LSB first */
+static void CopyBits(uint8_t *dst, uint32_t pos, const uint8_t *src, uint32_t start, uint32_t n)
+{
+	uint32_t i, b;
+
+	for (i = 0; i < n; i++)
+	{
+		b = (src[(start + i) / 8] >> ((start + i) & 7)) & 1;
+		dst[(pos + i) / 8] |= (uint8_t)(b << ((pos + i) & 7));
+	}
+}
+
+
+static void BuildSubset(const Entry_t *e, Subset_t *sub)
+{
+	const OLED_FontDef_t *font = e->Font;
+	uint16_t pages = (font->FontHeight + 7) / 8, fallback, i, g, k, ranges = 1;
+	uint32_t cp, bits, pos, size, start, end;
+	const OLED_FontGlyph_t *glyph;
+
+	memset(sub, 0, sizeof(*sub));
+	sub->Old = Alloc((GlyphCount(font) + 1) * sizeof(uint16_t));
+	sub->Ranges = Alloc(SUBSET_CODEPOINTS / 64 * sizeof(OLED_FontRange_t) + sizeof(OLED_FontRange_t));
+
+	/* ' ' to '~' first, the fallback next, then everything else in codepoint order */
+	for (cp = ' '; cp <= '~'; cp++)
+	{
+		if (Has(&e->Chars, cp))
+		{
+			Keep(sub, (uint16_t)(cp - ' '));
+		}
+	}
+
+	fallback = Keep(sub, FallbackGlyph(font));
+
+	for (cp = ' '; cp <= '~'; cp++)
+	{
+		sub->Map[cp - ' '] = Has(&e->Chars, cp) ? (uint8_t)Keep(sub, (uint16_t)(cp - ' ')) : (uint8_t)fallback;
+	}
+
+	/* Ranges of consecutive codepoints with consecutive kept glyphs, after the placeholder for ' ' to '~' */
+	sub->Ranges[0].First = ' ';
+	sub->Ranges[0].Last = '~';
+	sub->Ranges[0].Index = 0;
+
+	for (cp = '~' + 1; cp < SUBSET_CODEPOINTS; cp++)
+	{
+		g = OLED_FONTS_GetGlyph(font, cp);
+
+		if (!Has(&e->Chars, cp) || g == FallbackGlyph(font))
+		{
+			continue;
+		}
+
+		k = Keep(sub, g);
+
+		if (ranges > 1 && sub->Ranges[ranges - 1].Last == cp - 1 &&
+		    sub->Ranges[ranges - 1].Index + (cp - sub->Ranges[ranges - 1].First) == k)
+		{
+			sub->Ranges[ranges - 1].Last = (uint16_t)cp;
+		}
+		else
+		{
+			if (ranges > SUBSET_CODEPOINTS / 64)
+			{
+				Fail("%s: too many separate characters", e->Name);
+			}
+
+			sub->Ranges[ranges].First = (uint16_t)cp;
+			sub->Ranges[ranges].Last = (uint16_t)cp;
+			sub->Ranges[ranges].Index = k;
+			ranges++;
+		}
+	}
+
+	sub->Charset.Ranges = sub->Ranges;
+	sub->Charset.RangeCount = ranges;
+	sub->Charset.GlyphCount = sub->Count;
+	sub->Charset.Fallback = fallback;
+	sub->Charset.Map = sub->Map;
+
+	sub->Font = *font;
+	sub->Font.charset = &sub->Charset;
+
+	if (font->data != NULL)
+	{
+		sub->Rows = Alloc((size_t)sub->Count * font->FontHeight * sizeof(uint16_t));
+
+		for (i = 0; i < sub->Count; i++)
+		{
+			memcpy(&sub->Rows[i * font->FontHeight], &font->data[sub->Old[i] * font->FontHeight],
+			       font->FontHeight * sizeof(uint16_t));
+		}
+
+		sub->Font.data = sub->Rows;
+	}
+
+	if (font->glyphs != NULL)
+	{
+		size = (uint32_t)pages * font->FontWidth;
+		sub->Pages = Alloc((size_t)sub->Count * size);
+
+		for (i = 0; i < sub->Count; i++)
+		{
+			memcpy(&sub->Pages[i * size], &font->glyphs[sub->Old[i] * size], size);
+		}
+
+		sub->Font.glyphs = sub->Pages;
+	}
+
+	if (font->metrics != NULL)
+	{
+		sub->Glyphs = Alloc(sub->Count * sizeof(OLED_FontGlyph_t));
+		sub->Bitmap = Alloc(1);
+
+		for (i = 0; i < sub->Count; i++)
+		{
+			glyph = &font->metrics->Glyphs[sub->Old[i]];
+			size = (uint32_t)glyph->Width * ((glyph->Height + 7) / 8);
+			sub->Glyphs[i] = *glyph;
+			sub->Glyphs[i].Start = (uint16_t)sub->BitmapSize;
+			sub->Bitmap = realloc(sub->Bitmap, sub->BitmapSize + size + 1);
+
+			if (sub->Bitmap == NULL)
+			{
+				Fail("out of memory");
+			}
+
+			memcpy(&sub->Bitmap[sub->BitmapSize], &font->metrics->Bitmap[glyph->Start], size);
+			sub->BitmapSize += size;
+		}
+
+		/* Pairs of two kept characters */
+		sub->Kerning = Alloc((font->metrics->KerningCount + 1) * sizeof(OLED_FontKern_t));
+		sub->Metrics.KerningCount = 0;
+
+		for (i = 0; i < font->metrics->KerningCount; i++)
+		{
+			if (Has(&e->Chars, font->metrics->Kerning[i].Left) && Has(&e->Chars, font->metrics->Kerning[i].Right))
+			{
+				sub->Kerning[sub->Metrics.KerningCount++] = font->metrics->Kerning[i];
+			}
+		}
+
+		sub->Metrics.Glyphs = sub->Glyphs;
+		sub->Metrics.Bitmap = sub->Bitmap;
+		sub->Metrics.Kerning = (sub->Metrics.KerningCount != 0) ? sub->Kerning : NULL;
+		sub->Font.metrics = &sub->Metrics;
+	}
+
+	if (font->packed != NULL)
+	{
+		if (font->packed->Offsets == NULL)
+		{
+			/* Glyphs back to back without padding: moved bit by bit */
+			bits = (uint32_t)font->FontWidth * font->FontHeight;
+			sub->BitsSize = (sub->Count * bits + 7) / 8;
+			sub->Bits = Alloc(sub->BitsSize);
+
+			for (i = 0; i < sub->Count; i++)
+			{
+				CopyBits(sub->Bits, i * bits, font->packed->Bits, sub->Old[i] * bits, bits);
+			}
+		}
+		else
+		{
+			sub->Offsets = Alloc((sub->Count + 1) * sizeof(uint16_t));
+			sub->Bits = Alloc((font->packed->Offsets[GlyphCount(font)] & 0x7FFF) + 1);
+
+			for (i = 0, pos = 0; i < sub->Count; i++)
+			{
+				start = font->packed->Offsets[sub->Old[i]] & 0x7FFF;
+				end = font->packed->Offsets[sub->Old[i] + 1] & 0x7FFF;
+				sub->Offsets[i] = (uint16_t)(pos | (font->packed->Offsets[sub->Old[i]] & 0x8000));
+				memcpy(&sub->Bits[pos], &font->packed->Bits[start], end - start);
+				pos += end - start;
+			}
+
+			sub->Offsets[sub->Count] = (uint16_t)pos;
+			sub->BitsSize = pos;
+		}
+
+		sub->Packed.Offsets = sub->Offsets;
+		sub->Packed.Bits = sub->Bits;
+		sub->Font.packed = &sub->Packed;
+	}
+}
+
+
+static void FreeSubset(Subset_t *sub)
+{
+	free(sub->Old);
+	free(sub->Rows);
+	free(sub->Pages);
+	free(sub->Glyphs);
+	free(sub->Bitmap);
+	free(sub->Kerning);
+	free(sub->Bits);
+	free(sub->Offsets);
+	free(sub->Ranges);
+}
+
+
+/* Every kept character must find the same pixels in the subset as in the original */
+static void CheckSubset(const Entry_t *e, const Subset_t *sub)
+{
+	const OLED_FontDef_t *font = e->Font, *s = &sub->Font;
+	uint16_t pages = (font->FontHeight + 7) / 8, a, b;
+	uint32_t cp, bits;
+	const OLED_FontGlyph_t *ga, *gb;
+	uint8_t x[64], y[64];
+
+	for (cp = ' '; cp < SUBSET_CODEPOINTS; cp++)
+	{
+		if (!Has(&e->Chars, cp) && cp != SUBSET_CODEPOINTS - 1)
+		{
+			continue;
+		}
+
+		/* The last codepoint stands for any character left out: both draw their fallback */
+		a = Has(&e->Chars, cp) ? OLED_FONTS_GetGlyph(font, cp) : FallbackGlyph(font);
+		b = OLED_FONTS_GetGlyph(s, cp);
+
+		if (font->data != NULL && memcmp(&font->data[a * font->FontHeight], &s->data[b * font->FontHeight],
+		                                 font->FontHeight * sizeof(uint16_t)))
+		{
+			Fail("%s: U+%04X differs in the subset rows", e->Name, (unsigned)cp);
+		}
+
+		if (font->glyphs != NULL && memcmp(&font->glyphs[a * pages * font->FontWidth],
+		                                   &s->glyphs[b * pages * font->FontWidth], (size_t)pages * font->FontWidth))
+		{
+			Fail("%s: U+%04X differs in the subset pages", e->Name, (unsigned)cp);
+		}
+
+		if (font->metrics != NULL)
+		{
+			ga = &font->metrics->Glyphs[a];
+			gb = &s->metrics->Glyphs[b];
+
+			if (ga->Width != gb->Width || ga->Height != gb->Height || ga->OffsetX != gb->OffsetX ||
+			    ga->OffsetY != gb->OffsetY || ga->Advance != gb->Advance ||
+			    memcmp(&font->metrics->Bitmap[ga->Start], &s->metrics->Bitmap[gb->Start],
+			           (size_t)ga->Width * ((ga->Height + 7) / 8)))
+			{
+				Fail("%s: U+%04X differs in the subset metrics", e->Name, (unsigned)cp);
+			}
+		}
+
+		if (font->packed != NULL && font->packed->Offsets != NULL &&
+		    ((font->packed->Offsets[a + 1] & 0x7FFF) - (font->packed->Offsets[a] & 0x7FFF) !=
+		     (s->packed->Offsets[b + 1] & 0x7FFF) - (s->packed->Offsets[b] & 0x7FFF) ||
+		     memcmp(&font->packed->Bits[font->packed->Offsets[a] & 0x7FFF], &s->packed->Bits[s->packed->Offsets[b] & 0x7FFF],
+		            (font->packed->Offsets[a + 1] & 0x7FFF) - (font->packed->Offsets[a] & 0x7FFF))))
+		{
+			Fail("%s: U+%04X differs in the subset packed glyphs", e->Name, (unsigned)cp);
+		}
+
+		if (font->packed != NULL && font->packed->Offsets == NULL)
+		{
+			bits = (uint32_t)font->FontWidth * font->FontHeight;
+			memset(x, 0, sizeof(x));
+			memset(y, 0, sizeof(y));
+			CopyBits(x, 0, font->packed->Bits, a * bits, bits);
+			CopyBits(y, 0, s->packed->Bits, b * bits, bits);
+
+			if (memcmp(x, y, sizeof(x)))
+			{
+				Fail("%s: U+%04X differs in the subset packed glyphs", e->Name, (unsigned)cp);
+			}
+		}
+	}
+
+	for (a = 0; a < OLED_FONTS_CHARS; a++)
+	{
+		for (b = 0; b < OLED_FONTS_CHARS; b++)
+		{
+			if (Has(&e->Chars, ' ' + a) && Has(&e->Chars, ' ' + b) &&
+			    OLED_FONTS_GetKerning(font, ' ' + a, ' ' + b) != OLED_FONTS_GetKerning(s, ' ' + a, ' ' + b))
+			{
+				Fail("%s: kerning of '%c%c' differs in the subset", e->Name, ' ' + a, ' ' + b);
+			}
+		}
+	}
+}
+
+
+/******************************************** Output *********************************************************/
+
+/* Comment naming a glyph by the first character drawn with it */
+static void GlyphComment(FILE *f, const Entry_t *e, uint16_t old)
+{
+	uint32_t cp;
+
+	for (cp = ' '; cp < SUBSET_CODEPOINTS; cp++)
+	{
+		if (Has(&e->Chars, cp) && OLED_FONTS_GetGlyph(e->Font, cp) == old)
+		{
+			break;
+		}
+	}
+
+	if (cp == ' ')
+	{
+		fprintf(f, "  // sp\n");
+	}
+	else if (cp < 0x7F)
+	{
+		fprintf(f, "  // '%c'\n", (char)cp);
+	}
+	else if (cp < SUBSET_CODEPOINTS)
+	{
+		fprintf(f, "  // U+%04X\n", (unsigned)cp);
+	}
+	else
+	{
+		fprintf(f, "  // fallback\n");
+	}
+}
+
+
+static void WriteBytes(FILE *f, const uint8_t *d, uint32_t n)
+{
+	uint32_t i;
+
+	for (i = 0; i < n; i++)
+	{
+		fprintf(f, "0x%02X,%s", d[i], (i % 16 == 15 || i == n - 1) ? "\n" : " ");
+	}
+}
+
+
+static void WriteSubset(FILE *f, const Entry_t *e, const Subset_t *sub)
+{
+	const OLED_FontDef_t *font = &sub->Font;
+	uint16_t pages = (font->FontHeight + 7) / 8, i, k;
+	const OLED_FontGlyph_t *g;
+	const OLED_FontKern_t *kp;
+
+	fprintf(f, "\n/* %s: %u of %u glyphs */\n", e->Name, sub->Count, GlyphCount(e->Font));
+
+	if (font->data != NULL)
+	{
+		fprintf(f, "static const uint16_t %s_Rows [] = {\n", e->Name);
+
+		for (i = 0; i < sub->Count; i++)
+		{
+			for (k = 0; k < font->FontHeight; k++)
+			{
+				fprintf(f, "0x%04X,%s", font->data[i * font->FontHeight + k], (k == font->FontHeight - 1) ? "" : " ");
+			}
+
+			GlyphComment(f, e, sub->Old[i]);
+		}
+
+		fprintf(f, "};\n\n");
+	}
+
+	if (font->glyphs != NULL)
+	{
+		fprintf(f, "static const uint8_t %s_Pages [] = {\n", e->Name);
+
+		for (i = 0; i < sub->Count; i++)
+		{
+			for (k = 0; k < pages * font->FontWidth; k++)
+			{
+				fprintf(f, "0x%02X,%s", font->glyphs[i * pages * font->FontWidth + k],
+				        (k == pages * font->FontWidth - 1) ? "" : " ");
+			}
+
+			GlyphComment(f, e, sub->Old[i]);
+		}
+
+		fprintf(f, "};\n\n");
+	}
+
+	if (font->metrics != NULL)
+	{
+		fprintf(f, "static const uint8_t %s_Bitmap [] = {\n", e->Name);
+		WriteBytes(f, sub->Bitmap, sub->BitmapSize);
+		fprintf(f, "%s};\n\nstatic const OLED_FontGlyph_t %s_Glyphs [] = {\n", sub->BitmapSize ? "" : "0x00\n", e->Name);
+
+		for (i = 0; i < sub->Count; i++)
+		{
+			g = &sub->Glyphs[i];
+			fprintf(f, "{ %4u, %2u, %2u, %d, %2d, %2u },", g->Start, g->Width, g->Height, g->OffsetX, g->OffsetY, g->Advance);
+			GlyphComment(f, e, sub->Old[i]);
+		}
+
+		fprintf(f, "};\n\n");
+
+		if (sub->Metrics.KerningCount != 0)
+		{
+			fprintf(f, "static const OLED_FontKern_t %s_Kerning [] = {\n", e->Name);
+
+			for (i = 0; i < sub->Metrics.KerningCount; i++)
+			{
+				kp = &sub->Kerning[i];
+				fprintf(f, "{ %s%c', %s%c', %d },%s", (kp->Left == '\'' || kp->Left == '\\') ? "'\\" : "'", kp->Left,
+				        (kp->Right == '\'' || kp->Right == '\\') ? "'\\" : "'", kp->Right, kp->Adjust,
+				        (i % 8 == 7 || i == sub->Metrics.KerningCount - 1) ? "\n" : " ");
+			}
+
+			fprintf(f, "};\n\n");
+		}
+
+		fprintf(f, "static const OLED_FontMetrics_t %s_Metrics = { %s_Glyphs, %s_Bitmap, ", e->Name, e->Name, e->Name);
+
+		if (sub->Metrics.KerningCount != 0)
+		{
+			fprintf(f, "%s_Kerning, %u };\n\n", e->Name, sub->Metrics.KerningCount);
+		}
+		else
+		{
+			fprintf(f, "NULL, 0 };\n\n");
+		}
+	}
+
+	if (font->packed != NULL)
+	{
+		fprintf(f, "static const uint8_t %s_Bits [] = {\n", e->Name);
+		WriteBytes(f, sub->Bits, sub->BitsSize);
+		fprintf(f, "};\n\n");
+
+		if (sub->Offsets != NULL)
+		{
+			fprintf(f, "static const uint16_t %s_Offsets [] = {\n", e->Name);
+
+			for (i = 0; i <= sub->Count; i++)
+			{
+				fprintf(f, "0x%04X,%s", sub->Offsets[i], (i % 12 == 11 || i == sub->Count) ? "\n" : " ");
+			}
+
+			fprintf(f, "};\n\n");
+		}
+
+		fprintf(f, "static const OLED_FontPacked_t %s_Packed = { %s%s, %s_Bits };\n\n", e->Name,
+		        sub->Offsets ? e->Name : "NULL", sub->Offsets ? "_Offsets" : "", e->Name);
+	}
+
+	fprintf(f, "static const OLED_FontRange_t %s_Ranges [] = {\n", e->Name);
+
+	for (i = 0; i < sub->Charset.RangeCount; i++)
+	{
+		fprintf(f, "{ 0x%04X, 0x%04X, %3u },%s", sub->Ranges[i].First, sub->Ranges[i].Last, sub->Ranges[i].Index,
+		        (i % 5 == 4 || i == sub->Charset.RangeCount - 1) ? "\n" : " ");
+	}
+
+	fprintf(f, "};\n\n/* Glyph of each character ' ' to '~', %u for the ones left out */\nstatic const uint8_t %s_Map [] = {\n",
+	        sub->Charset.Fallback, e->Name);
+	WriteBytes(f, sub->Map, OLED_FONTS_CHARS);
+	fprintf(f, "};\n\nstatic const OLED_FontCharset_t %s_Charset = { %s_Ranges, %u, %u, %u, %s_Map };\n\n", e->Name,
+	        e->Name, sub->Charset.RangeCount, sub->Charset.GlyphCount, sub->Charset.Fallback, e->Name);
+
+	fprintf(f, "OLED_FontDef_t %s = { %u, %u, ", e->Name, font->FontWidth, font->FontHeight);
+	fprintf(f, font->data ? "%s_Rows, " : "NULL, ", e->Name);
+	fprintf(f, font->glyphs ? "%s_Pages, " : "NULL, ", e->Name);
+	fprintf(f, font->metrics ? "&%s_Metrics, " : "NULL, ", e->Name);
+	fprintf(f, font->packed ? "&%s_Packed, " : "NULL, ", e->Name);
+	fprintf(f, "&%s_Charset };\n", e->Name);
+}
+
+
+/************************************************ Main *******************************************************/
+
+static void Usage(void)
+{
+	fprintf(stderr, "usage: oled_subset --manifest fonts.txt -o output.c [--scan file.c ...]\n");
+	exit(2);
+}
+
+
+int main(int argc, char **argv)
+{
+	const char *manifest = NULL, *output = NULL;
+	uint32_t before, after, total_before = 0, total_after = 0, cp;
+	Subset_t sub;
+	FILE *f;
+	int a, i, scan = 0, scanned = 0;
+
+	for (a = 1; a < argc; a++)
+	{
+		if (!strcmp(argv[a], "--manifest") && a + 1 < argc)
+		{
+			manifest = argv[++a];
+			scan = 0;
+		}
+		else if (!strcmp(argv[a], "-o") && a + 1 < argc)
+		{
+			output = argv[++a];
+			scan = 0;
+		}
+		else if (!strcmp(argv[a], "--scan"))
+		{
+			scan = 1;
+		}
+		else if (argv[a][0] == '-' || !scan)
+		{
+			Usage();
+		}
+		else
+		{
+			ScanFile(argv[a]);
+			scanned++;
+		}
+	}
+
+	if (manifest == NULL || output == NULL)
+	{
+		Usage();
+	}
+
+	ReadManifest(manifest);
+
+	f = fopen(output, "wb");
+
+	if (f == NULL)
+	{
+		Fail("cannot write %s", output);
+	}
+
+	fprintf(f, "/* Generated by oled_subset from %s, do not edit */\n\n#include \"OLED_SSD1306_Fonts.h\"\n\n", manifest);
+	fprintf(f, "#ifdef OLED_FONTS_SUBSET\n");
+
+	for (i = 0; i < ENTRY_COUNT; i++)
+	{
+		Entry_t *e = &Entries[i];
+
+		before = OLED_FONTS_GetFlashSize(e->Font);
+		total_before += before;
+
+		if (!e->Listed)
+		{
+			fprintf(stderr, "%-22s dropped, %lu bytes saved\n", e->Name, (unsigned long)before);
+			continue;
+		}
+
+		if (e->Scanned && scanned == 0)
+		{
+			Fail("%s uses '*' but no files were given with --scan", e->Name);
+		}
+
+		/* Space pads text boxes, console lines and numbers, it is always kept */
+		Add(&e->Chars, ' ');
+
+		for (cp = 0; e->Scanned && cp < SUBSET_CODEPOINTS; cp++)
+		{
+			if (Has(&ScanChars, cp))
+			{
+				Add(&e->Chars, cp);
+			}
+		}
+
+		BuildSubset(e, &sub);
+		CheckSubset(e, &sub);
+		WriteSubset(f, e, &sub);
+
+		after = OLED_FONTS_GetFlashSize(&sub.Font);
+		total_after += after;
+		fprintf(stderr, "%-22s %3u of %3u glyphs, %6lu -> %5lu bytes\n", e->Name, sub.Count, GlyphCount(e->Font),
+		        (unsigned long)before, (unsigned long)after);
+		FreeSubset(&sub);
+	}
+
+	fprintf(f, "\n#endif /* OLED_FONTS_SUBSET */\n");
+	fclose(f);
+
+	fprintf(stderr, "all fonts: %lu -> %lu bytes\n", (unsigned long)total_before, (unsigned long)total_after);
+	return 0;
+}
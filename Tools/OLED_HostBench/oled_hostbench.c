@@ -0,0 +1,167 @@
+/**
+  **********************************************************************************************************************
+   * @file   : oled_hostbench.c
+   * @author : Sharath N
+   * @brief  : Runs the SSD1306 OLED Driver benchmarks on the host
+  **********************************************************************************************************************
+*/
+
+/*
+          Build from this directory, the stm32f4xx_hal.h next to this file stands in for the HAL:
+
+              gcc -std=c99 -O2 -Wall -I. -I../../STM32F407_OLED_SSD1306_Driver -I../../OLED_SSD1306_Fonts \
+                  -I../../OLED_SSD1306_Benchmark -o oled_hostbench oled_hostbench.c \
+                  ../../STM32F407_OLED_SSD1306_Driver/STM32F407_OLED_SSD1306_Driver.c \
+                  ../../OLED_SSD1306_Fonts/OLED_SSD1306_Fonts.c ../../OLED_SSD1306_Benchmark/OLED_SSD1306_Benchmark.c
+
+          and run ./oled_hostbench. Every benchmark of OLED_SSD1306_Benchmark.c is run as it is on the target,
+          with the DWT cycle counter replaced by the host's monotonic clock, and printed as nanoseconds per call
+          for the legacy and the current implementation. The figures compare the two paths on the host's CPU and
+          compiler, they are not target timings: use OLED_BENCH_Run...() in the debugger for those.
+
+          Options:
+              --repeat n           Runs of the whole set, the fastest of them is printed (default 5)
+*/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "stm32f4xx_hal.h"
+#include "OLED_SSD1306_Benchmark.h"
+
+/* One benchmark function of OLED_SSD1306_Benchmark.c */
+typedef struct {
+	const char *Title;
+	uint8_t (*Run)(OLED_Bench_Result_t *results);
+} Bench_t;
+
+static const Bench_t Benches[] = {
+	{ "Spans",   OLED_BENCH_RunSpans },
+	{ "Gray8",   OLED_BENCH_RunGray8 },
+	{ "Unpack",  OLED_BENCH_RunUnpack },
+	{ "Text",    OLED_BENCH_RunText },
+	{ "Format",  OLED_BENCH_RunFormat },
+};
+
+
+/**************************************************** HAL ****************************************************/
+
+static DWT_Type HostDwt;
+CoreDebug_Type OLED_HOST_CoreDebug;
+uint32_t SystemCoreClock = 168000000;
+
+DWT_Type *OLED_HOST_ReadDwt(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	HostDwt.CYCCNT = (uint32_t)((uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec);
+	return &HostDwt;
+}
+
+void HAL_GPIO_Init(void *port, GPIO_InitTypeDef *init) { (void)port; (void)init; }
+HAL_StatusTypeDef HAL_I2C_Init(I2C_HandleTypeDef *hi2c) { (void)hi2c; return HAL_OK; }
+void HAL_I2C_EV_IRQHandler(I2C_HandleTypeDef *hi2c) { (void)hi2c; }
+void HAL_I2C_ER_IRQHandler(I2C_HandleTypeDef *hi2c) { (void)hi2c; }
+void HAL_NVIC_SetPriority(IRQn_Type irq, uint32_t preempt, uint32_t sub) { (void)irq; (void)preempt; (void)sub; }
+void HAL_NVIC_EnableIRQ(IRQn_Type irq) { (void)irq; }
+uint32_t HAL_SYSTICK_Config(uint32_t ticks) { (void)ticks; return 0; }
+void HAL_SYSTICK_CLKSourceConfig(uint32_t source) { (void)source; }
+void HAL_SYSTICK_IRQHandler(void) { }
+uint32_t HAL_RCC_GetHCLKFreq(void) { return SystemCoreClock; }
+void HAL_IncTick(void) { }
+void HAL_Delay(uint32_t ms) { (void)ms; }
+
+HAL_StatusTypeDef HAL_I2C_IsDeviceReady(I2C_HandleTypeDef *hi2c, uint16_t address, uint32_t trials, uint32_t timeout)
+{
+	(void)hi2c; (void)address; (void)trials; (void)timeout;
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_I2C_Master_Transmit(I2C_HandleTypeDef *hi2c, uint16_t address, uint8_t *data, uint16_t size,
+                                          uint32_t timeout)
+{
+	(void)hi2c; (void)address; (void)data; (void)size; (void)timeout;
+	return HAL_OK;
+}
+
+/* Interrupt driven transfers complete at once */
+HAL_StatusTypeDef HAL_I2C_Master_Transmit_IT(I2C_HandleTypeDef *hi2c, uint16_t address, uint8_t *data, uint16_t size)
+{
+	(void)address; (void)data; (void)size;
+	HAL_I2C_MasterTxCpltCallback(hi2c);
+	return HAL_OK;
+}
+
+
+/************************************************** Main *****************************************************/
+
+static void Usage(void)
+{
+	fprintf(stderr, "usage: oled_hostbench [--repeat n]\n");
+	exit(2);
+}
+
+
+int main(int argc, char **argv)
+{
+	OLED_Bench_Result_t results[OLED_BENCH_MAX_RESULTS], best[OLED_BENCH_MAX_RESULTS];
+	int repeat = 5, a, r;
+	uint8_t b, i, n;
+
+	for (a = 1; a < argc; a++)
+	{
+		if (!strcmp(argv[a], "--repeat") && a + 1 < argc && atoi(argv[a + 1]) > 0)
+		{
+			repeat = atoi(argv[++a]);
+		}
+		else
+		{
+			Usage();
+		}
+	}
+
+	OLED_SSD1306_Init();
+	OLED_BENCH_Init();
+
+	printf("%-32s %12s %12s %8s\n", "case", "legacy ns", "current ns", "ratio");
+
+	for (b = 0; b < sizeof(Benches) / sizeof(Benches[0]); b++)
+	{
+		/* The fastest of several runs, the least disturbed by the rest of the host */
+		for (r = 0, n = 0; r < repeat; r++)
+		{
+			n = Benches[b].Run(results);
+
+			for (i = 0; i < n; i++)
+			{
+				if (r == 0 || results[i].LegacyCycles < best[i].LegacyCycles)
+				{
+					best[i].LegacyCycles = results[i].LegacyCycles;
+				}
+
+				if (r == 0 || results[i].FastCycles < best[i].FastCycles)
+				{
+					best[i].FastCycles = results[i].FastCycles;
+				}
+
+				best[i].Name = results[i].Name;
+			}
+		}
+
+		printf("%s\n", Benches[b].Title);
+
+		for (i = 0; i < n; i++)
+		{
+			printf("  %-30s %12lu %12lu %7.2fx\n", best[i].Name, (unsigned long)best[i].LegacyCycles,
+			       (unsigned long)best[i].FastCycles,
+			       best[i].FastCycles ? (double)best[i].LegacyCycles / best[i].FastCycles : 0.0);
+		}
+	}
+
+	return 0;
+}
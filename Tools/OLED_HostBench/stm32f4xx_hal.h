@@ -0,0 +1,97 @@
+/**
+  **********************************************************************************************************************
+   * @file   : stm32f4xx_hal.h
+   * @author : Sharath N
+   * @brief  : Host stand-in for the STM32F4 HAL, just enough to build the driver and its benchmarks with gcc
+  **********************************************************************************************************************
+*/
+
+/*
+          Only for oled_hostbench.c: the I2C functions accept every transfer and send nothing, and the DWT cycle
+          counter reads the host's monotonic clock in nanoseconds, so OLED_SSD1306_Benchmark.c runs unchanged
+          and its "cycles" are host nanoseconds.
+*/
+
+#ifndef STM32F4XX_HAL_H
+#define STM32F4XX_HAL_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+typedef enum { HAL_OK = 0, HAL_ERROR, HAL_BUSY, HAL_TIMEOUT } HAL_StatusTypeDef;
+typedef int IRQn_Type;
+
+typedef struct {
+	uint32_t ClockSpeed, DutyCycle, OwnAddress1, AddressingMode, DualAddressMode, OwnAddress2, GeneralCallMode,
+	         NoStretchMode;
+} I2C_InitTypeDef;
+
+typedef struct {
+	void *Instance;
+	I2C_InitTypeDef Init;
+} I2C_HandleTypeDef;
+
+typedef struct {
+	uint32_t Pin, Mode, Pull, Speed, Alternate;
+} GPIO_InitTypeDef;
+
+#define GPIOB                        ((void *)0)
+#define I2C1                         ((void *)0)
+#define GPIO_PIN_6                   0x0040u
+#define GPIO_PIN_7                   0x0080u
+#define GPIO_MODE_AF_OD              0u
+#define GPIO_PULLUP                  0u
+#define GPIO_SPEED_FREQ_VERY_HIGH    0u
+#define GPIO_AF4_I2C1                4u
+#define I2C_ADDRESSINGMODE_7BIT      0u
+#define I2C_DUALADDRESS_DISABLED     0u
+#define I2C_DUTYCYCLE_2              0u
+#define I2C_GENERALCALL_DISABLED     0u
+#define I2C_NOSTRETCH_DISABLED       0u
+#define SYSTICK_CLKSOURCE_HCLK       0u
+#define SysTick_IRQn                 (-1)
+#define I2C1_EV_IRQn                 31
+#define I2C1_ER_IRQn                 32
+
+#define __HAL_RCC_GPIOB_CLK_ENABLE() do { } while (0)
+#define __HAL_RCC_I2C1_CLK_ENABLE()  do { } while (0)
+
+void HAL_GPIO_Init(void *port, GPIO_InitTypeDef *init);
+HAL_StatusTypeDef HAL_I2C_Init(I2C_HandleTypeDef *hi2c);
+HAL_StatusTypeDef HAL_I2C_IsDeviceReady(I2C_HandleTypeDef *hi2c, uint16_t address, uint32_t trials, uint32_t timeout);
+HAL_StatusTypeDef HAL_I2C_Master_Transmit(I2C_HandleTypeDef *hi2c, uint16_t address, uint8_t *data, uint16_t size,
+                                          uint32_t timeout);
+HAL_StatusTypeDef HAL_I2C_Master_Transmit_IT(I2C_HandleTypeDef *hi2c, uint16_t address, uint8_t *data, uint16_t size);
+void HAL_I2C_EV_IRQHandler(I2C_HandleTypeDef *hi2c);
+void HAL_I2C_ER_IRQHandler(I2C_HandleTypeDef *hi2c);
+void HAL_I2C_MasterTxCpltCallback(I2C_HandleTypeDef *hi2c);
+void HAL_NVIC_SetPriority(IRQn_Type irq, uint32_t preempt, uint32_t sub);
+void HAL_NVIC_EnableIRQ(IRQn_Type irq);
+uint32_t HAL_SYSTICK_Config(uint32_t ticks);
+void HAL_SYSTICK_CLKSourceConfig(uint32_t source);
+void HAL_SYSTICK_IRQHandler(void);
+uint32_t HAL_RCC_GetHCLKFreq(void);
+void HAL_IncTick(void);
+void HAL_Delay(uint32_t ms);
+
+/* Cycle counter: every read of DWT refreshes CYCCNT from the host clock */
+typedef struct {
+	volatile uint32_t CTRL;
+	volatile uint32_t CYCCNT;
+} DWT_Type;
+
+typedef struct {
+	volatile uint32_t DEMCR;
+} CoreDebug_Type;
+
+DWT_Type *OLED_HOST_ReadDwt(void);
+extern CoreDebug_Type OLED_HOST_CoreDebug;
+extern uint32_t SystemCoreClock;
+
+#define DWT                          (OLED_HOST_ReadDwt())
+#define CoreDebug                    (&OLED_HOST_CoreDebug)
+#define CoreDebug_DEMCR_TRCENA_Msk   (1u << 24)
+#define DWT_CTRL_CYCCNTENA_Msk       1u
+
+#endif